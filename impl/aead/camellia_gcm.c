@@ -0,0 +1,377 @@
+#include "../simd.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "camellia_gcm.h"
+#include "../camellia/bytesliced.h"
+
+// the camellia kernels see a block as two big-endian words
+static const uint8_t bswap_64_idx[16] = { 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 };
+// GHASH works on byte-reflected blocks, so bit i of the integer is the
+// coefficient of x^(127 - i) and pmull needs no bit reversal
+static const uint8_t reflect_idx[16] = { 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+
+// x^128 + x^7 + x^2 + x + 1 reflected, as the constant of a montgomery step
+#define GHASH_POLY 0xc200000000000000UL
+
+static uint64_t load_be64(const uint8_t b[8])
+{
+        uint64_t x = 0;
+        for (size_t i = 0; i < 8; i++) {
+                x = (x << 8) | b[i];
+        }
+        return x;
+}
+
+static void store_be64(uint8_t b[8], uint64_t x)
+{
+        for (size_t i = 0; i < 8; i++) {
+                b[i] = x >> (56 - 8 * i);
+        }
+}
+
+static inline uint8x16_t clmul_lo(const uint8x16_t a, const uint8x16_t b)
+{
+        return vreinterpretq_u8_p128(vmull_p64((poly64_t)vgetq_lane_u64(a, 0),
+                                               (poly64_t)vgetq_lane_u64(b, 0)));
+}
+
+static inline uint8x16_t clmul_hi(const uint8x16_t a, const uint8x16_t b)
+{
+        return vreinterpretq_u8_p128(vmull_high_p64(vreinterpretq_p64_u8(a),
+                                                    vreinterpretq_p64_u8(b)));
+}
+
+static inline uint8x16_t ghash_load(const uint8_t b[16])
+{
+        return vqtbl1q_u8(vld1q_u8(b), vld1q_u8(reflect_idx));
+}
+
+// adds the unreduced karatsuba product of x and h to acc (low, middle, high)
+static inline void ghash_mul_acc(uint8x16_t acc[restrict 3], const uint8x16_t x,
+                                 const uint8x16_t h, const uint8x16_t h_k)
+{
+        const uint8x16_t x_k = veorq_u8(x, vextq_u64(x, x, 1));
+
+        acc[0] = veorq_u8(acc[0], clmul_lo(x, h));
+        acc[1] = veorq_u8(acc[1], clmul_lo(x_k, h_k));
+        acc[2] = veorq_u8(acc[2], clmul_hi(x, h));
+}
+
+// the 256-bit product carries one extra factor x^-128 from the reflection,
+// two montgomery steps by the reflected polynomial cancel it
+static inline uint8x16_t ghash_reduce(const uint8x16_t acc[restrict 3])
+{
+        const uint8x16_t zero = vdupq_n_u8(0);
+        const uint8x16_t poly = vdupq_n_u64(GHASH_POLY);
+
+        const uint8x16_t mid = veorq_u8(acc[1], veorq_u8(acc[0], acc[2]));
+        uint8x16_t lo = veorq_u8(acc[0], vextq_u64(zero, mid, 1));
+        const uint8x16_t hi = veorq_u8(acc[2], vextq_u64(mid, zero, 1));
+
+        lo = veorq_u8(vextq_u64(lo, lo, 1), clmul_lo(lo, poly));
+        lo = veorq_u8(vextq_u64(lo, lo, 1), clmul_lo(lo, poly));
+
+        return veorq_u8(hi, lo);
+}
+
+static inline uint8x16_t ghash_1(const struct camellia_gcm_ctx *restrict ctx,
+                                 const uint8x16_t x, const uint8_t b[restrict 16])
+{
+        uint8x16_t acc[3] = { vdupq_n_u8(0), vdupq_n_u8(0), vdupq_n_u8(0) };
+        ghash_mul_acc(acc, veorq_u8(x, ghash_load(b)), ctx->h[0], ctx->h_k[0]);
+        return ghash_reduce(acc);
+}
+
+// (((x + b0) H + b1) H + b2) H + b3) H = (x + b0) H^4 + b1 H^3 + b2 H^2 + b3 H,
+// so the four products share one reduction
+static inline uint8x16_t ghash_4(const struct camellia_gcm_ctx *restrict ctx,
+                                 const uint8x16_t x, const uint8_t b[restrict 64])
+{
+        uint8x16_t acc[3] = { vdupq_n_u8(0), vdupq_n_u8(0), vdupq_n_u8(0) };
+        ghash_mul_acc(acc, veorq_u8(x, ghash_load(&b[0])), ctx->h[3], ctx->h_k[3]);
+        ghash_mul_acc(acc, ghash_load(&b[16]), ctx->h[2], ctx->h_k[2]);
+        ghash_mul_acc(acc, ghash_load(&b[32]), ctx->h[1], ctx->h_k[1]);
+        ghash_mul_acc(acc, ghash_load(&b[48]), ctx->h[0], ctx->h_k[0]);
+        return ghash_reduce(acc);
+}
+
+static uint8x16_t ghash_blocks(const struct camellia_gcm_ctx *restrict ctx, uint8x16_t x,
+                               const uint8_t *restrict b, size_t nblocks)
+{
+        for (; nblocks >= CAMELLIA_GCM_AGGREGATE; nblocks -= CAMELLIA_GCM_AGGREGATE) {
+                x = ghash_4(ctx, x, b);
+                b += 16 * CAMELLIA_GCM_AGGREGATE;
+        }
+        for (; nblocks > 0; nblocks--) {
+                x = ghash_1(ctx, x, b);
+                b += 16;
+        }
+        return x;
+}
+
+// zero padded, n < 16
+static uint8x16_t ghash_partial(const struct camellia_gcm_ctx *restrict ctx, const uint8x16_t x,
+                                const uint8_t *restrict b, const size_t n)
+{
+        uint8_t pad[16] = { 0 };
+        memcpy(pad, b, n);
+        return ghash_1(ctx, x, pad);
+}
+
+// encrypts the 16 counter blocks into ks (as bytes) and absorbs nblocks of
+// ghash_in into x on the way: the pmull chains do not depend on the s-box
+// lookups, so a group of 4 goes in after every fourth round and the core can
+// overlap both (18 rounds leave room for 4 groups, i.e. a full batch)
+static void camellia_gcm_batch(const struct camellia_gcm_ctx *restrict ctx,
+                               uint8_t ks[restrict 256], const uint64_t ctrs[restrict 16][2],
+                               uint8x16_t *restrict x, const uint8_t *restrict ghash_in,
+                               size_t nblocks)
+{
+        uint8x16x4_t state[4];
+        camellia_sliced_pack(state, ctrs);
+
+        // kw0/kw1
+        for (size_t byte = 0; byte < 16; byte++) {
+                uint8x16_t *reg         = &state[byte / 4].val[byte % 4];
+                const uint8x16x4_t *key = &ctx->rks.kw[byte / 8 + 0][(byte % 8) / 4];
+
+                *reg = veorq_u8(*reg, key->val[byte % 4]);
+        }
+
+        size_t round = 0;
+        for (size_t layer = 0; layer <= ctx->layers; layer++) {
+                if (layer > 0) {
+                        camellia_sliced_FL(&state[0], ctx->rks.kl[2 * (layer - 1) + 0]);
+                        camellia_sliced_FL_inv(&state[2], ctx->rks.kl[2 * (layer - 1) + 1]);
+                }
+
+                for (size_t i = 0; i < 6; i++, round++) {
+                        camellia_sliced_feistel_round(state, ctx->rks.ku[round]);
+
+                        if (round % 4 == 3 && nblocks >= CAMELLIA_GCM_AGGREGATE) {
+                                *x = ghash_4(ctx, *x, ghash_in);
+                                ghash_in += 16 * CAMELLIA_GCM_AGGREGATE;
+                                nblocks -= CAMELLIA_GCM_AGGREGATE;
+                        }
+                }
+        }
+
+        // swap state[0,1] and state[2,3] (concatenation of R||L)
+        uint8x16x4_t tmp = state[0];
+        state[0] = state[2];
+        state[2] = tmp;
+        tmp = state[1];
+        state[1] = state[3];
+        state[3] = tmp;
+
+        // kw2/kw3
+        for (size_t byte = 0; byte < 16; byte++) {
+                uint8x16_t *reg         = &state[byte / 4].val[byte % 4];
+                const uint8x16x4_t *key = &ctx->rks.kw[byte / 8 + 2][(byte % 8) / 4];
+
+                *reg = veorq_u8(*reg, key->val[byte % 4]);
+        }
+
+        uint64_t words[16][2];
+        camellia_sliced_unpack(words, state);
+        const uint8x16_t bswap = vld1q_u8(bswap_64_idx);
+        for (size_t i = 0; i < 16; i++) {
+                vst1q_u8(&ks[16 * i], vqtbl1q_u8(vld1q_u8((uint8_t*)words[i]), bswap));
+        }
+
+        *x = ghash_blocks(ctx, *x, ghash_in, nblocks);
+}
+
+// J0 = nonce || 1 and inc32 only touches the low 32 bits of the second word
+static void camellia_gcm_counters(uint64_t ctrs[restrict 16][2],
+                                  const uint8_t nonce[restrict CAMELLIA_GCM_NONCE_BYTES],
+                                  const uint32_t ctr)
+{
+        const uint64_t w0 = load_be64(&nonce[0]);
+        const uint64_t w1 = ((uint64_t)nonce[8] << 56) | ((uint64_t)nonce[9] << 48) |
+                            ((uint64_t)nonce[10] << 40) | ((uint64_t)nonce[11] << 32);
+
+        for (uint32_t i = 0; i < 16; i++) {
+                ctrs[i][0] = w0;
+                ctrs[i][1] = w1 | (uint32_t)(ctr + i);
+        }
+}
+
+static void camellia_gcm_xor(uint8_t *out, const uint8_t *in,
+                             const uint8_t *restrict ks, const size_t n)
+{
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+                vst1q_u8(&out[i], veorq_u8(vld1q_u8(&in[i]), vld1q_u8(&ks[i])));
+        }
+        for (; i < n; i++) {
+                out[i] = in[i] ^ ks[i];
+        }
+}
+
+// the batch computing the keystream for chunk k + 1 hashes the ciphertext of
+// chunk k when encrypting (it only exists once the keystream is applied) and
+// that of chunk k + 1 itself when decrypting; the first batch starts at J0
+// and its first block masks the tag
+static void camellia_gcm_crypt(const struct camellia_gcm_ctx *restrict ctx,
+                               uint8_t *out, uint8_t tag[restrict CAMELLIA_GCM_TAG_BYTES],
+                               const uint8_t *in, size_t len,
+                               const uint8_t *restrict ad, const size_t adlen,
+                               const uint8_t nonce[restrict CAMELLIA_GCM_NONCE_BYTES],
+                               const int encrypt)
+{
+        const size_t mlen = len;
+        uint64_t ctrs[16][2];
+        uint8_t ks[256];
+        uint8_t mask[16];
+        uint32_t ctr = 1;
+
+        uint8x16_t x = ghash_blocks(ctx, vdupq_n_u8(0), ad, adlen / 16);
+        if (adlen % 16 != 0) {
+                x = ghash_partial(ctx, x, &ad[adlen - adlen % 16], adlen % 16);
+        }
+
+        size_t offset = 16;
+        size_t n = len < 256 - offset ? len : 256 - offset;
+        camellia_gcm_counters(ctrs, nonce, ctr);
+        camellia_gcm_batch(ctx, ks, ctrs, &x, in, encrypt ? 0 : n / 16);
+        memcpy(mask, ks, 16);
+        ctr += 16;
+
+        for (;;) {
+                // only the last chunk can end in a partial block, keep its
+                // ciphertext around in case out == in
+                uint8_t tail[16];
+                const size_t rest = n % 16;
+                if (!encrypt && rest != 0) {
+                        memcpy(tail, &in[n - rest], rest);
+                }
+                camellia_gcm_xor(out, in, &ks[offset], n);
+                if (encrypt && rest != 0) {
+                        memcpy(tail, &out[n - rest], rest);
+                }
+
+                in += n;
+                out += n;
+                len -= n;
+
+                if (len == 0) {
+                        if (encrypt) {
+                                x = ghash_blocks(ctx, x, out - n, n / 16);
+                        }
+                        if (rest != 0) {
+                                x = ghash_partial(ctx, x, tail, rest);
+                        }
+                        break;
+                }
+
+                const size_t next = len < 256 ? len : 256;
+                camellia_gcm_counters(ctrs, nonce, ctr);
+                if (encrypt) {
+                        camellia_gcm_batch(ctx, ks, ctrs, &x, out - n, n / 16);
+                } else {
+                        camellia_gcm_batch(ctx, ks, ctrs, &x, in, next / 16);
+                }
+                ctr += 16;
+                offset = 0;
+                n = next;
+        }
+
+        uint8_t lengths[16];
+        store_be64(&lengths[0], 8 * (uint64_t)adlen);
+        store_be64(&lengths[8], 8 * (uint64_t)mlen);
+        x = ghash_1(ctx, x, lengths);
+
+        vst1q_u8(tag, veorq_u8(vqtbl1q_u8(x, vld1q_u8(reflect_idx)), vld1q_u8(mask)));
+}
+
+// h[0] = reflect(H) * x, then h[i] = reflect(H^(i + 1)) * x; multiplying by
+// x makes up for the one bit the reflected product is off by
+static void camellia_gcm_init_hash(struct camellia_gcm_ctx *restrict ctx)
+{
+        const uint64_t zero[16][2] = { { 0 } };
+        uint8_t ks[256];
+        uint8x16_t x = vdupq_n_u8(0);
+        camellia_gcm_batch(ctx, ks, zero, &x, NULL, 0);
+
+        uint8x16_t h = ghash_load(ks);
+        for (size_t i = 0; i < CAMELLIA_GCM_AGGREGATE; i++) {
+                uint64_t lo = vgetq_lane_u64(h, 0);
+                uint64_t hi = vgetq_lane_u64(h, 1);
+                const uint64_t carry = hi >> 63;
+                hi = (hi << 1) | (lo >> 63);
+                lo = lo << 1;
+                if (carry) {
+                        hi ^= GHASH_POLY;
+                        lo ^= 1;
+                }
+
+                ctx->h[i] = vsetq_lane_u64(hi, vdupq_n_u64(lo), 1);
+                ctx->h_k[i] = vdupq_n_u64(lo ^ hi);
+
+                uint8x16_t acc[3] = { vdupq_n_u8(0), vdupq_n_u8(0), vdupq_n_u8(0) };
+                ghash_mul_acc(acc, h, ctx->h[0], ctx->h_k[0]);
+                h = ghash_reduce(acc);
+        }
+}
+
+void camellia_gcm_init_128(struct camellia_gcm_ctx *restrict ctx, const uint8_t key[restrict 16])
+{
+        const uint64_t k[2] = { load_be64(&key[0]), load_be64(&key[8]) };
+        struct camellia_rks_sliced_128 rks;
+
+        camellia_sliced_init();
+        camellia_sliced_generate_round_keys_128(&rks, k);
+
+        ctx->layers = 2;
+        memcpy(ctx->rks.kw, rks.kw, sizeof(rks.kw));
+        memcpy(ctx->rks.ku, rks.ku, sizeof(rks.ku));
+        memcpy(ctx->rks.kl, rks.kl, sizeof(rks.kl));
+        camellia_gcm_init_hash(ctx);
+}
+
+void camellia_gcm_init_256(struct camellia_gcm_ctx *restrict ctx, const uint8_t key[restrict 32])
+{
+        const uint64_t k[4] = {
+                load_be64(&key[0]), load_be64(&key[8]), load_be64(&key[16]), load_be64(&key[24])
+        };
+
+        camellia_sliced_init();
+        camellia_sliced_generate_round_keys_256(&ctx->rks, k);
+
+        ctx->layers = 3;
+        camellia_gcm_init_hash(ctx);
+}
+
+void camellia_gcm_encrypt(const struct camellia_gcm_ctx *restrict ctx,
+                          uint8_t *c, uint8_t tag[restrict CAMELLIA_GCM_TAG_BYTES],
+                          const uint8_t *m, size_t mlen,
+                          const uint8_t *restrict ad, size_t adlen,
+                          const uint8_t nonce[restrict CAMELLIA_GCM_NONCE_BYTES])
+{
+        camellia_gcm_crypt(ctx, c, tag, m, mlen, ad, adlen, nonce, 1);
+}
+
+int camellia_gcm_decrypt(const struct camellia_gcm_ctx *restrict ctx,
+                         uint8_t *m, const uint8_t *c, size_t clen,
+                         const uint8_t *restrict ad, size_t adlen,
+                         const uint8_t nonce[restrict CAMELLIA_GCM_NONCE_BYTES],
+                         const uint8_t tag[restrict CAMELLIA_GCM_TAG_BYTES])
+{
+        uint8_t tag_actual[CAMELLIA_GCM_TAG_BYTES];
+        camellia_gcm_crypt(ctx, m, tag_actual, c, clen, ad, adlen, nonce, 0);
+
+        // compare in constant time
+        uint8_t diff = 0;
+        for (size_t i = 0; i < CAMELLIA_GCM_TAG_BYTES; i++) {
+                diff |= tag[i] ^ tag_actual[i];
+        }
+
+        if (diff != 0) {
+                memset(m, 0, clen);
+                return -1;
+        }
+        return 0;
+}
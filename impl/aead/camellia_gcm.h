@@ -0,0 +1,42 @@
+#pragma once
+
+// Camellia-GCM (NIST SP 800-38D with camellia as the block cipher, 96-bit
+// nonce, 128-bit tag) for 128-bit and 256-bit keys. the CTR keystream comes
+// from the bytesliced kernel 16 blocks at a time and GHASH uses pmull with
+// one reduction per 4 blocks, scheduled between the rounds of the next batch
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../simd.h"
+
+#include "../camellia/camellia_keys.h"
+
+#define CAMELLIA_GCM_TAG_BYTES 16
+#define CAMELLIA_GCM_NONCE_BYTES 12
+// blocks absorbed per GHASH reduction
+#define CAMELLIA_GCM_AGGREGATE 4
+
+struct camellia_gcm_ctx {
+        size_t layers; // FL layers, 2 for 128-bit keys and 3 for 256-bit keys
+        struct camellia_rks_sliced_256 rks; // a 128-bit schedule fills the front
+        uint8x16_t h[CAMELLIA_GCM_AGGREGATE]; // H^(i + 1), byte reflected and times x
+        uint8x16_t h_k[CAMELLIA_GCM_AGGREGATE]; // low ^ high half of h[i] (karatsuba)
+};
+
+// keys are byte strings as in RFC 3713
+void camellia_gcm_init_128(struct camellia_gcm_ctx *restrict ctx, const uint8_t key[restrict 16]);
+void camellia_gcm_init_256(struct camellia_gcm_ctx *restrict ctx, const uint8_t key[restrict 32]);
+
+// c has room for mlen bytes and may equal m, the tag is written separately
+void camellia_gcm_encrypt(const struct camellia_gcm_ctx *restrict ctx,
+                          uint8_t *c, uint8_t tag[restrict CAMELLIA_GCM_TAG_BYTES],
+                          const uint8_t *m, size_t mlen,
+                          const uint8_t *restrict ad, size_t adlen,
+                          const uint8_t nonce[restrict CAMELLIA_GCM_NONCE_BYTES]);
+
+// returns 0 if the tag verifies and -1 otherwise (m is cleared in that case)
+int camellia_gcm_decrypt(const struct camellia_gcm_ctx *restrict ctx,
+                         uint8_t *m, const uint8_t *c, size_t clen,
+                         const uint8_t *restrict ad, size_t adlen,
+                         const uint8_t nonce[restrict CAMELLIA_GCM_NONCE_BYTES],
+                         const uint8_t tag[restrict CAMELLIA_GCM_TAG_BYTES]);
@@ -0,0 +1,236 @@
+#include "../simd.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "gift_cofb.h"
+
+static uint64_t load_be64(const uint8_t b[8])
+{
+        uint64_t x = 0;
+        for (size_t i = 0; i < 8; i++) {
+                x = (x << 8) | b[i];
+        }
+        return x;
+}
+
+static void store_be64(uint8_t b[8], uint64_t x)
+{
+        for (size_t i = 0; i < 8; i++) {
+                b[i] = x >> (56 - 8 * i);
+        }
+}
+
+// the specification loads a block as four big-endian words S0..S3 where bit
+// i of word j is bit j of nibble i, while our kernels keep nibble i in byte
+// i / 2 (low nibble first)
+static void gift_cofb_to_nibbles(uint8_t s[restrict 16], const uint8_t b[restrict 16])
+{
+        memset(s, 0, 16);
+        for (size_t j = 0; j < 4; j++) {
+                const uint32_t w = ((uint32_t)b[4 * j + 0] << 24) | ((uint32_t)b[4 * j + 1] << 16) |
+                                   ((uint32_t)b[4 * j + 2] << 8)  | ((uint32_t)b[4 * j + 3] << 0);
+                for (size_t i = 0; i < 32; i++) {
+                        s[i / 2] |= ((w >> i) & 0x1) << (j + 4 * (i % 2));
+                }
+        }
+}
+
+static void gift_cofb_from_nibbles(uint8_t b[restrict 16], const uint8_t s[restrict 16])
+{
+        for (size_t j = 0; j < 4; j++) {
+                uint32_t w = 0;
+                for (size_t i = 0; i < 32; i++) {
+                        w |= (uint32_t)((s[i / 2] >> (j + 4 * (i % 2))) & 0x1) << i;
+                }
+                b[4 * j + 0] = w >> 24;
+                b[4 * j + 1] = w >> 16;
+                b[4 * j + 2] = w >> 8;
+                b[4 * j + 3] = w >> 0;
+        }
+}
+
+static void gift_cofb_block_encrypt(const struct gift_cofb_ctx *restrict ctx,
+                                    uint8_t y[restrict 16], const uint8_t x[restrict 16])
+{
+        if (ctx->kernel == GIFT_COFB_FIXSLICED) {
+                uint32_t w[4];
+                for (size_t j = 0; j < 4; j++) {
+                        w[j] = ((uint32_t)x[4 * j + 0] << 24) | ((uint32_t)x[4 * j + 1] << 16) |
+                               ((uint32_t)x[4 * j + 2] << 8)  | ((uint32_t)x[4 * j + 3] << 0);
+                }
+                gift_128_fixsliced_encrypt_bits(w, ctx->rks.fixsliced);
+                for (size_t j = 0; j < 4; j++) {
+                        y[4 * j + 0] = w[j] >> 24;
+                        y[4 * j + 1] = w[j] >> 16;
+                        y[4 * j + 2] = w[j] >> 8;
+                        y[4 * j + 3] = w[j] >> 0;
+                }
+                return;
+        }
+
+        uint8_t s[16];
+        gift_cofb_to_nibbles(s, x);
+
+        switch (ctx->kernel) {
+        case GIFT_COFB_NAIVE: {
+                uint8_t c[16];
+                gift_128_encrypt(c, s, ctx->rks.naive);
+                memcpy(s, c, 16);
+                break;
+        }
+        case GIFT_COFB_VEC_SLICED: {
+                // only lane 0 carries data
+                uint8_t m[16][16] = { { 0 } };
+                uint8_t c[16][16];
+                memcpy(m[0], s, 16);
+                gift_128_vec_sliced_encrypt(c, m, ctx->rks.vec_sliced);
+                memcpy(s, c[0], 16);
+                break;
+        }
+        case GIFT_COFB_FIXSLICED:
+                break;
+        }
+
+        gift_cofb_from_nibbles(y, s);
+}
+
+// multiplication by 2 in GF(2^64) mod x^64 + x^4 + x^3 + x + 1
+static uint64_t gift_cofb_double(const uint64_t l)
+{
+        return (l << 1) ^ ((l >> 63) * 0x1b);
+}
+
+static uint64_t gift_cofb_triple(const uint64_t l)
+{
+        return l ^ gift_cofb_double(l);
+}
+
+// X = pad(A) ^ G(Y) ^ (L || 0), G(Y1 || Y2) = Y2 || (Y1 <<< 1)
+static void gift_cofb_feedback(uint8_t x[restrict 16], const uint8_t y[restrict 16],
+                               const uint8_t *restrict a, const size_t n,
+                               const uint64_t l)
+{
+        uint8_t pad[16] = { 0 };
+        memcpy(pad, a, n);
+        if (n < 16) {
+                pad[n] = 0x80;
+        }
+
+        const uint64_t y1 = load_be64(&y[0]);
+        const uint64_t y2 = load_be64(&y[8]);
+        store_be64(&x[0], load_be64(&pad[0]) ^ y2 ^ l);
+        store_be64(&x[8], load_be64(&pad[8]) ^ ((y1 << 1) | (y1 >> 63)));
+}
+
+static void gift_cofb_crypt(const struct gift_cofb_ctx *restrict ctx,
+                            uint8_t *out, uint8_t tag[restrict GIFT_COFB_TAG_BYTES],
+                            const uint8_t *in, size_t len,
+                            const uint8_t *restrict ad, size_t adlen,
+                            const uint8_t nonce[restrict 16], const int encrypt)
+{
+        const int empty_ad = adlen == 0;
+        const int empty_m = len == 0;
+        uint8_t x[16], y[16];
+
+        gift_cofb_block_encrypt(ctx, y, nonce);
+        uint64_t l = load_be64(y);
+
+        // associated data (the last block also absorbs the length cases)
+        while (adlen > 16) {
+                l = gift_cofb_double(l);
+                gift_cofb_feedback(x, y, ad, 16, l);
+                gift_cofb_block_encrypt(ctx, y, x);
+                ad += 16;
+                adlen -= 16;
+        }
+
+        l = gift_cofb_triple(l);
+        if (adlen % 16 != 0 || empty_ad) {
+                l = gift_cofb_triple(l);
+        }
+        if (empty_m) {
+                l = gift_cofb_triple(gift_cofb_triple(l));
+        }
+        gift_cofb_feedback(x, y, ad, adlen, l);
+        gift_cofb_block_encrypt(ctx, y, x);
+
+        // payload, the feedback always uses the plaintext
+        while (len > 0) {
+                const size_t n = len < 16 ? len : 16;
+                uint8_t m[16];
+                for (size_t i = 0; i < n; i++) {
+                        m[i] = encrypt ? in[i] : in[i] ^ y[i];
+                        out[i] = in[i] ^ y[i];
+                }
+
+                if (len > 16) {
+                        l = gift_cofb_double(l);
+                } else {
+                        l = gift_cofb_triple(l);
+                        if (len % 16 != 0) {
+                                l = gift_cofb_triple(l);
+                        }
+                }
+
+                gift_cofb_feedback(x, y, m, n, l);
+                gift_cofb_block_encrypt(ctx, y, x);
+                in += n;
+                out += n;
+                len -= n;
+        }
+
+        memcpy(tag, y, GIFT_COFB_TAG_BYTES);
+}
+
+void gift_cofb_init(struct gift_cofb_ctx *restrict ctx, const uint8_t key[restrict 16],
+                    enum gift_cofb_kernel kernel)
+{
+        // the key is a big-endian 128-bit integer, key[0] holds the low half
+        const uint64_t k[2] = { load_be64(&key[8]), load_be64(&key[0]) };
+
+        ctx->kernel = kernel;
+        switch (kernel) {
+        case GIFT_COFB_NAIVE:
+                gift_128_generate_round_keys(ctx->rks.naive, k);
+                break;
+        case GIFT_COFB_VEC_SLICED:
+                gift_128_vec_sliced_init();
+                gift_128_vec_sliced_generate_round_keys(ctx->rks.vec_sliced, k);
+                break;
+        case GIFT_COFB_FIXSLICED:
+                gift_128_fixsliced_generate_round_keys(ctx->rks.fixsliced, k);
+                break;
+        }
+}
+
+void gift_cofb_encrypt(const struct gift_cofb_ctx *restrict ctx,
+                       uint8_t *c, uint8_t tag[restrict GIFT_COFB_TAG_BYTES],
+                       const uint8_t *m, size_t mlen,
+                       const uint8_t *restrict ad, size_t adlen,
+                       const uint8_t nonce[restrict 16])
+{
+        gift_cofb_crypt(ctx, c, tag, m, mlen, ad, adlen, nonce, 1);
+}
+
+int gift_cofb_decrypt(const struct gift_cofb_ctx *restrict ctx,
+                      uint8_t *m, const uint8_t *c, size_t clen,
+                      const uint8_t *restrict ad, size_t adlen,
+                      const uint8_t nonce[restrict 16],
+                      const uint8_t tag[restrict GIFT_COFB_TAG_BYTES])
+{
+        uint8_t tag_actual[GIFT_COFB_TAG_BYTES];
+        gift_cofb_crypt(ctx, m, tag_actual, c, clen, ad, adlen, nonce, 0);
+
+        // compare in constant time
+        uint8_t diff = 0;
+        for (size_t i = 0; i < GIFT_COFB_TAG_BYTES; i++) {
+                diff |= tag[i] ^ tag_actual[i];
+        }
+
+        if (diff != 0) {
+                memset(m, 0, clen);
+                return -1;
+        }
+        return 0;
+}
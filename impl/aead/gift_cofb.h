@@ -0,0 +1,51 @@
+#pragma once
+
+// GIFT-COFB authenticated encryption (128-bit key, nonce and tag) on top of
+// the GIFT-128 kernels; byte strings follow the GIFT-COFB specification
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../simd.h"
+
+#include "../gift/naive.h"
+#include "../gift/vec_sliced_128.h"
+#include "../gift/fixsliced_128.h"
+
+#define GIFT_COFB_TAG_BYTES 16
+
+// the mode is inherently sequential, so every kernel encrypts a single block
+// per call. vec_sliced leaves 15 of its 16 lanes empty; fixsliced works on the
+// specification's word layout directly and skips the nibble conversion too
+enum gift_cofb_kernel {
+        GIFT_COFB_NAIVE,
+        GIFT_COFB_VEC_SLICED,
+        GIFT_COFB_FIXSLICED,
+        GIFT_COFB_FASTEST = GIFT_COFB_FIXSLICED,
+};
+
+struct gift_cofb_ctx {
+        enum gift_cofb_kernel kernel;
+        union {
+                uint8_t naive[ROUNDS_GIFT_128][32];
+                uint8x16x4_t vec_sliced[ROUNDS_GIFT_128][2];
+                uint32_t fixsliced[ROUNDS_GIFT_128][3];
+        } rks;
+};
+
+// expands the key once for the chosen kernel
+void gift_cofb_init(struct gift_cofb_ctx *restrict ctx, const uint8_t key[restrict 16],
+                    enum gift_cofb_kernel kernel);
+
+// c has room for mlen bytes, the tag is written separately
+void gift_cofb_encrypt(const struct gift_cofb_ctx *restrict ctx,
+                       uint8_t *c, uint8_t tag[restrict GIFT_COFB_TAG_BYTES],
+                       const uint8_t *m, size_t mlen,
+                       const uint8_t *restrict ad, size_t adlen,
+                       const uint8_t nonce[restrict 16]);
+
+// returns 0 if the tag verifies and -1 otherwise (m is cleared in that case)
+int gift_cofb_decrypt(const struct gift_cofb_ctx *restrict ctx,
+                      uint8_t *m, const uint8_t *c, size_t clen,
+                      const uint8_t *restrict ad, size_t adlen,
+                      const uint8_t nonce[restrict 16],
+                      const uint8_t tag[restrict GIFT_COFB_TAG_BYTES]);
@@ -0,0 +1,262 @@
+#include "../simd.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gift_64_differential.h"
+
+#define BATCHES_PER_TILE (GIFT_64_DIFFERENTIAL_TILE_PAIRS / 16)
+#define INITIAL_CAPACITY 1024
+
+struct differential_job {
+        const struct gift_64_differential_config *cfg;
+        uint8x16x4_t rks[ROUNDS_GIFT_64][2];
+        uint8x16x4_t delta[2]; // delta in all 16 blocks, bitsliced
+        uint8x16x4_t mask[2];
+        struct gift_64_differential_hist *hists; // one per worker
+};
+
+static inline size_t slot(const uint64_t diff, const size_t capacity)
+{
+        const uint64_t h = diff * 0x9e3779b97f4a7c15UL;
+        return (h ^ (h >> 32)) & (capacity - 1);
+}
+
+static inline size_t find(const struct gift_64_differential_hist *hist, const uint64_t diff)
+{
+        size_t i = slot(diff, hist->capacity);
+        while (hist->entries[i].count != 0 && hist->entries[i].diff != diff) {
+                i = (i + 1) & (hist->capacity - 1);
+        }
+        return i;
+}
+
+static int grow(struct gift_64_differential_hist *hist)
+{
+        struct gift_64_differential_entry *entries = calloc(2 * hist->capacity, sizeof(*entries));
+        if (entries == NULL) {
+                return -1;
+        }
+
+        struct gift_64_differential_entry *old = hist->entries;
+        const size_t old_capacity = hist->capacity;
+        hist->capacity *= 2;
+        hist->entries = entries;
+        for (size_t i = 0; i < old_capacity; i++) {
+                if (old[i].count != 0) {
+                        hist->entries[find(hist, old[i].diff)] = old[i];
+                }
+        }
+        free(old);
+        return 0;
+}
+
+int gift_64_differential_hist_init(struct gift_64_differential_hist *hist, const size_t max_size)
+{
+        memset(hist, 0, sizeof(*hist));
+        hist->entries = calloc(INITIAL_CAPACITY, sizeof(*hist->entries));
+        if (hist->entries == NULL) {
+                return -1;
+        }
+        hist->capacity = INITIAL_CAPACITY;
+        hist->max_size = max_size;
+        return 0;
+}
+
+void gift_64_differential_hist_free(struct gift_64_differential_hist *hist)
+{
+        free(hist->entries);
+        memset(hist, 0, sizeof(*hist));
+}
+
+void gift_64_differential_hist_add(struct gift_64_differential_hist *restrict hist,
+                                   const uint64_t diff, const uint64_t count)
+{
+        size_t i = find(hist, diff);
+        hist->total += count;
+
+        if (hist->entries[i].count != 0) {
+                hist->entries[i].count += count;
+                return;
+        }
+
+        if (hist->max_size != 0 && hist->size >= hist->max_size) {
+                hist->dropped += count;
+                return;
+        }
+
+        // at most half full; out of memory the table keeps what it has, as if
+        // max_size had been reached
+        if (2 * (hist->size + 1) > hist->capacity) {
+                if (grow(hist) < 0) {
+                        hist->max_size = hist->size;
+                        hist->dropped += count;
+                        return;
+                }
+                i = find(hist, diff);
+        }
+
+        hist->entries[i].diff = diff;
+        hist->entries[i].count = count;
+        hist->size++;
+}
+
+uint64_t gift_64_differential_hist_get(const struct gift_64_differential_hist *hist,
+                                       const uint64_t diff)
+{
+        return hist->entries[find(hist, diff)].count;
+}
+
+static inline int before(const struct gift_64_differential_entry *a,
+                         const struct gift_64_differential_entry *b)
+{
+        return a->count > b->count || (a->count == b->count && a->diff < b->diff);
+}
+
+size_t gift_64_differential_hist_top(const struct gift_64_differential_hist *hist,
+                                     struct gift_64_differential_entry *top, const size_t k)
+{
+        if (k == 0) {
+                return 0;
+        }
+
+        // insertion into a sorted array of k, almost every entry loses against
+        // the last one
+        size_t n = 0;
+        for (size_t i = 0; i < hist->capacity; i++) {
+                const struct gift_64_differential_entry *e = &hist->entries[i];
+                if (e->count == 0 || (n == k && !before(e, &top[k - 1]))) {
+                        continue;
+                }
+
+                size_t j = n < k ? n++ : k - 1;
+                for (; j > 0 && before(e, &top[j - 1]); j--) {
+                        top[j] = top[j - 1];
+                }
+                top[j] = *e;
+        }
+
+        return n;
+}
+
+static inline uint64_t splitmix64(uint64_t *state)
+{
+        uint64_t z = (*state += 0x9e3779b97f4a7c15UL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9UL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebUL;
+        return z ^ (z >> 31);
+}
+
+static void tile(void *arg, const int worker, const size_t t)
+{
+        const struct differential_job *job = arg;
+        struct gift_64_differential_hist *hist = &job->hists[worker];
+
+        uint64_t rng = job->cfg->seed ^ (t * 0xd1b54a32d192ed03UL);
+        rng = splitmix64(&rng);
+
+        for (size_t batch = 0; batch < BATCHES_PER_TILE; batch++) {
+                // random words are as good as packed random plaintexts, the
+                // bit packing is a bijection on 16-block batches
+                uint64_t words[16];
+                for (size_t i = 0; i < 16; i++) {
+                        words[i] = splitmix64(&rng);
+                }
+
+                uint8x16x4_t s[2], s_pair[2];
+                s[0] = vld1q_u8_x4((const uint8_t*)&words[0]);
+                s[1] = vld1q_u8_x4((const uint8_t*)&words[8]);
+                for (size_t i = 0; i < 8; i++) {
+                        s_pair[i / 4].val[i % 4] = veorq_u8(s[i / 4].val[i % 4],
+                                                            job->delta[i / 4].val[i % 4]);
+                }
+
+                gift_64_vec_sliced_rounds_range(s, job->rks, 0, job->cfg->rounds);
+                gift_64_vec_sliced_rounds_range(s_pair, job->rks, 0, job->cfg->rounds);
+
+                // output differences
+                for (size_t i = 0; i < 8; i++) {
+                        s[i / 4].val[i % 4] = vandq_u8(veorq_u8(s[i / 4].val[i % 4],
+                                                                s_pair[i / 4].val[i % 4]),
+                                                       job->mask[i / 4].val[i % 4]);
+                }
+
+                gift_64_vec_sliced_bits_unpack(s);
+                uint64_t diffs[16];
+                vst1q_u8_x4((uint8_t*)&diffs[0], s[0]);
+                vst1q_u8_x4((uint8_t*)&diffs[8], s[1]);
+
+                // runs of one difference (likely with few rounds or a narrow
+                // mask) take a single lookup
+                size_t run = 1;
+                for (size_t i = 1; i <= 16; i++) {
+                        if (i < 16 && diffs[i] == diffs[i - 1]) {
+                                run++;
+                                continue;
+                        }
+                        gift_64_differential_hist_add(hist, diffs[i - 1], run);
+                        run = 1;
+                }
+        }
+}
+
+// the same 64-bit word in all 16 blocks
+static void pack_broadcast(uint8x16x4_t s[restrict 2], const uint64_t x)
+{
+        uint64_t words[16];
+        for (size_t i = 0; i < 16; i++) {
+                words[i] = x;
+        }
+
+        s[0] = vld1q_u8_x4((const uint8_t*)&words[0]);
+        s[1] = vld1q_u8_x4((const uint8_t*)&words[8]);
+        gift_64_vec_sliced_bits_pack(s);
+}
+
+int gift_64_differential_run(struct parallel_pool *pool,
+                             const struct gift_64_differential_config *cfg,
+                             struct gift_64_differential_hist *hist)
+{
+        const int nthreads = parallel_pool_threads(pool);
+
+        struct differential_job job = { .cfg = cfg };
+        gift_64_vec_sliced_generate_round_keys(job.rks, cfg->key);
+        pack_broadcast(job.delta, cfg->delta);
+        pack_broadcast(job.mask, cfg->mask);
+
+        memset(hist, 0, sizeof(*hist));
+        job.hists = calloc(nthreads, sizeof(*job.hists));
+        int failed = job.hists == NULL || gift_64_differential_hist_init(hist, cfg->max_entries) < 0;
+        for (int i = 0; i < nthreads && !failed; i++) {
+                failed = gift_64_differential_hist_init(&job.hists[i], cfg->max_entries) < 0;
+        }
+        if (failed) {
+                // hist_free takes the zeroed entries of calloc and failed inits
+                for (int i = 0; job.hists != NULL && i < nthreads; i++) {
+                        gift_64_differential_hist_free(&job.hists[i]);
+                }
+                free(job.hists);
+                gift_64_differential_hist_free(hist);
+                return -1;
+        }
+
+        const size_t ntiles = (cfg->pairs + GIFT_64_DIFFERENTIAL_TILE_PAIRS - 1) /
+                              GIFT_64_DIFFERENTIAL_TILE_PAIRS;
+        parallel_for(pool, ntiles, tile, &job);
+
+        for (int i = 0; i < nthreads; i++) {
+                const struct gift_64_differential_hist *h = &job.hists[i];
+                for (size_t j = 0; j < h->capacity; j++) {
+                        if (h->entries[j].count != 0) {
+                                gift_64_differential_hist_add(hist, h->entries[j].diff,
+                                                              h->entries[j].count);
+                        }
+                }
+                hist->total += h->dropped;
+                hist->dropped += h->dropped;
+                gift_64_differential_hist_free(&job.hists[i]);
+        }
+        free(job.hists);
+        return 0;
+}
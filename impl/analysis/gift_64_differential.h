@@ -0,0 +1,63 @@
+#pragma once
+
+// differential experiments on reduced-round GIFT-64: random pairs
+// (P, P ^ delta) are built in the bitsliced layout of gift_64_vec_sliced.c,
+// both halves go through the round loop, the outputs are XORed in registers
+// and the differences are counted per thread, then merged
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../gift/vec_sliced.h"
+#include "../modes/parallel.h"
+
+// pairs per parallel_for tile (256 batches of 16)
+#define GIFT_64_DIFFERENTIAL_TILE_PAIRS 4096
+
+struct gift_64_differential_entry {
+        uint64_t diff;
+        uint64_t count; // 0 marks an empty slot
+};
+
+// open addressing with linear probing; once max_size differences are held
+// new ones are only counted in dropped (a full-round experiment produces
+// about as many differences as pairs)
+struct gift_64_differential_hist {
+        struct gift_64_differential_entry *entries;
+        size_t capacity; // power of two
+        size_t size;
+        size_t max_size;
+        uint64_t total;
+        uint64_t dropped;
+};
+
+struct gift_64_differential_config {
+        uint64_t delta;     // input difference
+        uint64_t mask;      // output differences are counted as diff & mask
+        int rounds;         // 1 to ROUNDS_GIFT_64
+        uint64_t key[2];
+        uint64_t seed;      // the plaintexts of tile t depend on seed and t only
+        uint64_t pairs;     // rounded up to whole tiles
+        size_t max_entries; // per thread and for the merged histogram, 0 for no limit
+};
+
+// max_size 0 for no limit; -1 if out of memory. a table that cannot grow any
+// further counts new differences in dropped
+int gift_64_differential_hist_init(struct gift_64_differential_hist *hist, size_t max_size);
+void gift_64_differential_hist_free(struct gift_64_differential_hist *hist);
+void gift_64_differential_hist_add(struct gift_64_differential_hist *restrict hist,
+                                   uint64_t diff, uint64_t count);
+uint64_t gift_64_differential_hist_get(const struct gift_64_differential_hist *hist,
+                                       uint64_t diff);
+
+// the k most frequent differences, most frequent first (ties by difference);
+// returns how many were written
+size_t gift_64_differential_hist_top(const struct gift_64_differential_hist *hist,
+                                     struct gift_64_differential_entry *top, size_t k);
+
+// needs gift_64_vec_sliced_init; hist is initialised here, the counts do not
+// depend on the number of threads unless differences were dropped. returns -1
+// (with nothing to free) if the tables cannot be allocated
+int gift_64_differential_run(struct parallel_pool *pool,
+                             const struct gift_64_differential_config *cfg,
+                             struct gift_64_differential_hist *hist);
@@ -0,0 +1,365 @@
+#include "../simd.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sbox_tables.h"
+
+// same table as gift/naive.c
+static const uint8_t gift_sbox[16] = {
+        0x1, 0xa, 0x4, 0xc, 0x6, 0xf, 0x3, 0x9,
+        0x2, 0xd, 0xb, 0x7, 0x5, 0x0, 0x8, 0xe
+};
+
+// same table as camellia/naive.c, s2 to s4 are rotations of it
+static const uint8_t camellia_s1[256] =
+{
+        0x70, 0x82, 0x2c, 0xec, 0xb3, 0x27, 0xc0, 0xe5,
+        0xe4, 0x85, 0x57, 0x35, 0xea, 0x0c, 0xae, 0x41,
+        0x23, 0xef, 0x6b, 0x93, 0x45, 0x19, 0xa5, 0x21,
+        0xed, 0x0e, 0x4f, 0x4e, 0x1d, 0x65, 0x92, 0xbd,
+        0x86, 0xb8, 0xaf, 0x8f, 0x7c, 0xeb, 0x1f, 0xce,
+        0x3e, 0x30, 0xdc, 0x5f, 0x5e, 0xc5, 0x0b, 0x1a,
+        0xa6, 0xe1, 0x39, 0xca, 0xd5, 0x47, 0x5d, 0x3d,
+        0xd9, 0x01, 0x5a, 0xd6, 0x51, 0x56, 0x6c, 0x4d,
+        0x8b, 0x0d, 0x9a, 0x66, 0xfb, 0xcc, 0xb0, 0x2d,
+        0x74, 0x12, 0x2b, 0x20, 0xf0, 0xb1, 0x84, 0x99,
+        0xdf, 0x4c, 0xcb, 0xc2, 0x34, 0x7e, 0x76, 0x05,
+        0x6d, 0xb7, 0xa9, 0x31, 0xd1, 0x17, 0x04, 0xd7,
+        0x14, 0x58, 0x3a, 0x61, 0xde, 0x1b, 0x11, 0x1c,
+        0x32, 0x0f, 0x9c, 0x16, 0x53, 0x18, 0xf2, 0x22,
+        0xfe, 0x44, 0xcf, 0xb2, 0xc3, 0xb5, 0x7a, 0x91,
+        0x24, 0x08, 0xe8, 0xa8, 0x60, 0xfc, 0x69, 0x50,
+        0xaa, 0xd0, 0xa0, 0x7d, 0xa1, 0x89, 0x62, 0x97,
+        0x54, 0x5b, 0x1e, 0x95, 0xe0, 0xff, 0x64, 0xd2,
+        0x10, 0xc4, 0x00, 0x48, 0xa3, 0xf7, 0x75, 0xdb,
+        0x8a, 0x03, 0xe6, 0xda, 0x09, 0x3f, 0xdd, 0x94,
+        0x87, 0x5c, 0x83, 0x02, 0xcd, 0x4a, 0x90, 0x33,
+        0x73, 0x67, 0xf6, 0xf3, 0x9d, 0x7f, 0xbf, 0xe2,
+        0x52, 0x9b, 0xd8, 0x26, 0xc8, 0x37, 0xc6, 0x3b,
+        0x81, 0x96, 0x6f, 0x4b, 0x13, 0xbe, 0x63, 0x2e,
+        0xe9, 0x79, 0xa7, 0x8c, 0x9f, 0x6e, 0xbc, 0x8e,
+        0x29, 0xf5, 0xf9, 0xb6, 0x2f, 0xfd, 0xb4, 0x59,
+        0x78, 0x98, 0x06, 0x6a, 0xe7, 0x46, 0x71, 0xba,
+        0xd4, 0x25, 0xab, 0x42, 0x88, 0xa2, 0x8d, 0xfa,
+        0x72, 0x07, 0xb9, 0x55, 0xf8, 0xee, 0xac, 0x0a,
+        0x36, 0x49, 0x2a, 0x68, 0x3c, 0x38, 0xf1, 0xa4,
+        0x40, 0x28, 0xd3, 0x7b, 0xbb, 0xc9, 0x43, 0xc1,
+        0x15, 0xe3, 0xad, 0xf4, 0x77, 0xc7, 0x80, 0x9e
+};
+
+
+static const uint8_t parity_4[16] = {
+        0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0
+};
+
+static const uint8_t iota[16] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+};
+
+#define MAX_CHUNKS (256 / 16)
+
+static inline uint8x16_t lookup(const uint8x16x4_t t[4], const int bits, const uint8x16_t x)
+{
+        if (bits == 4) {
+                return vqtbl1q_u8(t[0].val[0], x);
+        }
+
+        // tbl4 yields 0 past index 63, so every quarter only hits its own inputs
+        uint8x16_t y = vqtbl4q_u8(t[0], x);
+        y = vorrq_u8(y, vqtbl4q_u8(t[1], veorq_u8(x, vdupq_n_u8(0x40))));
+        y = vorrq_u8(y, vqtbl4q_u8(t[2], veorq_u8(x, vdupq_n_u8(0x80))));
+        y = vorrq_u8(y, vqtbl4q_u8(t[3], veorq_u8(x, vdupq_n_u8(0xc0))));
+        return y;
+}
+
+static inline uint8x16_t parity(const uint8x16_t par, const int bits, const uint8x16_t v)
+{
+        if (bits == 4) {
+                return vqtbl1q_u8(par, v);
+        }
+
+        return veorq_u8(vqtbl1q_u8(par, vandq_u8(v, vdupq_n_u8(0x0f))),
+                        vqtbl1q_u8(par, vshrq_n_u8(v, 4)));
+}
+
+// inputs 16c to 16c + 15 in xs[c] and their images in ys[c]
+static inline void inputs(uint8x16_t xs[MAX_CHUNKS], uint8x16_t ys[MAX_CHUNKS],
+                          const struct sbox_vec *s, const int bits)
+{
+        const uint8x16_t base = vld1q_u8(iota);
+        for (int c = 0; c < (1 << bits) / 16; c++) {
+                xs[c] = vaddq_u8(base, vdupq_n_u8(16 * c));
+                ys[c] = lookup(s->t, bits, xs[c]);
+        }
+}
+
+int sbox_vec_init(struct sbox_vec *restrict s, const uint8_t *sbox, const int bits)
+{
+        if (bits != 4 && bits != 8) {
+                return -1;
+        }
+
+        const int n = 1 << bits;
+        uint8_t table[256] = { 0 }, table_inv[256] = { 0 }, seen[256] = { 0 };
+        s->bits = bits;
+        s->bijective = 1;
+        for (int x = 0; x < n; x++) {
+                if (sbox[x] >= n) {
+                        return -1;
+                }
+                s->bijective &= !seen[sbox[x]];
+                seen[sbox[x]] = 1;
+                table[x] = sbox[x];
+                table_inv[sbox[x]] = x;
+        }
+
+        for (int k = 0; k < 4; k++) {
+                s->t[k] = vld1q_u8_x4(&table[64 * k]);
+                s->t_inv[k] = vld1q_u8_x4(&table_inv[64 * k]);
+        }
+        return 0;
+}
+
+// f(x ^ a) for inputs 16c to 16c + 15, given f in fs[]: x ^ a swaps chunks
+// by a >> 4 and lanes by a & 15, so a single tbl instead of evaluating f
+static inline uint8x16_t shifted(const uint8x16_t fs[], const uint8x16_t lanes,
+                                 const int a, const int c)
+{
+        return vqtbl1q_u8(fs[c ^ (a >> 4)], lanes);
+}
+
+static inline uint8x16_t lanes_for(const int a)
+{
+        return veorq_u8(vld1q_u8(iota), vdupq_n_u8(a & 15));
+}
+
+static inline void ddt(uint16_t *restrict table, const struct sbox_vec *s, const int bits)
+{
+        const int n = 1 << bits;
+        uint8x16_t xs[MAX_CHUNKS], ys[MAX_CHUNKS];
+        inputs(xs, ys, s, bits);
+
+        memset(table, 0, n * n * sizeof(*table));
+        for (int a = 0; a < n; a++) {
+                const uint8x16_t lanes = lanes_for(a);
+                uint16_t *row = &table[a * n];
+                for (int c = 0; c < n / 16; c++) {
+                        uint8_t d[16];
+                        vst1q_u8(d, veorq_u8(ys[c], shifted(ys, lanes, a, c)));
+                        for (int i = 0; i < 16; i++) {
+                                row[d[i]]++;
+                        }
+                }
+        }
+}
+
+static inline void lat(int16_t *restrict table, const struct sbox_vec *s, const int bits)
+{
+        const int n = 1 << bits;
+        const int chunks = n / 16;
+        const uint8x16_t par = vld1q_u8(parity_4);
+        uint8x16_t xs[MAX_CHUNKS], ys[MAX_CHUNKS];
+        inputs(xs, ys, s, bits);
+
+        // a.x and b.S(x) for every mask, then one eor and add per 16 inputs;
+        // n <= 256 bounds the scratch (128 KiB), so it stays on the stack
+        uint8x16_t px[256 * MAX_CHUNKS], py[256 * MAX_CHUNKS];
+        for (int a = 0; a < n; a++) {
+                const uint8x16_t va = vdupq_n_u8(a);
+                for (int c = 0; c < chunks; c++) {
+                        px[a * chunks + c] = parity(par, bits, vandq_u8(xs[c], va));
+                        py[a * chunks + c] = parity(par, bits, vandq_u8(ys[c], va));
+                }
+        }
+
+        for (int a = 0; a < n; a++) {
+                for (int b = 0; b < n; b++) {
+                        uint8x16_t odd = vdupq_n_u8(0);
+                        for (int c = 0; c < chunks; c++) {
+                                odd = vaddq_u8(odd, veorq_u8(px[a * chunks + c], py[b * chunks + c]));
+                        }
+                        table[a * n + b] = n / 2 - vaddlvq_u8(odd);
+                }
+        }
+}
+
+static inline void bct(uint16_t *restrict table, const struct sbox_vec *s, const int bits)
+{
+        const int n = 1 << bits;
+        const int chunks = n / 16;
+        uint8x16_t xs[MAX_CHUNKS], ys[MAX_CHUNKS];
+        inputs(xs, ys, s, bits);
+
+        // S^-1(S(x) ^ b) for every b, S^-1(S(x ^ a) ^ b) is a shifted copy
+        uint8x16_t u[256 * MAX_CHUNKS];
+        for (int b = 0; b < n; b++) {
+                const uint8x16_t vb = vdupq_n_u8(b);
+                for (int c = 0; c < chunks; c++) {
+                        u[b * chunks + c] = lookup(s->t_inv, bits, veorq_u8(ys[c], vb));
+                }
+        }
+
+        for (int a = 0; a < n; a++) {
+                const uint8x16_t va = vdupq_n_u8(a);
+                const uint8x16_t lanes = lanes_for(a);
+                for (int b = 0; b < n; b++) {
+                        const uint8x16_t *ub = &u[b * chunks];
+                        uint8x16_t count = vdupq_n_u8(0);
+                        for (int c = 0; c < chunks; c++) {
+                                const uint8x16_t z = veorq_u8(ub[c], shifted(ub, lanes, a, c));
+                                count = vsubq_u8(count, vceqq_u8(z, va));
+                        }
+                        table[a * n + b] = vaddlvq_u8(count);
+                }
+        }
+}
+
+static inline void dlct(int16_t *restrict table, const struct sbox_vec *s, const int bits)
+{
+        const int n = 1 << bits;
+        const uint8x16_t par = vld1q_u8(parity_4);
+        uint8x16_t xs[MAX_CHUNKS], ys[MAX_CHUNKS], lo[MAX_CHUNKS], hi[MAX_CHUNKS];
+        inputs(xs, ys, s, bits);
+
+        // b.d = m_lo.d_lo ^ m_hi.d_hi with masks[m][d] = m.d for nibbles, so
+        // the nibbles of d are split once per a instead of once per (a, b)
+        uint8x16_t masks[16];
+        for (int m = 0; m < 16; m++) {
+                masks[m] = vqtbl1q_u8(par, vandq_u8(vld1q_u8(iota), vdupq_n_u8(m)));
+        }
+
+        for (int a = 0; a < n; a++) {
+                const uint8x16_t lanes = lanes_for(a);
+                for (int c = 0; c < n / 16; c++) {
+                        const uint8x16_t d = veorq_u8(ys[c], shifted(ys, lanes, a, c));
+                        lo[c] = vandq_u8(d, vdupq_n_u8(0x0f));
+                        hi[c] = vshrq_n_u8(d, 4);
+                }
+
+                for (int b = 0; b < n; b++) {
+                        const uint8x16_t m_lo = masks[b & 15], m_hi = masks[b >> 4];
+                        uint8x16_t odd = vdupq_n_u8(0);
+                        for (int c = 0; c < n / 16; c++) {
+                                odd = vaddq_u8(odd, veorq_u8(vqtbl1q_u8(m_lo, lo[c]),
+                                                             vqtbl1q_u8(m_hi, hi[c])));
+                        }
+                        table[a * n + b] = n / 2 - vaddlvq_u8(odd);
+                }
+        }
+}
+
+// the inner loops are specialised for both widths
+void sbox_ddt(uint16_t *table, const struct sbox_vec *s)
+{
+        if (s->bits == 4) {
+                ddt(table, s, 4);
+        } else {
+                ddt(table, s, 8);
+        }
+}
+
+void sbox_lat(int16_t *table, const struct sbox_vec *s)
+{
+        if (s->bits == 4) {
+                lat(table, s, 4);
+        } else {
+                lat(table, s, 8);
+        }
+}
+
+int sbox_bct(uint16_t *table, const struct sbox_vec *s)
+{
+        if (!s->bijective) {
+                return -1;
+        }
+
+        if (s->bits == 4) {
+                bct(table, s, 4);
+        } else {
+                bct(table, s, 8);
+        }
+        return 0;
+}
+
+void sbox_dlct(int16_t *table, const struct sbox_vec *s)
+{
+        if (s->bits == 4) {
+                dlct(table, s, 4);
+        } else {
+                dlct(table, s, 8);
+        }
+}
+
+int sbox_properties(struct sbox_props *props, const struct sbox_vec *s)
+{
+        const int n = 1 << s->bits;
+        uint16_t *counts = malloc(n * n * sizeof(*counts));
+        int16_t *biases = malloc(n * n * sizeof(*biases));
+        memset(props, 0, sizeof(*props));
+        if (counts == NULL || biases == NULL) {
+                free(counts);
+                free(biases);
+                return -1;
+        }
+
+        sbox_ddt(counts, s);
+        for (int i = n; i < n * n; i++) {
+                if (counts[i] > props->differential_uniformity) {
+                        props->differential_uniformity = counts[i];
+                }
+        }
+
+        if (sbox_bct(counts, s) == 0) {
+                for (int i = n; i < n * n; i++) {
+                        if (i % n != 0 && counts[i] > props->boomerang_uniformity) {
+                                props->boomerang_uniformity = counts[i];
+                        }
+                }
+        }
+
+        sbox_lat(biases, s);
+        for (int i = 0; i < n * n; i++) {
+                if (i % n != 0 && abs(biases[i]) > props->linearity) {
+                        props->linearity = abs(biases[i]);
+                }
+        }
+
+        sbox_dlct(biases, s);
+        for (int i = n; i < n * n; i++) {
+                if (i % n != 0 && abs(biases[i]) > props->dlct_max) {
+                        props->dlct_max = abs(biases[i]);
+                }
+        }
+
+        free(counts);
+        free(biases);
+        return 0;
+}
+
+void sbox_gift(uint8_t sbox[16])
+{
+        memcpy(sbox, gift_sbox, sizeof(gift_sbox));
+}
+
+void sbox_camellia(uint8_t sbox[256], const int i)
+{
+        for (int x = 0; x < 256; x++) {
+                const uint8_t y = camellia_s1[x];
+                switch (i) {
+                case 1:
+                        sbox[x] = y;
+                        break;
+                case 2:
+                        sbox[x] = (y << 1) | (y >> 7);
+                        break;
+                case 3:
+                        sbox[x] = (y << 7) | (y >> 1);
+                        break;
+                default:
+                        sbox[x] = camellia_s1[((x << 1) | (x >> 7)) & 0xff];
+                        break;
+                }
+        }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+// DDT, LAT, BCT and DLCT of 4-bit and 8-bit S-boxes. the S-box is evaluated
+// 16 inputs at a time with tbl (one register for 4 bits, four tbl4 lookups
+// for 8 bits), the counts are accumulated per lane and summed at the end of a
+// row entry; tables are n * n with n = 1 << bits, row-major by input mask or
+// difference
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../simd.h"
+
+// an S-box (and its inverse, if it is a permutation) as tbl operands; 4-bit
+// S-boxes only use t[0].val[0]
+struct sbox_vec {
+        int bits;
+        int bijective;
+        uint8x16x4_t t[4];
+        uint8x16x4_t t_inv[4];
+};
+
+struct sbox_props {
+        int differential_uniformity; // max DDT[a][b], a != 0
+        int linearity;               // max |LAT[a][b]|, b != 0
+        int boomerang_uniformity;    // max BCT[a][b], a, b != 0 (0 if not bijective)
+        int dlct_max;                // max |DLCT[a][b]|, a, b != 0
+};
+
+// bits is 4 or 8 and every entry below 1 << bits, -1 otherwise
+int sbox_vec_init(struct sbox_vec *restrict s, const uint8_t *sbox, int bits);
+
+// DDT[a][b] = #{ x : S(x) ^ S(x ^ a) = b }
+void sbox_ddt(uint16_t *ddt, const struct sbox_vec *s);
+// LAT[a][b] = #{ x : a.x = b.S(x) } - n / 2
+void sbox_lat(int16_t *lat, const struct sbox_vec *s);
+// BCT[a][b] = #{ x : S^-1(S(x) ^ b) ^ S^-1(S(x ^ a) ^ b) = a }, -1 if S is not
+// a permutation
+int sbox_bct(uint16_t *bct, const struct sbox_vec *s);
+// DLCT[a][b] = #{ x : b.(S(x) ^ S(x ^ a)) = 0 } - n / 2
+void sbox_dlct(int16_t *dlct, const struct sbox_vec *s);
+
+// all four tables into scratch space of its own; -1 if that cannot be
+// allocated
+int sbox_properties(struct sbox_props *props, const struct sbox_vec *s);
+
+// the S-boxes of the ciphers in this tree; camellia is s1 to s4 of the
+// specification (i = 1 to 4)
+void sbox_gift(uint8_t sbox[16]);
+void sbox_camellia(uint8_t sbox[256], int i);
@@ -1,43 +1,95 @@
-#pragma clang optimize off
+#define _GNU_SOURCE // sched_setaffinity()
 
 #include "gift/naive.h"
+#include "gift/fixsliced_128.h"
 #include "gift/sliced.h"
 #include "gift/table.h"
 #include "gift/vec_sbox.h"
 #include "gift/vec_sliced.h"
+#include "gift/vec_sliced_128.h"
+#include "gift/vec_sliced_avx2.h"
+#include "gift/vec_sliced_sve.h"
+#include "gift/vec_sliced_sha3.h"
 
 #include "camellia/naive.h"
 #include "camellia/spec_opt.h"
 #include "camellia/bytesliced.h"
+#include "camellia/bytesliced_avx2.h"
+#include "camellia/bytesliced_sve.h"
+#include "camellia/bytesliced_sha3.h"
+
+#include "modes/gift_64_ctr.h"
+#include "modes/cbc.h"
+#include "modes/camellia_xts.h"
+#include "modes/parallel.h"
+
+#include "aead/gift_cofb.h"
+#include "aead/camellia_gcm.h"
+
+#include "dispatch/cpu.h"
+#include "dispatch/dispatch.h"
+
+#include "gift_neon.h"
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <time.h>
-#include <sys/time.h> // wall time via gettimeofday()
 #include <string.h>
+#include <time.h>
+#include <getopt.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
 
 #include <stdint.h>
-#include <arm_neon.h>
+#include "simd.h"
 
-#define NL 10000 // latency measurement count
-#define NT 1000000 // throughput measurement count
+// usage: ./benchmark [options], see usage() below
+//
+// every benchmark is a kernel run over a message of --size bytes. after a
+// warm-up (which also calibrates how many messages make up one sample) --reps
+// samples are taken and min/p5/median/p95 per byte (or per block with
+// --per-block) are reported, in ns (clock_gettime) or cycles
+// (perf_event_open). --format csv is what scripts/plots reads
 
-#define MEASURE(code)\
-        {\
-        uint64_t t0, t1;\
-        asm volatile("mrs %[c], PMCCNTR_EL0" : [c] "=r"(t0));\
-        code;\
-        asm volatile("mrs %[c], PMCCNTR_EL0" : [c] "=r"(t1));\
-        printf(#code ": took %ld cycles\n", t1 - t0);\
-        }
+#define DEFAULT_SIZES "64,1024,4096,65536"
+#define DEFAULT_REPS 31
+#define DEFAULT_WARMUP_MS 100
+#define DEFAULT_SAMPLE_MS 10
+#define DEFAULT_SEED 1
 
-#define TIME(code)({\
-        uint64_t t0, t1;\
-        asm volatile("mrs %[c], PMCCNTR_EL0" : [c] "=r"(t0));\
-        code;\
-        asm volatile("mrs %[c], PMCCNTR_EL0" : [c] "=r"(t1));\
-        t1 - t0;\
-        })
+enum timer { TIMER_CLOCK, TIMER_PERF };
+enum format { FORMAT_TEXT, FORMAT_CSV, FORMAT_JSON };
+
+struct bench {
+        const char *cipher;
+        const char *kernel;
+        // bytes per kernel call, message sizes are rounded up to a multiple
+        size_t granule;
+        // runs on a parallel_pool, measured once per --threads entry
+        int threaded;
+        int (*available)(void);
+        void (*setup)(void);
+        void (*run)(uint8_t *restrict out, const uint8_t *restrict in, size_t len);
+};
+
+struct stats {
+        size_t iters; // messages per sample
+        double min, p5, median, p95;
+        double mib_s;
+};
+
+// keys and contexts shared by all benchmarks, filled from --seed
+static uint64_t key[2];
+static uint64_t key_256[4];
+static uint8_t key_bytes[16];
+static uint8_t nonce[16];
+static uint8_t ad[16];
+
+static int bench_threads = 1;
+static struct parallel_pool *pool;
+
+static int perf_fd = -1;
 
 static void rand_bytes(uint8_t m[], size_t n)
 {
@@ -46,340 +98,1381 @@ static void rand_bytes(uint8_t m[], size_t n)
         }
 }
 
-static double elapsed_seconds(const struct timeval *st, const struct timeval *et)
+// keeps the compiler from dropping or hoisting the kernel calls
+static inline void clobber(void *p)
 {
-        return (et->tv_sec - st->tv_sec) + (et->tv_usec - st->tv_usec) / 1000000.0;
+        asm volatile("" : : "r"(p) : "memory");
 }
 
-static void benchmark_gift_64(void)
+static uint64_t now_ns(void)
 {
-        printf("benchmarking GIFT_64...\n");
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000UL + ts.tv_nsec;
+}
 
-        uint64_t key[2];
-        uint64_t m;
-        uint64_t round_keys[ROUNDS_GIFT_64];
+// user space cycles of the calling thread, works without the kernel module
+// that PMCCNTR_EL0 needs (but see /proc/sys/kernel/perf_event_paranoid)
+static int perf_open(void)
+{
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        perf_fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        return perf_fd;
+}
 
-        uint64_t cycles[4] = { 0UL };
-        for (int i = 0; i < NL; i++) {
-                cycles[0] += TIME(gift_64_generate_round_keys(round_keys, key));
-                cycles[1] += TIME(gift_64_subcells(m));
-                cycles[2] += TIME(gift_64_permute(m));
-                cycles[3] += TIME(gift_64_encrypt(m, round_keys));
+static uint64_t perf_cycles(void)
+{
+        uint64_t cycles = 0;
+        if (read(perf_fd, &cycles, sizeof(cycles)) != sizeof(cycles)) {
+                return 0;
         }
+        return cycles;
+}
+
+static int have_avx2(void)
+{
+        return cpu_features()->avx2;
+}
 
-        printf("%f %f %f %f\n",
-               cycles[0] / ((float)NL * 8.0f),
-               cycles[1] / ((float)NL * 8.0f),
-               cycles[2] / ((float)NL * 8.0f),
-               cycles[3] / ((float)NL * 8.0f));
+#ifdef __ARM_FEATURE_SHA3
+static int have_sha3(void)
+{
+        return cpu_features()->sha3;
+}
+#endif
 
-        struct timeval st, et;
-        gettimeofday(&st, NULL);
-        for (int i = 0; i < NT; i++) {
-                gift_64_encrypt(m, round_keys);
+#ifdef __ARM_FEATURE_SVE
+static int have_sve(void)
+{
+        return cpu_features()->sve;
+}
+
+static int have_sve2_aes(void)
+{
+        return cpu_features()->sve2_aes;
+}
+#endif
+
+/* GIFT-64 */
+
+static uint64_t gift_64_rks[ROUNDS_GIFT_64];
+static uint64_t gift_64_table_rks[ROUNDS_GIFT_64];
+static uint64_t gift_64_table_rks_inv[ROUNDS_GIFT_64];
+static uint8x16_t gift_64_vec_sbox_rks[ROUNDS_GIFT_64];
+static uint8x16x4_t gift_64_vec_sliced_rks[ROUNDS_GIFT_64][2];
+static struct gift_64_ctr_ctx gift_64_ctr;
+static struct gift_64_cbc_ctx gift_64_cbc;
+static struct gift_64_ctx gift_64_dispatch;
+
+static void setup_gift_64_naive(void)
+{
+        gift_64_generate_round_keys(gift_64_rks, key);
+}
+
+static void run_gift_64_naive(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i++) {
+                c[i] = gift_64_encrypt(m[i], gift_64_rks);
         }
-        gettimeofday(&et, NULL);
-        double seconds = elapsed_seconds(&st, &et);
-        double megs = NT * sizeof(m) / (1024 * 1024);
-        printf("throughput: %f MiB/s\n", megs / seconds);
 }
 
-static void benchmark_gift_128(void)
+static void run_gift_64_naive_decrypt(uint8_t *restrict out, const uint8_t *restrict in,
+                                      size_t len)
 {
-        printf("benchmarking GIFT_128...\n");
+        uint64_t *m = (uint64_t*)out;
+        const uint64_t *c = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i++) {
+                m[i] = gift_64_decrypt(c[i], gift_64_rks);
+        }
+}
 
-        uint64_t key[2];
-        uint8_t m[16], c[16];
-        uint8_t round_keys[ROUNDS_GIFT_128][32];
+static void setup_gift_64_table(void)
+{
+        gift_64_table_generate_round_keys(gift_64_table_rks, key);
+        gift_64_table_generate_round_keys_inv(gift_64_table_rks_inv, key);
+}
 
-        uint64_t cycles[4] = { 0UL };
-        for (int i = 0; i < NL; i++) {
-                cycles[0] += TIME(gift_128_generate_round_keys(round_keys, key));
-                cycles[1] += TIME(gift_128_subcells(m));
-                cycles[2] += TIME(gift_128_permute(m));
-                cycles[3] += TIME(gift_128_encrypt(c, m, round_keys));
+// "table" is whichever mode the build selected, the other two run both
+// table sizes from one binary
+static inline void table_blocks(uint8_t *restrict out, const uint8_t *restrict in, size_t len,
+                                uint64_t (*block)(const uint64_t, const uint64_t *restrict),
+                                const uint64_t *restrict rks)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i++) {
+                c[i] = block(m[i], rks);
         }
+}
+
+static void run_gift_64_table(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        table_blocks(out, in, len, gift_64_table_encrypt, gift_64_table_rks);
+}
+
+static void run_gift_64_table_nibbles(uint8_t *restrict out, const uint8_t *restrict in,
+                                      size_t len)
+{
+        table_blocks(out, in, len, gift_64_table_encrypt_nibbles, gift_64_table_rks);
+}
+
+static void run_gift_64_table_bytes(uint8_t *restrict out, const uint8_t *restrict in,
+                                    size_t len)
+{
+        table_blocks(out, in, len, gift_64_table_encrypt_bytes, gift_64_table_rks);
+}
+
+static void run_gift_64_table_decrypt(uint8_t *restrict out, const uint8_t *restrict in,
+                                      size_t len)
+{
+        table_blocks(out, in, len, gift_64_table_decrypt, gift_64_table_rks_inv);
+}
+
+static void run_gift_64_table_decrypt_nibbles(uint8_t *restrict out, const uint8_t *restrict in,
+                                              size_t len)
+{
+        table_blocks(out, in, len, gift_64_table_decrypt_nibbles, gift_64_table_rks_inv);
+}
 
-        printf("%f %f %f %f\n",
-               cycles[0] / ((float)NL * 16.0f),
-               cycles[1] / ((float)NL * 16.0f),
-               cycles[2] / ((float)NL * 16.0f),
-               cycles[3] / ((float)NL * 16.0f));
+static void run_gift_64_table_decrypt_bytes(uint8_t *restrict out, const uint8_t *restrict in,
+                                            size_t len)
+{
+        table_blocks(out, in, len, gift_64_table_decrypt_bytes, gift_64_table_rks_inv);
+}
+
+static void setup_gift_64_vec_sbox(void)
+{
+        gift_64_vec_sbox_init();
+        gift_64_vec_sbox_generate_round_keys(gift_64_vec_sbox_rks, key);
+}
 
-        struct timeval st, et;
-        gettimeofday(&st, NULL);
-        for (int i = 0; i < NT; i++) {
-                gift_128_encrypt(c, m, round_keys);
+static void run_gift_64_vec_sbox(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i++) {
+                c[i] = gift_64_vec_sbox_encrypt(m[i], gift_64_vec_sbox_rks);
+        }
+}
+
+static void run_gift_64_vec_sbox_x2(uint8_t *restrict out, const uint8_t *restrict in,
+                                    size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i += 2) {
+                gift_64_vec_sbox_encrypt_x2(c + i, m + i, gift_64_vec_sbox_rks);
         }
-        gettimeofday(&et, NULL);
-        double seconds = elapsed_seconds(&st, &et);
-        double megs = NT * sizeof(m) / (1024 * 1024);
-        printf("throughput: %f MiB/s\n", megs / seconds);
 }
 
-static void benchmark_gift_64_table(void)
+static void run_gift_64_vec_sbox_x4(uint8_t *restrict out, const uint8_t *restrict in,
+                                    size_t len)
 {
-        printf("benchmarking GIFT_64_TABLE...\n");
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i += 4) {
+                gift_64_vec_sbox_encrypt_x4(c + i, m + i, gift_64_vec_sbox_rks);
+        }
+}
 
-        uint64_t key[2];
-        uint64_t m;
-        uint64_t round_keys[ROUNDS_GIFT_64];
+static void run_gift_64_vec_sbox_x8(uint8_t *restrict out, const uint8_t *restrict in,
+                                    size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i += 8) {
+                gift_64_vec_sbox_encrypt_x8(c + i, m + i, gift_64_vec_sbox_rks);
+        }
+}
 
-        uint64_t cycles[3] = { 0UL };
-        for (int i = 0; i < NL; i++) {
-                cycles[0] += TIME(gift_64_table_generate_round_keys(round_keys, key));
-                cycles[1] += TIME(gift_64_table_subperm(m));
-                cycles[2] += TIME(gift_64_table_encrypt(m, round_keys));
+// expands the key on every call of 8 blocks
+static void run_gift_64_sliced(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i += 8) {
+                gift_64_sliced_encrypt(c + i, m + i, key);
         }
+}
 
-        printf("%f %f %f\n",
-               cycles[0] / ((float)NL * 8.0f),
-               cycles[1] / ((float)NL * 8.0f),
-               cycles[2] / ((float)NL * 8.0f));
+static struct gift_64_sliced_ctx gift_64_sliced;
 
-        struct timeval st, et;
-        gettimeofday(&st, NULL);
-        for (int i = 0; i < NT; i++) {
-                gift_64_table_encrypt(m, round_keys);
+static void setup_gift_64_sliced_ctx(void)
+{
+        gift_64_sliced_ctx_init(&gift_64_sliced, key);
+}
+
+static void run_gift_64_sliced_ctx(uint8_t *restrict out, const uint8_t *restrict in,
+                                   size_t len)
+{
+        gift_64_sliced_encrypt_groups(&gift_64_sliced, (uint64_t*)out, (const uint64_t*)in,
+                                      len / 64);
+}
+
+static void setup_gift_64_vec_sliced(void)
+{
+        gift_64_vec_sliced_init();
+        gift_64_vec_sliced_generate_round_keys(gift_64_vec_sliced_rks, key);
+}
+
+static void run_gift_64_vec_sliced(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i += 16) {
+                gift_64_vec_sliced_encrypt(c + i, m + i, gift_64_vec_sliced_rks);
         }
-        gettimeofday(&et, NULL);
-        double seconds = elapsed_seconds(&st, &et);
-        double megs = NT * sizeof(m) / (1024 * 1024);
-        printf("throughput: %f MiB/s\n", megs / seconds);
 }
 
-static void benchmark_gift_64_vec_sbox(void)
+// same blocks through the byte pointer entry point (lane loads instead of
+// whole-register loads)
+static void run_gift_64_vec_sliced_strided(uint8_t *restrict out, const uint8_t *restrict in,
+                                           size_t len)
 {
-        printf("benchmarking GIFT_64_VEC_SBOX...\n");
-        gift_64_vec_sbox_init();
+        for (size_t i = 0; i < len; i += 128) {
+                gift_64_vec_sliced_encrypt_strided(out + i, in + i, 8, gift_64_vec_sliced_rks);
+        }
+}
+
+// one key per block like a gateway tick that serves 16 different sessions:
+// every session keeps its expanded key, the sliced keys are rebuilt for every
+// 16 blocks
+static uint64_t gift_64_session_rks[16][ROUNDS_GIFT_64];
+static const uint64_t *gift_64_sessions[16];
 
-        uint64_t key[2];
-        uint64_t m;
-        uint8x16_t round_keys[ROUNDS_GIFT_64];
-        uint8x16_t state;
+static void setup_gift_64_vec_sliced_multikey(void)
+{
+        gift_64_vec_sliced_init();
+        for (size_t i = 0; i < 16; i++) {
+                const uint64_t session_key[2] = { key[0] ^ i, key[1] + i };
+                gift_64_generate_round_keys(gift_64_session_rks[i], session_key);
+                gift_64_sessions[i] = gift_64_session_rks[i];
+        }
+}
 
-        uint64_t cycles[6] = { 0UL };
-        for (int i = 0; i < NL; i++) {
-                cycles[0] += TIME(gift_64_vec_sbox_generate_round_keys(round_keys, key));
-                cycles[1] += TIME(gift_64_vec_sbox_subcells(state));
-                cycles[2] += TIME(gift_64_vec_sbox_permute(state));
-                cycles[3] += TIME(gift_64_vec_sbox_encrypt(m, round_keys));
-                cycles[4] += TIME(gift_64_vec_sbox_bits_pack(m));
-                cycles[5] += TIME(gift_64_vec_sbox_bits_unpack(state));
+static void run_gift_64_vec_sliced_multikey(uint8_t *restrict out, const uint8_t *restrict in,
+                                            size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i += 16) {
+                gift_64_vec_sliced_pack_round_keys_multi(gift_64_vec_sliced_rks, gift_64_sessions);
+                gift_64_vec_sliced_encrypt(c + i, m + i, gift_64_vec_sliced_rks);
         }
+}
 
-        printf("%f %f %f %f %f %f\n",
-               cycles[0] / ((float)NL * 8.0f),
-               cycles[1] / ((float)NL * 8.0f),
-               cycles[2] / ((float)NL * 8.0f),
-               cycles[3] / ((float)NL * 8.0f),
-               cycles[4] / ((float)NL * 8.0f),
-               cycles[5] / ((float)NL * 8.0f));
+#ifdef __AVX2__
+static void setup_gift_64_vec_sliced_avx2(void)
+{
+        setup_gift_64_vec_sliced();
+        gift_64_vec_sliced_avx2_init();
+}
 
-        struct timeval st, et;
-        gettimeofday(&st, NULL);
-        for (int i = 0; i < NT; i++) {
-                gift_64_vec_sbox_encrypt(m, round_keys);
+static void run_gift_64_vec_sliced_avx2(uint8_t *restrict out, const uint8_t *restrict in,
+                                        size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i += 32) {
+                gift_64_vec_sliced_avx2_encrypt(c + i, m + i, gift_64_vec_sliced_rks);
         }
-        gettimeofday(&et, NULL);
-        double seconds = elapsed_seconds(&st, &et);
-        double megs = NT * sizeof(m) / (1024 * 1024);
-        printf("throughput: %f MiB/s\n", megs / seconds);
 }
+#endif
 
-static void benchmark_gift_64_vec_sliced(void)
+#ifdef __ARM_FEATURE_SHA3
+static void setup_gift_64_vec_sliced_sha3(void)
 {
-        printf("benchmarking GIFT_64_VEC_SLICED...\n");
-        gift_64_vec_sbox_init();
+        setup_gift_64_vec_sliced();
+        gift_64_vec_sliced_sha3_init();
+}
+
+static void run_gift_64_vec_sliced_sha3(uint8_t *restrict out, const uint8_t *restrict in,
+                                        size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i += 16) {
+                gift_64_vec_sliced_sha3_encrypt(c + i, m + i, gift_64_vec_sliced_rks);
+        }
+}
+#endif
+
+#ifdef __ARM_FEATURE_SVE
+// the granule covers the largest vector (2048 bits, 256 blocks); vector
+// lengths that do not divide it leave a remainder for the NEON kernel
+static void run_gift_64_vec_sliced_sve(uint8_t *restrict out, const uint8_t *restrict in,
+                                       size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        const size_t n = gift_64_vec_sliced_sve_blocks();
+        size_t i = 0;
+        for (; i + n <= len / 8; i += n) {
+                gift_64_vec_sliced_sve_encrypt(c + i, m + i, gift_64_vec_sliced_rks);
+        }
+        for (; i < len / 8; i += 16) {
+                gift_64_vec_sliced_encrypt(c + i, m + i, gift_64_vec_sliced_rks);
+        }
+}
+#endif
+
+#ifdef __aarch64__
+static void run_gift_64_neon(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        for (size_t i = 0; i < len / 8; i += 32) {
+                gift_64_neon_encrypt(c + i, m + i, gift_64_vec_sliced_rks);
+        }
+}
+#endif
+
+static void setup_gift_64_ctr(void)
+{
+        gift_64_ctr_init(&gift_64_ctr, key);
+}
+
+static void run_gift_64_ctr(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        gift_64_ctr_xcrypt(&gift_64_ctr, out, in, len, 0);
+}
+
+// CBC chained block by block through the naive kernel
+static void run_gift_64_cbc_naive(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint64_t *c = (uint64_t*)out;
+        const uint64_t *m = (const uint64_t*)in;
+        uint64_t chain = 0;
+        for (size_t i = 0; i < len / 8; i++) {
+                chain = c[i] = gift_64_encrypt(m[i] ^ chain, gift_64_rks);
+        }
+}
+
+static void run_gift_64_cbc_naive_decrypt(uint8_t *restrict out, const uint8_t *restrict in,
+                                          size_t len)
+{
+        uint64_t *m = (uint64_t*)out;
+        const uint64_t *c = (const uint64_t*)in;
+        uint64_t chain = 0;
+        for (size_t i = 0; i < len / 8; i++) {
+                m[i] = gift_64_decrypt(c[i], gift_64_rks) ^ chain;
+                chain = c[i];
+        }
+}
+
+static void setup_gift_64_cbc(void)
+{
+        gift_64_cbc_init(&gift_64_cbc, key);
+}
+
+static void run_gift_64_cbc(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint8_t iv[8] = { 0 };
+        gift_64_cbc_encrypt(&gift_64_cbc, out, in, len, iv);
+}
+
+static void run_gift_64_cbc_decrypt(uint8_t *restrict out, const uint8_t *restrict in,
+                                    size_t len)
+{
+        uint8_t iv[8] = { 0 };
+        gift_64_cbc_decrypt(&gift_64_cbc, out, in, len, iv);
+}
+
+// the message is cut into 16 streams of len / 16 bytes
+static void run_gift_64_cbc_x16(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint8_t iv[16][8] = { { 0 } };
+        uint8_t *outs[16];
+        const uint8_t *ins[16];
+        for (size_t i = 0; i < 16; i++) {
+                outs[i] = out + i * (len / 16);
+                ins[i] = in + i * (len / 16);
+        }
+        gift_64_cbc_encrypt_x16(&gift_64_cbc, outs, ins, len / 16, iv);
+}
+
+static void setup_gift_64_dispatch(void)
+{
+        gift_64_ctx_init(&gift_64_dispatch, key);
+}
+
+static void run_gift_64_dispatch(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        gift_64_encrypt_blocks(&gift_64_dispatch, out, in, len / 8);
+}
+
+static void setup_pool(void)
+{
+        pool = parallel_pool_create(bench_threads);
+        if (pool == NULL) {
+                fprintf(stderr, "cannot start %d threads\n", bench_threads);
+                exit(1);
+        }
+}
+
+static void setup_gift_64_parallel_ecb(void)
+{
+        setup_gift_64_vec_sliced();
+        setup_pool();
+}
+
+static void run_gift_64_parallel_ecb(uint8_t *restrict out, const uint8_t *restrict in,
+                                     size_t len)
+{
+        parallel_gift_64_ecb_encrypt(pool, (uint64_t*)out, (const uint64_t*)in, len / 8,
+                                     gift_64_vec_sliced_rks);
+}
+
+static void setup_gift_64_parallel_ctr(void)
+{
+        setup_gift_64_ctr();
+        setup_pool();
+}
+
+static void run_gift_64_parallel_ctr(uint8_t *restrict out, const uint8_t *restrict in,
+                                     size_t len)
+{
+        parallel_gift_64_ctr_xcrypt(pool, out, in, len, 0, &gift_64_ctr);
+}
+
+/* GIFT-128 */
+
+static uint8_t gift_128_rks[ROUNDS_GIFT_128][32];
+static uint8x16x4_t gift_128_vec_sliced_rks[ROUNDS_GIFT_128][2];
+static uint32_t gift_128_fixsliced_rks[ROUNDS_GIFT_128][3];
+static struct gift_cofb_ctx gift_cofb;
+
+static void setup_gift_128_naive(void)
+{
+        gift_128_generate_round_keys(gift_128_rks, key);
+}
+
+static void run_gift_128_naive(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        for (size_t i = 0; i < len; i += 16) {
+                gift_128_encrypt(out + i, in + i, gift_128_rks);
+        }
+}
+
+static void setup_gift_128_vec_sliced(void)
+{
+        gift_128_vec_sliced_init();
+        gift_128_vec_sliced_generate_round_keys(gift_128_vec_sliced_rks, key);
+}
+
+static void run_gift_128_vec_sliced(uint8_t *restrict out, const uint8_t *restrict in,
+                                    size_t len)
+{
+        for (size_t i = 0; i < len; i += 256) {
+                gift_128_vec_sliced_encrypt((uint8_t(*)[16])(out + i),
+                                            (const uint8_t(*)[16])(in + i),
+                                            gift_128_vec_sliced_rks);
+        }
+}
+
+static void setup_gift_128_fixsliced(void)
+{
+        gift_128_fixsliced_generate_round_keys(gift_128_fixsliced_rks, key);
+}
+
+static void run_gift_128_fixsliced(uint8_t *restrict out, const uint8_t *restrict in,
+                                   size_t len)
+{
+        for (size_t i = 0; i < len; i += 16) {
+                gift_128_fixsliced_encrypt(out + i, in + i, gift_128_fixsliced_rks);
+        }
+}
+
+static void setup_gift_cofb_naive(void)
+{
+        gift_cofb_init(&gift_cofb, key_bytes, GIFT_COFB_NAIVE);
+}
+
+static void setup_gift_cofb_vec_sliced(void)
+{
+        gift_cofb_init(&gift_cofb, key_bytes, GIFT_COFB_VEC_SLICED);
+}
+
+static void setup_gift_cofb_fixsliced(void)
+{
+        gift_cofb_init(&gift_cofb, key_bytes, GIFT_COFB_FIXSLICED);
+}
+
+// one message per call, so small sizes include E(N) and the AD block
+static void run_gift_cofb(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint8_t tag[GIFT_COFB_TAG_BYTES];
+        gift_cofb_encrypt(&gift_cofb, out, tag, in, len, ad, sizeof(ad), nonce);
+        clobber(tag);
+}
+
+/* Camellia */
 
-        uint64_t key[2];
-        uint64_t m[16], c[16];
-        uint8x16x4_t round_keys[ROUNDS_GIFT_64][2];
-        uint8x16x4_t state[2];
-
-        uint64_t cycles[6] = { 0UL };
-        for (int i = 0; i < NL; i++) {
-                cycles[0] += TIME(gift_64_vec_sliced_generate_round_keys(round_keys, key));
-                cycles[1] += TIME(gift_64_vec_sliced_subcells(state));
-                cycles[2] += TIME(gift_64_vec_sliced_permute(state));
-                cycles[3] += TIME(gift_64_vec_sliced_encrypt(c, m, round_keys));
-                cycles[4] += TIME(gift_64_vec_sliced_bits_pack(state));
-                cycles[5] += TIME(gift_64_vec_sliced_bits_unpack(state));
-        }
-
-        printf("%f %f %f %f %f %f\n",
-               cycles[0] / ((float)NL * 128.0f),
-               cycles[1] / ((float)NL * 128.0f),
-               cycles[2] / ((float)NL * 128.0f),
-               cycles[3] / ((float)NL * 128.0f),
-               cycles[4] / ((float)NL * 128.0f),
-               cycles[5] / ((float)NL * 128.0f));
-
-        struct timeval st, et;
-        gettimeofday(&st, NULL);
-        for (int i = 0; i < NT; i++) {
-                gift_64_vec_sliced_encrypt(c, m, round_keys);
-        }
-        gettimeofday(&et, NULL);
-        double seconds = elapsed_seconds(&st, &et);
-        double megs = NT * sizeof(m) / (1024 * 1024);
-        printf("throughput: %f MiB/s\n", megs / seconds);
-}
-
-static void benchmark_camellia_naive(void)
-{
-        printf("Benchmaring CAMELLIA_NAIVE 128-bit...\n");
-
-        uint64_t key[2];
-        uint64_t m[2], c[2];
-        struct camellia_rks_128 rks;
-
-        uint64_t cycles[8] = { 0UL };
-        for (int i = 0; i < NL; i++) {
-                cycles[0] += TIME(camellia_naive_generate_round_keys_128(&rks, key));
-                // TODO deliberate over whether the cycle count of functions
-                // taking 8 bytes as input should still be divided by 16
-                cycles[1] += TIME(camellia_naive_feistel_round(m, key[1]));
-                cycles[2] += TIME(camellia_naive_S(m[0]));
-                cycles[3] += TIME(camellia_naive_P(m[1]));
-                cycles[4] += TIME(camellia_naive_F(m[0], key[0]));
-                cycles[5] += TIME(camellia_naive_FL(m[0], key[0]));
-                cycles[6] += TIME(camellia_naive_encrypt_128(c, m, &rks));
-        }
-
-        printf("%f %f %f %f %f %f %f %f\n",
-               cycles[0] / ((float)NL * 16.0f),
-               cycles[1] / ((float)NL * 16.0f),
-               cycles[2] / ((float)NL * 16.0f),
-               cycles[3] / ((float)NL * 16.0f),
-               cycles[4] / ((float)NL * 16.0f),
-               cycles[5] / ((float)NL * 16.0f),
-               cycles[6] / ((float)NL * 16.0f),
-               cycles[7] / ((float)NL * 16.0f));
-
-        struct timeval st, et;
-        gettimeofday(&st, NULL);
-        for (int i = 0; i < NT; i++) {
-                camellia_naive_encrypt_128(c, m, &rks);
-        }
-        gettimeofday(&et, NULL);
-        double seconds = elapsed_seconds(&st, &et);
-        double megs = NT * sizeof(m) / (1024 * 1024);
-        printf("throughput: %f MiB/s\n", megs / seconds);
-
-        printf("Benchmarking CAMELLIA_NAIVE 256-bit...\n");
-        uint64_t key_256[4];
-        struct camellia_rks_256 rks_256;
-
-        memset(cycles, 0, sizeof(cycles));
-        for (int i = 0; i < NL; i++) {
-                cycles[0] += TIME(camellia_naive_generate_round_keys_256(&rks_256, key_256));
-                cycles[1] += TIME(camellia_naive_encrypt_256(c, m, &rks_256));
-        }
-
-        printf("%f %f\n",
-               cycles[0] / ((float)NL * 16.0f),
-               cycles[1] / ((float)NL * 16.0f));
-
-        gettimeofday(&st, NULL);
-        for (int i = 0; i < NT; i++) {
-                camellia_naive_encrypt_256(c, m, &rks_256);
-        }
-        gettimeofday(&et, NULL);
-        seconds = elapsed_seconds(&st, &et);
-        megs = NT * sizeof(m) / (1024 * 1024);
-        printf("throughput: %f MiB/s\n", megs / seconds);
-}
-
-static void benchmark_camellia_spec_opt(void)
-{
-        printf("Benchmarking CAMELLIA_SPEC_OPT 128-bit...\n");
-
-        uint64_t key[2];
-        uint64_t m[2], c[2];
-        struct camellia_rks_128 rks;
-
-        uint64_t cycles[5] = { 0UL };
-        for (int i = 0; i < NL; i++) {
-                cycles[0] += TIME(camellia_spec_opt_generate_round_keys_128(&rks, key));
-                cycles[1] += TIME(camellia_spec_opt_feistel_round(m, key[0]));
-                cycles[2] += TIME(camellia_spec_opt_F(m[0], key[0]));
-                cycles[3] += TIME(camellia_spec_opt_FL(m[0], key[0]));
-                cycles[4] += TIME(camellia_spec_opt_encrypt_128(c, m, &rks));
+static struct camellia_rks_128 camellia_rks;
+static struct camellia_rks_256 camellia_rks_256;
+static struct camellia_rks_sliced_128 camellia_rks_sliced;
+static struct camellia_cbc_ctx_128 camellia_cbc;
+static struct camellia_xts_ctx_128 camellia_xts;
+static struct camellia_gcm_ctx camellia_gcm;
+static struct camellia_rks_sliced_256 camellia_rks_sliced_256;
+static struct camellia_ctx_128 camellia_dispatch;
+
+static void setup_camellia_naive(void)
+{
+        camellia_naive_generate_round_keys_128(&camellia_rks, key);
+}
+
+static void run_camellia_naive(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint64_t (*c)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])in;
+        for (size_t i = 0; i < len / 16; i++) {
+                camellia_naive_encrypt_128(c[i], m[i], &camellia_rks);
         }
+}
 
-        printf("%f %f %f %f %f\n",
-               cycles[0] / ((float)NL * 16.0f),
-               cycles[1] / ((float)NL * 16.0f),
-               cycles[2] / ((float)NL * 16.0f),
-               cycles[3] / ((float)NL * 16.0f),
-               cycles[4] / ((float)NL * 16.0f));
-
-        struct timeval st, et;
-        gettimeofday(&st, NULL);
-        for (int i = 0; i < NT; i++) {
-                camellia_spec_opt_encrypt_128(c, m, &rks);
+static void setup_camellia_spec_opt(void)
+{
+        camellia_spec_opt_generate_round_keys_128(&camellia_rks, key);
+}
+
+static void run_camellia_spec_opt(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint64_t (*c)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])in;
+        for (size_t i = 0; i < len / 16; i++) {
+                camellia_spec_opt_encrypt_128(c[i], m[i], &camellia_rks);
         }
-        gettimeofday(&et, NULL);
-        double seconds = elapsed_seconds(&st, &et);
-        double megs = NT * sizeof(m) / (float)(1024 * 1024);
-        printf("throughput: %f MiB/s\n", megs / seconds);
 }
 
-static void benchmark_camellia_sliced(void)
+static void setup_camellia_sliced(void)
 {
         camellia_sliced_init();
+        camellia_sliced_generate_round_keys_128(&camellia_rks_sliced, key);
+}
 
-        printf("Benchmaring CAMELLIA_SLICED 128-bit...\n");
+static void run_camellia_sliced(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint64_t (*c)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])in;
+        for (size_t i = 0; i < len / 16; i += 16) {
+                camellia_sliced_encrypt_128(c + i, m + i, &camellia_rks_sliced);
+        }
+}
 
-        uint64_t key[2];
-        uint64_t m[16][2], c[16][2];
-        struct camellia_rks_sliced_128 rks;
+static void run_camellia_sliced_strided(uint8_t *restrict out, const uint8_t *restrict in,
+                                        size_t len)
+{
+        for (size_t i = 0; i < len; i += 256) {
+                camellia_sliced_encrypt_128_strided(out + i, in + i, 16, &camellia_rks_sliced);
+        }
+}
 
-        uint8x16x4_t s[4];
+static struct camellia_rks_128 camellia_session_rks[16];
+static const struct camellia_rks_128 *camellia_sessions[16];
 
-        uint64_t cycles[7] = { 0UL };
-        for (int i = 0; i < NL; i++) {
-                cycles[0] += TIME(camellia_sliced_generate_round_keys_128(&rks, key));
-                cycles[1] += TIME(camellia_sliced_feistel_round(s, rks.kl[0]));
-                cycles[2] += TIME(camellia_sliced_F(s, rks.kl[2]));
-                cycles[3] += TIME(camellia_sliced_FL(s, rks.ku[9]));
-                cycles[4] += TIME(camellia_sliced_pack(s, m));
-                cycles[5] += TIME(camellia_sliced_unpack(c, s));
-                cycles[6] += TIME(camellia_sliced_encrypt_128(c, m, &rks));
+static void setup_camellia_sliced_multikey(void)
+{
+        camellia_sliced_init();
+        for (size_t i = 0; i < 16; i++) {
+                const uint64_t session_key[2] = { key[0] ^ i, key[1] + i };
+                camellia_spec_opt_generate_round_keys_128(&camellia_session_rks[i], session_key);
+                camellia_sessions[i] = &camellia_session_rks[i];
         }
+}
 
-        printf("%f %f %f %f %f %f %f\n",
-               cycles[0] / ((float)NL * 16.f * 16.f),
-               cycles[1] / ((float)NL * 16.f * 16.f),
-               cycles[2] / ((float)NL * 16.f * 16.f),
-               cycles[3] / ((float)NL * 16.f * 16.f),
-               cycles[4] / ((float)NL * 16.f * 16.f),
-               cycles[5] / ((float)NL * 16.f * 16.f),
-               cycles[6] / ((float)NL * 16.f * 16.f));
+static void run_camellia_sliced_multikey(uint8_t *restrict out, const uint8_t *restrict in,
+                                         size_t len)
+{
+        uint64_t (*c)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])in;
+        for (size_t i = 0; i < len / 16; i += 16) {
+                camellia_sliced_pack_round_keys_128_multi(&camellia_rks_sliced, camellia_sessions);
+                camellia_sliced_encrypt_128(c + i, m + i, &camellia_rks_sliced);
+        }
+}
 
-        struct timeval st, et;
-        gettimeofday(&st, NULL);
-        for (int i = 0; i < NT; i++) {
-                camellia_sliced_encrypt_128(c, m, &rks);
+#ifdef __AVX2__
+static void setup_camellia_sliced_avx2(void)
+{
+        setup_camellia_sliced();
+        camellia_sliced_avx2_init();
+}
+
+static void run_camellia_sliced_avx2(uint8_t *restrict out, const uint8_t *restrict in,
+                                     size_t len)
+{
+        uint64_t (*c)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])in;
+        for (size_t i = 0; i < len / 16; i += 32) {
+                camellia_sliced_avx2_encrypt_128(c + i, m + i, &camellia_rks_sliced);
         }
-        gettimeofday(&et, NULL);
-        double seconds = elapsed_seconds(&st, &et);
-        double megs = NT * sizeof(m) / (float)(1024 * 1024);
-        printf("throughput: %f MiB/s\n", megs / seconds);
 }
+#endif
 
-int main(int argc, char *argv[])
+#ifdef __ARM_FEATURE_SHA3
+static void setup_camellia_sliced_sha3(void)
+{
+        setup_camellia_sliced();
+        camellia_sliced_sha3_init();
+}
+
+static void run_camellia_sliced_sha3(uint8_t *restrict out, const uint8_t *restrict in,
+                                     size_t len)
+{
+        uint64_t (*c)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])in;
+        for (size_t i = 0; i < len / 16; i += 16) {
+                camellia_sliced_sha3_encrypt_128(c + i, m + i, &camellia_rks_sliced);
+        }
+}
+#endif
+
+#if defined(__ARM_FEATURE_SVE2) && defined(__ARM_FEATURE_SVE2_AES)
+// same remainder handling as run_gift_64_vec_sliced_sve
+static void run_camellia_sliced_sve(uint8_t *restrict out, const uint8_t *restrict in,
+                                    size_t len)
+{
+        uint64_t (*c)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])in;
+        const size_t n = camellia_sliced_sve_blocks();
+        size_t i = 0;
+        for (; i + n <= len / 16; i += n) {
+                camellia_sliced_sve_encrypt_128(c + i, m + i, &camellia_rks_sliced);
+        }
+        for (; i < len / 16; i += 16) {
+                camellia_sliced_encrypt_128(c + i, m + i, &camellia_rks_sliced);
+        }
+}
+#endif
+
+static void setup_camellia_dispatch(void)
+{
+        camellia_ctx_init_128(&camellia_dispatch, key);
+}
+
+static void run_camellia_dispatch(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        camellia_encrypt_blocks_128(&camellia_dispatch, out, in, len / 16);
+}
+
+static void setup_camellia_parallel(void)
+{
+        setup_camellia_sliced();
+        setup_pool();
+}
+
+static void run_camellia_parallel_ecb(uint8_t *restrict out, const uint8_t *restrict in,
+                                      size_t len)
+{
+        parallel_camellia_ecb_encrypt_128(pool, (uint64_t(*)[2])out, (const uint64_t(*)[2])in,
+                                          len / 16, &camellia_rks_sliced);
+}
+
+static void run_camellia_cbc_naive(uint8_t *restrict out, const uint8_t *restrict in,
+                                   size_t len)
+{
+        uint64_t (*c)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])in;
+        uint64_t chain[2] = { 0 };
+        for (size_t i = 0; i < len / 16; i++) {
+                const uint64_t block[2] = { m[i][0] ^ chain[0], m[i][1] ^ chain[1] };
+                camellia_naive_encrypt_128(c[i], block, &camellia_rks);
+                chain[0] = c[i][0];
+                chain[1] = c[i][1];
+        }
+}
+
+static void run_camellia_cbc_naive_decrypt(uint8_t *restrict out, const uint8_t *restrict in,
+                                           size_t len)
+{
+        uint64_t (*m)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*c)[2] = (const uint64_t(*)[2])in;
+        uint64_t chain[2] = { 0 };
+        for (size_t i = 0; i < len / 16; i++) {
+                camellia_naive_decrypt_128(m[i], c[i], &camellia_rks);
+                m[i][0] ^= chain[0];
+                m[i][1] ^= chain[1];
+                chain[0] = c[i][0];
+                chain[1] = c[i][1];
+        }
+}
+
+static void setup_camellia_cbc(void)
+{
+        camellia_cbc_init_128(&camellia_cbc, key);
+}
+
+static void run_camellia_cbc(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint8_t iv[16] = { 0 };
+        camellia_cbc_encrypt_128(&camellia_cbc, out, in, len, iv);
+}
+
+static void run_camellia_cbc_decrypt(uint8_t *restrict out, const uint8_t *restrict in,
+                                     size_t len)
+{
+        uint8_t iv[16] = { 0 };
+        camellia_cbc_decrypt_128(&camellia_cbc, out, in, len, iv);
+}
+
+static void run_camellia_cbc_x16(uint8_t *restrict out, const uint8_t *restrict in,
+                                 size_t len)
+{
+        uint8_t iv[16][16] = { { 0 } };
+        uint8_t *outs[16];
+        const uint8_t *ins[16];
+        for (size_t i = 0; i < 16; i++) {
+                outs[i] = out + i * (len / 16);
+                ins[i] = in + i * (len / 16);
+        }
+        camellia_cbc_encrypt_128_x16(&camellia_cbc, outs, ins, len / 16, iv);
+}
+
+static void setup_camellia_xts(void)
+{
+        camellia_xts_init_128(&camellia_xts, (const uint8_t*)key_256);
+}
+
+// a disk image: consecutive sectors with consecutive sector numbers
+static void run_camellia_xts_512(uint8_t *restrict out, const uint8_t *restrict in,
+                                 size_t len)
+{
+        for (size_t i = 0; i < len; i += 512) {
+                camellia_xts_encrypt_128(&camellia_xts, out + i, in + i, 512, i / 512);
+        }
+}
+
+static void run_camellia_xts_4096(uint8_t *restrict out, const uint8_t *restrict in,
+                                  size_t len)
+{
+        for (size_t i = 0; i < len; i += 4096) {
+                camellia_xts_encrypt_128(&camellia_xts, out + i, in + i, 4096, i / 4096);
+        }
+}
+
+static void run_camellia_xts_4096_decrypt(uint8_t *restrict out, const uint8_t *restrict in,
+                                          size_t len)
+{
+        for (size_t i = 0; i < len; i += 4096) {
+                camellia_xts_decrypt_128(&camellia_xts, out + i, in + i, 4096, i / 4096);
+        }
+}
+
+static void setup_camellia_gcm(void)
+{
+        camellia_gcm_init_128(&camellia_gcm, (const uint8_t*)key_256);
+}
+
+static void setup_camellia_gcm_256(void)
+{
+        camellia_gcm_init_256(&camellia_gcm, (const uint8_t*)key_256);
+}
+
+// one message per call, like gift-cofb
+static void run_camellia_gcm(uint8_t *restrict out, const uint8_t *restrict in, size_t len)
+{
+        uint8_t tag[CAMELLIA_GCM_TAG_BYTES];
+        camellia_gcm_encrypt(&camellia_gcm, out, tag, in, len, ad, sizeof(ad), nonce);
+        clobber(tag);
+}
+
+// the tag will not match: everything is still hashed and decrypted, then cleared
+static void run_camellia_gcm_decrypt(uint8_t *restrict out, const uint8_t *restrict in,
+                                     size_t len)
+{
+        const uint8_t tag[CAMELLIA_GCM_TAG_BYTES] = { 0 };
+        int ret = camellia_gcm_decrypt(&camellia_gcm, out, in, len, ad, sizeof(ad), nonce, tag);
+        clobber(&ret);
+}
+
+static void run_camellia_parallel_ctr(uint8_t *restrict out, const uint8_t *restrict in,
+                                      size_t len)
+{
+        const uint64_t ctr[2] = { 0UL };
+        parallel_camellia_ctr_xcrypt_128(pool, out, in, len, ctr, &camellia_rks_sliced);
+}
+
+static void setup_camellia_naive_256(void)
+{
+        camellia_naive_generate_round_keys_256(&camellia_rks_256, key_256);
+}
+
+static void run_camellia_naive_256(uint8_t *restrict out, const uint8_t *restrict in,
+                                   size_t len)
+{
+        uint64_t (*c)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])in;
+        for (size_t i = 0; i < len / 16; i++) {
+                camellia_naive_encrypt_256(c[i], m[i], &camellia_rks_256);
+        }
+}
+
+static void setup_camellia_spec_opt_256(void)
+{
+        camellia_spec_opt_generate_round_keys_256(&camellia_rks_256, key_256);
+}
+
+static void run_camellia_spec_opt_256(uint8_t *restrict out, const uint8_t *restrict in,
+                                      size_t len)
+{
+        uint64_t (*c)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])in;
+        for (size_t i = 0; i < len / 16; i++) {
+                camellia_spec_opt_encrypt_256(c[i], m[i], &camellia_rks_256);
+        }
+}
+
+static void setup_camellia_sliced_256(void)
+{
+        camellia_sliced_init();
+        camellia_sliced_generate_round_keys_256(&camellia_rks_sliced_256, key_256);
+}
+
+static void run_camellia_sliced_256(uint8_t *restrict out, const uint8_t *restrict in,
+                                    size_t len)
+{
+        uint64_t (*c)[2] = (uint64_t(*)[2])out;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])in;
+        for (size_t i = 0; i < len / 16; i += 16) {
+                camellia_sliced_encrypt_256(c + i, m + i, &camellia_rks_sliced_256);
+        }
+}
+
+static const struct bench benches[] = {
+        { "gift-64", "naive", 8, 0, NULL, setup_gift_64_naive, run_gift_64_naive },
+        { "gift-64", "naive_decrypt", 8, 0, NULL, setup_gift_64_naive, run_gift_64_naive_decrypt },
+        { "gift-64", "table", 8, 0, NULL, setup_gift_64_table, run_gift_64_table },
+        { "gift-64", "table_nibbles", 8, 0, NULL, setup_gift_64_table, run_gift_64_table_nibbles },
+        { "gift-64", "table_bytes", 8, 0, NULL, setup_gift_64_table, run_gift_64_table_bytes },
+        { "gift-64", "table_decrypt", 8, 0, NULL, setup_gift_64_table, run_gift_64_table_decrypt },
+        { "gift-64", "table_decrypt_nibbles", 8, 0, NULL, setup_gift_64_table,
+          run_gift_64_table_decrypt_nibbles },
+        { "gift-64", "table_decrypt_bytes", 8, 0, NULL, setup_gift_64_table,
+          run_gift_64_table_decrypt_bytes },
+        { "gift-64", "vec_sbox", 8, 0, NULL, setup_gift_64_vec_sbox, run_gift_64_vec_sbox },
+        { "gift-64", "vec_sbox_x2", 16, 0, NULL, setup_gift_64_vec_sbox, run_gift_64_vec_sbox_x2 },
+        { "gift-64", "vec_sbox_x4", 32, 0, NULL, setup_gift_64_vec_sbox, run_gift_64_vec_sbox_x4 },
+        { "gift-64", "vec_sbox_x8", 64, 0, NULL, setup_gift_64_vec_sbox, run_gift_64_vec_sbox_x8 },
+        { "gift-64", "sliced", 64, 0, NULL, NULL, run_gift_64_sliced },
+        { "gift-64", "sliced_ctx", 64, 0, NULL, setup_gift_64_sliced_ctx, run_gift_64_sliced_ctx },
+        { "gift-64", "vec_sliced", 128, 0, NULL, setup_gift_64_vec_sliced, run_gift_64_vec_sliced },
+        { "gift-64", "vec_sliced_strided", 128, 0, NULL, setup_gift_64_vec_sliced,
+          run_gift_64_vec_sliced_strided },
+        { "gift-64", "vec_sliced_multikey", 128, 0, NULL, setup_gift_64_vec_sliced_multikey,
+          run_gift_64_vec_sliced_multikey },
+#ifdef __AVX2__
+        { "gift-64", "vec_sliced_avx2", 256, 0, have_avx2, setup_gift_64_vec_sliced_avx2,
+          run_gift_64_vec_sliced_avx2 },
+#endif
+#ifdef __ARM_FEATURE_SHA3
+        { "gift-64", "vec_sliced_sha3", 128, 0, have_sha3, setup_gift_64_vec_sliced_sha3,
+          run_gift_64_vec_sliced_sha3 },
+#endif
+#ifdef __ARM_FEATURE_SVE
+        { "gift-64", "vec_sliced_sve", 2048, 0, have_sve, setup_gift_64_vec_sliced,
+          run_gift_64_vec_sliced_sve },
+#endif
+#ifdef __aarch64__
+        { "gift-64", "neon_asm", 256, 0, NULL, setup_gift_64_vec_sliced, run_gift_64_neon },
+#endif
+        { "gift-64", "dispatch", 8, 0, NULL, setup_gift_64_dispatch, run_gift_64_dispatch },
+        { "gift-64", "ctr", 8, 0, NULL, setup_gift_64_ctr, run_gift_64_ctr },
+        { "gift-64", "cbc_naive", 8, 0, NULL, setup_gift_64_naive, run_gift_64_cbc_naive },
+        { "gift-64", "cbc_naive_decrypt", 8, 0, NULL, setup_gift_64_naive,
+          run_gift_64_cbc_naive_decrypt },
+        { "gift-64", "cbc", 8, 0, NULL, setup_gift_64_cbc, run_gift_64_cbc },
+        { "gift-64", "cbc_decrypt", 8, 0, NULL, setup_gift_64_cbc, run_gift_64_cbc_decrypt },
+        { "gift-64", "cbc_x16", 128, 0, NULL, setup_gift_64_cbc, run_gift_64_cbc_x16 },
+        { "gift-64", "parallel_ecb", 128, 1, NULL, setup_gift_64_parallel_ecb,
+          run_gift_64_parallel_ecb },
+        { "gift-64", "parallel_ctr", 8, 1, NULL, setup_gift_64_parallel_ctr,
+          run_gift_64_parallel_ctr },
+        { "gift-128", "naive", 16, 0, NULL, setup_gift_128_naive, run_gift_128_naive },
+        { "gift-128", "vec_sliced", 256, 0, NULL, setup_gift_128_vec_sliced,
+          run_gift_128_vec_sliced },
+        { "gift-128", "fixsliced", 16, 0, NULL, setup_gift_128_fixsliced,
+          run_gift_128_fixsliced },
+        { "gift-cofb", "naive", 16, 0, NULL, setup_gift_cofb_naive, run_gift_cofb },
+        { "gift-cofb", "vec_sliced", 16, 0, NULL, setup_gift_cofb_vec_sliced, run_gift_cofb },
+        { "gift-cofb", "fixsliced", 16, 0, NULL, setup_gift_cofb_fixsliced, run_gift_cofb },
+        { "camellia-128", "naive", 16, 0, NULL, setup_camellia_naive, run_camellia_naive },
+        { "camellia-128", "spec_opt", 16, 0, NULL, setup_camellia_spec_opt, run_camellia_spec_opt },
+        { "camellia-128", "sliced", 256, 0, NULL, setup_camellia_sliced, run_camellia_sliced },
+        { "camellia-128", "sliced_strided", 256, 0, NULL, setup_camellia_sliced,
+          run_camellia_sliced_strided },
+        { "camellia-128", "sliced_multikey", 256, 0, NULL, setup_camellia_sliced_multikey,
+          run_camellia_sliced_multikey },
+#ifdef __AVX2__
+        { "camellia-128", "sliced_avx2", 512, 0, have_avx2, setup_camellia_sliced_avx2,
+          run_camellia_sliced_avx2 },
+#endif
+#ifdef __ARM_FEATURE_SHA3
+        { "camellia-128", "sliced_sha3", 256, 0, have_sha3, setup_camellia_sliced_sha3,
+          run_camellia_sliced_sha3 },
+#endif
+#if defined(__ARM_FEATURE_SVE2) && defined(__ARM_FEATURE_SVE2_AES)
+        { "camellia-128", "sliced_sve", 4096, 0, have_sve2_aes, setup_camellia_sliced,
+          run_camellia_sliced_sve },
+#endif
+        { "camellia-128", "dispatch", 16, 0, NULL, setup_camellia_dispatch, run_camellia_dispatch },
+        { "camellia-128", "parallel_ecb", 256, 1, NULL, setup_camellia_parallel,
+          run_camellia_parallel_ecb },
+        { "camellia-128", "parallel_ctr", 16, 1, NULL, setup_camellia_parallel,
+          run_camellia_parallel_ctr },
+        { "camellia-128", "cbc_naive", 16, 0, NULL, setup_camellia_naive, run_camellia_cbc_naive },
+        { "camellia-128", "cbc_naive_decrypt", 16, 0, NULL, setup_camellia_naive,
+          run_camellia_cbc_naive_decrypt },
+        { "camellia-128", "cbc", 16, 0, NULL, setup_camellia_cbc, run_camellia_cbc },
+        { "camellia-128", "cbc_decrypt", 16, 0, NULL, setup_camellia_cbc,
+          run_camellia_cbc_decrypt },
+        { "camellia-128", "cbc_x16", 256, 0, NULL, setup_camellia_cbc, run_camellia_cbc_x16 },
+        { "camellia-128", "xts_512", 512, 0, NULL, setup_camellia_xts, run_camellia_xts_512 },
+        { "camellia-128", "xts_4096", 4096, 0, NULL, setup_camellia_xts, run_camellia_xts_4096 },
+        { "camellia-128", "xts_4096_decrypt", 4096, 0, NULL, setup_camellia_xts,
+          run_camellia_xts_4096_decrypt },
+        { "camellia-128", "gcm", 16, 0, NULL, setup_camellia_gcm, run_camellia_gcm },
+        { "camellia-128", "gcm_decrypt", 16, 0, NULL, setup_camellia_gcm,
+          run_camellia_gcm_decrypt },
+        { "camellia-256", "naive", 16, 0, NULL, setup_camellia_naive_256, run_camellia_naive_256 },
+        { "camellia-256", "spec_opt", 16, 0, NULL, setup_camellia_spec_opt_256,
+          run_camellia_spec_opt_256 },
+        { "camellia-256", "sliced", 256, 0, NULL, setup_camellia_sliced_256,
+          run_camellia_sliced_256 },
+        { "camellia-256", "gcm", 16, 0, NULL, setup_camellia_gcm_256, run_camellia_gcm },
+};
+
+#define NBENCHES (sizeof(benches) / sizeof(benches[0]))
+
+/* harness */
+
+struct options {
+        const char *cipher; // comma separated, NULL for all
+        const char *kernel;
+        size_t sizes[32];
+        size_t nsizes;
+        int threads[32];
+        size_t nthreads;
+        int reps;
+        int warmup_ms;
+        int sample_ms;
+        enum timer timer;
+        enum format format;
+        int per_block; // report per block instead of per byte
+};
+
+// is name one of the entries of the comma separated list (NULL matches all)
+static int in_list(const char *list, const char *name)
+{
+        if (list == NULL) {
+                return 1;
+        }
+
+        const size_t n = strlen(name);
+        for (const char *p = list; ; ) {
+                const char *end = strchr(p, ',');
+                const size_t len = end ? (size_t)(end - p) : strlen(p);
+                if (len == n && strncmp(p, name, n) == 0) {
+                        return 1;
+                }
+                if (end == NULL) {
+                        return 0;
+                }
+                p = end + 1;
+        }
+}
+
+// parses "a,b,c" with k/K and m/M suffixes, returns the count or -1
+static int parse_sizes(size_t out[], size_t max, const char *s)
+{
+        size_t n = 0;
+        while (*s) {
+                char *end;
+                unsigned long long v = strtoull(s, &end, 10);
+                if (end == s || n == max) {
+                        return -1;
+                }
+                if (*end == 'k' || *end == 'K') {
+                        v *= 1024;
+                        end++;
+                } else if (*end == 'm' || *end == 'M') {
+                        v *= 1024 * 1024;
+                        end++;
+                }
+                if (v == 0 || (*end != ',' && *end != '\0')) {
+                        return -1;
+                }
+                out[n++] = v;
+                s = *end ? end + 1 : end;
+        }
+        return n;
+}
+
+static size_t round_up(size_t x, size_t granule)
+{
+        return (x + granule - 1) / granule * granule;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+        const double x = *(const double*)a;
+        const double y = *(const double*)b;
+        return (x > y) - (x < y);
+}
+
+// nearest rank on sorted samples
+static double percentile(const double sorted[], int n, double q)
+{
+        return sorted[(int)(q * (n - 1) + 0.5)];
+}
+
+static void measure(const struct bench *b, const struct options *opt,
+                    uint8_t *out, const uint8_t *in, size_t len, struct stats *st)
 {
-        srand(time(NULL));
-        benchmark_gift_64();
-        /* benchmark_gift_128(); */
-        /* benchmark_gift_64_table(); */
-        benchmark_gift_64_vec_sbox();
-        /* benchmark_gift_64_vec_sliced(); */
-        /* benchmark_camellia_naive(); */
-        /* benchmark_camellia_spec_opt(); */
-        /* benchmark_camellia_sliced(); */
+        // warm-up: caches, branch predictors, frequency governor; also tells us
+        // how many messages fill a sample of --sample ms
+        size_t calls = 0;
+        const uint64_t t0 = now_ns();
+        uint64_t t1;
+        do {
+                b->run(out, in, len);
+                clobber(out);
+                calls++;
+                t1 = now_ns();
+        } while (t1 - t0 < (uint64_t)opt->warmup_ms * 1000000UL);
+
+        const double ns_per_call = (double)(t1 - t0) / calls;
+        size_t iters = opt->sample_ms * 1000000.0 / ns_per_call;
+        if (iters == 0) {
+                iters = 1;
+        }
+
+        double *samples = malloc(opt->reps * sizeof(double));
+        double *ns = malloc(opt->reps * sizeof(double));
+        for (int r = 0; r < opt->reps; r++) {
+                const uint64_t c0 = opt->timer == TIMER_PERF ? perf_cycles() : 0;
+                const uint64_t s0 = now_ns();
+                for (size_t i = 0; i < iters; i++) {
+                        b->run(out, in, len);
+                        clobber(out);
+                }
+                const uint64_t s1 = now_ns();
+                const uint64_t c1 = opt->timer == TIMER_PERF ? perf_cycles() : 0;
+
+                const double bytes = (double)iters * len;
+                ns[r] = (s1 - s0) / bytes;
+                samples[r] = opt->timer == TIMER_PERF ? (c1 - c0) / bytes : ns[r];
+        }
+
+        qsort(samples, opt->reps, sizeof(double), cmp_double);
+        qsort(ns, opt->reps, sizeof(double), cmp_double);
+
+        st->iters = iters;
+        st->min = samples[0];
+        st->p5 = percentile(samples, opt->reps, 0.05);
+        st->median = percentile(samples, opt->reps, 0.5);
+        st->p95 = percentile(samples, opt->reps, 0.95);
+        st->mib_s = 1e9 / (percentile(ns, opt->reps, 0.5) * 1024 * 1024);
+
+        free(samples);
+        free(ns);
+}
+
+// bytes per block of the cipher, for --per-block
+static size_t block_bytes(const char *cipher)
+{
+        return strcmp(cipher, "gift-64") == 0 ? 8 : 16;
 }
 
-#pragma clang optimize on
+static void print_header(const struct options *opt)
+{
+        switch (opt->format) {
+        case FORMAT_TEXT:
+                if (opt->per_block) {
+                        printf("%-13s %-22s %3s %9s %6s %10s %10s %10s %10s %10s\n",
+                               "cipher", "kernel", "thr", "bytes", "unit",
+                               "min/blk", "p5/blk", "median/blk", "p95/blk", "MiB/s");
+                } else {
+                        printf("%-13s %-22s %3s %9s %6s %10s %10s %10s %10s %10s\n",
+                               "cipher", "kernel", "thr", "bytes", "unit",
+                               "min/B", "p5/B", "median/B", "p95/B", "MiB/s");
+                }
+                break;
+        case FORMAT_CSV:
+                printf("cipher,kernel,threads,bytes,reps,iters,unit,"
+                       "min,p5,median,p95,mib_s\n");
+                break;
+        case FORMAT_JSON:
+                printf("[");
+                break;
+        }
+}
+
+static void print_result(const struct options *opt, const struct bench *b, int threads,
+                         size_t len, const struct stats *st, int first)
+{
+        const char *unit = opt->timer == TIMER_PERF ? "cycles" : "ns";
+        const double scale = opt->per_block ? block_bytes(b->cipher) : 1;
+
+        // per byte unless asked otherwise, the csv/json unit says which (the
+        // text header already does)
+        char unit_buf[16];
+        if (opt->per_block) {
+                snprintf(unit_buf, sizeof(unit_buf), "%s/block", unit);
+                unit = unit_buf;
+        }
+        const double min = st->min * scale, p5 = st->p5 * scale;
+        const double median = st->median * scale, p95 = st->p95 * scale;
+
+        switch (opt->format) {
+        case FORMAT_TEXT:
+                printf("%-13s %-22s %3d %9zu %6s %10.3f %10.3f %10.3f %10.3f %10.2f\n",
+                       b->cipher, b->kernel, threads, len, opt->timer == TIMER_PERF ? "cycles" : "ns",
+                       min, p5, median, p95, st->mib_s);
+                break;
+        case FORMAT_CSV:
+                printf("%s,%s,%d,%zu,%d,%zu,%s,%f,%f,%f,%f,%f\n",
+                       b->cipher, b->kernel, threads, len, opt->reps, st->iters, unit,
+                       min, p5, median, p95, st->mib_s);
+                break;
+        case FORMAT_JSON:
+                printf("%s\n  {\"cipher\": \"%s\", \"kernel\": \"%s\", \"threads\": %d, "
+                       "\"bytes\": %zu, \"reps\": %d, \"iters\": %zu, \"unit\": \"%s\", "
+                       "\"min\": %f, \"p5\": %f, \"median\": %f, \"p95\": %f, \"mib_s\": %f}",
+                       first ? "" : ",", b->cipher, b->kernel, threads, len, opt->reps,
+                       st->iters, unit, min, p5, median, p95, st->mib_s);
+                break;
+        }
+        fflush(stdout);
+}
+
+static void print_footer(const struct options *opt)
+{
+        if (opt->format == FORMAT_JSON) {
+                printf("\n]\n");
+        }
+}
+
+static void usage(const char *name)
+{
+        fprintf(stderr,
+                "usage: %s [options]\n"
+                "  -c, --cipher LIST   ciphers to run, comma separated (default all)\n"
+                "  -k, --kernel LIST   kernels to run, comma separated (default all)\n"
+                "  -s, --size LIST     message sizes in bytes, k/M suffixes (default %s)\n"
+                "  -t, --threads LIST  pool sizes for parallel_* kernels (default 1,<cpus>)\n"
+                "  -r, --reps N        samples per measurement (default %d)\n"
+                "  -w, --warmup MS     warm-up per measurement (default %d)\n"
+                "  -m, --sample MS     target length of one sample (default %d)\n"
+                "  -T, --timer NAME    clock (ns) or perf (cycles) (default clock)\n"
+                "  -f, --format NAME   text, csv or json (default text)\n"
+                "  -p, --pin CPU       pin to a core (pool threads inherit it)\n"
+                "  -S, --seed N        seed for keys and messages (default %d)\n"
+                "  -b, --per-block     report time per cipher block instead of per byte\n"
+                "  -l, --list          list the available benchmarks\n",
+                name, DEFAULT_SIZES, DEFAULT_REPS, DEFAULT_WARMUP_MS, DEFAULT_SAMPLE_MS,
+                DEFAULT_SEED);
+}
+
+int main(int argc, char *argv[])
+{
+        static const struct option long_options[] = {
+                { "cipher",  required_argument, NULL, 'c' },
+                { "kernel",  required_argument, NULL, 'k' },
+                { "size",    required_argument, NULL, 's' },
+                { "threads", required_argument, NULL, 't' },
+                { "reps",    required_argument, NULL, 'r' },
+                { "warmup",  required_argument, NULL, 'w' },
+                { "sample",  required_argument, NULL, 'm' },
+                { "timer",   required_argument, NULL, 'T' },
+                { "format",  required_argument, NULL, 'f' },
+                { "pin",     required_argument, NULL, 'p' },
+                { "seed",    required_argument, NULL, 'S' },
+                { "per-block", no_argument,     NULL, 'b' },
+                { "list",    no_argument,       NULL, 'l' },
+                { "help",    no_argument,       NULL, 'h' },
+                { NULL, 0, NULL, 0 }
+        };
+
+        struct options opt = {
+                .reps = DEFAULT_REPS,
+                .warmup_ms = DEFAULT_WARMUP_MS,
+                .sample_ms = DEFAULT_SAMPLE_MS,
+                .timer = TIMER_CLOCK,
+                .format = FORMAT_TEXT,
+        };
+        opt.nsizes = parse_sizes(opt.sizes, 32, DEFAULT_SIZES);
+        const int cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        opt.threads[0] = 1;
+        opt.threads[1] = cpus;
+        opt.nthreads = cpus > 1 ? 2 : 1;
+        unsigned seed = DEFAULT_SEED;
+        int pin = -1;
+
+        int c;
+        while ((c = getopt_long(argc, argv, "c:k:s:t:r:w:m:T:f:p:S:blh",
+                                long_options, NULL)) != -1) {
+                switch (c) {
+                case 'c':
+                        opt.cipher = optarg;
+                        break;
+                case 'k':
+                        opt.kernel = optarg;
+                        break;
+                case 's': {
+                        const int n = parse_sizes(opt.sizes, 32, optarg);
+                        if (n <= 0) {
+                                fprintf(stderr, "invalid size list '%s'\n", optarg);
+                                return 1;
+                        }
+                        opt.nsizes = n;
+                        break;
+                }
+                case 't': {
+                        size_t sizes[32];
+                        const int n = parse_sizes(sizes, 32, optarg);
+                        if (n <= 0) {
+                                fprintf(stderr, "invalid thread list '%s'\n", optarg);
+                                return 1;
+                        }
+                        for (int i = 0; i < n; i++) {
+                                opt.threads[i] = sizes[i];
+                        }
+                        opt.nthreads = n;
+                        break;
+                }
+                case 'r':
+                        opt.reps = atoi(optarg);
+                        if (opt.reps < 1) {
+                                fprintf(stderr, "need at least one repetition\n");
+                                return 1;
+                        }
+                        break;
+                case 'w':
+                        opt.warmup_ms = atoi(optarg);
+                        break;
+                case 'm':
+                        opt.sample_ms = atoi(optarg);
+                        break;
+                case 'T':
+                        if (strcmp(optarg, "clock") == 0) {
+                                opt.timer = TIMER_CLOCK;
+                        } else if (strcmp(optarg, "perf") == 0) {
+                                opt.timer = TIMER_PERF;
+                        } else {
+                                fprintf(stderr, "unknown timer '%s'\n", optarg);
+                                return 1;
+                        }
+                        break;
+                case 'f':
+                        if (strcmp(optarg, "text") == 0) {
+                                opt.format = FORMAT_TEXT;
+                        } else if (strcmp(optarg, "csv") == 0) {
+                                opt.format = FORMAT_CSV;
+                        } else if (strcmp(optarg, "json") == 0) {
+                                opt.format = FORMAT_JSON;
+                        } else {
+                                fprintf(stderr, "unknown format '%s'\n", optarg);
+                                return 1;
+                        }
+                        break;
+                case 'p':
+                        pin = atoi(optarg);
+                        break;
+                case 'S':
+                        seed = strtoul(optarg, NULL, 0);
+                        break;
+                case 'b':
+                        opt.per_block = 1;
+                        break;
+                case 'l':
+                        for (size_t i = 0; i < NBENCHES; i++) {
+                                if (benches[i].available == NULL || benches[i].available()) {
+                                        printf("%s %s\n", benches[i].cipher, benches[i].kernel);
+                                }
+                        }
+                        return 0;
+                default:
+                        usage(argv[0]);
+                        return c == 'h' ? 0 : 1;
+                }
+        }
+
+        if (pin >= 0) {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(pin, &set);
+                if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+                        perror("sched_setaffinity");
+                        return 1;
+                }
+        }
+
+        // a silent fallback would mix units in the regression data
+        if (opt.timer == TIMER_PERF && perf_open() < 0) {
+                perror("perf_event_open");
+                return 1;
+        }
+
+        srand(seed);
+        rand_bytes((uint8_t*)key, sizeof(key));
+        rand_bytes((uint8_t*)key_256, sizeof(key_256));
+        rand_bytes(key_bytes, sizeof(key_bytes));
+        rand_bytes(nonce, sizeof(nonce));
+        rand_bytes(ad, sizeof(ad));
+
+        size_t max_len = 0;
+        for (size_t i = 0; i < opt.nsizes; i++) {
+                // 4096 is the largest granule (XTS sectors)
+                const size_t len = round_up(opt.sizes[i], 4096);
+                max_len = len > max_len ? len : max_len;
+        }
+        uint8_t *in = aligned_alloc(64, max_len);
+        uint8_t *out = aligned_alloc(64, max_len);
+        rand_bytes(in, max_len);
+
+        print_header(&opt);
+        int first = 1;
+        for (size_t i = 0; i < NBENCHES; i++) {
+                const struct bench *b = &benches[i];
+                if (!in_list(opt.cipher, b->cipher) || !in_list(opt.kernel, b->kernel) ||
+                    (b->available != NULL && !b->available())) {
+                        continue;
+                }
+
+                const size_t nthreads = b->threaded ? opt.nthreads : 1;
+                for (size_t t = 0; t < nthreads; t++) {
+                        bench_threads = b->threaded ? opt.threads[t] : 1;
+                        if (b->setup != NULL) {
+                                b->setup();
+                        }
+
+                        for (size_t s = 0; s < opt.nsizes; s++) {
+                                const size_t len = round_up(opt.sizes[s], b->granule);
+                                struct stats st;
+                                measure(b, &opt, out, in, len, &st);
+                                print_result(&opt, b, bench_threads, len, &st, first);
+                                first = 0;
+                        }
+
+                        if (pool != NULL) {
+                                parallel_pool_destroy(pool);
+                                pool = NULL;
+                        }
+                }
+        }
+        print_footer(&opt);
+
+        free(in);
+        free(out);
+        return 0;
+}
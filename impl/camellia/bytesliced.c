@@ -1,4 +1,4 @@
-#include <arm_neon.h>
+#include "../simd.h"
 #include <stdint.h>
 #include <stddef.h>
 #include <string.h>
@@ -265,13 +265,115 @@ void camellia_sliced_generate_round_keys_128(struct camellia_rks_sliced_128 *res
         }
 }
 
-void camellia_sliced_pack(uint8x16x4_t packed[restrict 4],
-                          const uint64_t x[restrict 16][2])
+// bytesliced pair of subkeys, key a of lane l goes to packed[0..1] and key b
+// to packed[2..3] exactly like the two halves of block l
+static void pack_subkeys(uint8x16x4_t packed[restrict 4],
+                         const uint64_t a[restrict 16], const uint64_t b[restrict 16])
+{
+        uint64_t x[16][2];
+        for (size_t lane = 0; lane < 16; lane++) {
+                x[lane][0] = a[lane];
+                x[lane][1] = b[lane];
+        }
+        camellia_sliced_pack(packed, x);
+}
+
+void camellia_sliced_pack_round_keys_128_multi(struct camellia_rks_sliced_128 *restrict rks,
+                                               const struct camellia_rks_128 *const rks_128[restrict 16])
+{
+        // lane l of every register belongs to block l, so instead of broadcasting
+        // every byte the subkeys of all lanes go through the block packing
+        uint64_t a[16], b[16];
+        uint8x16x4_t packed[4];
+
+        // whitening and FL layer keys
+        for (size_t i = 0; i < 4; i += 2) {
+                for (size_t lane = 0; lane < 16; lane++) {
+                        a[lane] = rks_128[lane]->kw[i];
+                        b[lane] = rks_128[lane]->kw[i + 1];
+                }
+                pack_subkeys(packed, a, b);
+                rks->kw[i][0]     = packed[0];
+                rks->kw[i][1]     = packed[1];
+                rks->kw[i + 1][0] = packed[2];
+                rks->kw[i + 1][1] = packed[3];
+
+                for (size_t lane = 0; lane < 16; lane++) {
+                        a[lane] = rks_128[lane]->kl[i];
+                        b[lane] = rks_128[lane]->kl[i + 1];
+                }
+                pack_subkeys(packed, a, b);
+                rks->kl[i][0]     = packed[0];
+                rks->kl[i][1]     = packed[1];
+                rks->kl[i + 1][0] = packed[2];
+                rks->kl[i + 1][1] = packed[3];
+        }
+
+        // F function keys
+        for (size_t i = 0; i < 18; i += 2) {
+                for (size_t lane = 0; lane < 16; lane++) {
+                        a[lane] = rks_128[lane]->ku[i];
+                        b[lane] = rks_128[lane]->ku[i + 1];
+                }
+                pack_subkeys(packed, a, b);
+                rks->ku[i][0]     = packed[0];
+                rks->ku[i][1]     = packed[1];
+                rks->ku[i + 1][0] = packed[2];
+                rks->ku[i + 1][1] = packed[3];
+        }
+}
+
+void camellia_sliced_generate_round_keys_128_multi(struct camellia_rks_sliced_128 *restrict rks,
+                                                   const uint64_t keys[restrict 16][2])
 {
+        // one standard key derivation per lane
+        struct camellia_rks_128 rks_128[16];
+        const struct camellia_rks_128 *rks_128_ptr[16];
+        for (size_t lane = 0; lane < 16; lane++) {
+                camellia_spec_opt_generate_round_keys_128(&rks_128[lane], keys[lane]);
+                rks_128_ptr[lane] = &rks_128[lane];
+        }
+
+        camellia_sliced_pack_round_keys_128_multi(rks, rks_128_ptr);
+}
+
+void camellia_sliced_generate_round_keys_256(struct camellia_rks_sliced_256 *restrict rks,
+                                             const uint64_t key[restrict 4])
+{
+        struct camellia_rks_256 rks_256;
+        camellia_spec_opt_generate_round_keys_256(&rks_256, key);
+
+        // whitening keys
         for (size_t i = 0; i < 4; i++) {
-                packed[i] = vld1q_u8_x4((uint8_t*)&x[i * 4][0]);
+                for (size_t byte = 0; byte < 8; byte++) {
+                        uint8x16_t *reg_kw = &rks->kw[i][byte / 4].val[byte % 4];
+
+                        *reg_kw = vdupq_n_u8((rks_256.kw[i] >> (8 * byte)) & 0xff);
+                }
+        }
+
+        // FL layer keys, three layers instead of two
+        for (size_t i = 0; i < 6; i++) {
+                for (size_t byte = 0; byte < 8; byte++) {
+                        uint8x16_t *reg_kl = &rks->kl[i][byte / 4].val[byte % 4];
+
+                        *reg_kl = vdupq_n_u8((rks_256.kl[i] >> (8 * byte)) & 0xff);
+                }
         }
 
+        // F function keys
+        for (size_t i = 0; i < 24; i++) {
+                for (size_t byte = 0; byte < 8; byte++) {
+                        uint8x16_t *reg_ku = &rks->ku[i][byte / 4].val[byte % 4];
+
+                        *reg_ku = vdupq_n_u8((rks_256.ku[i] >> (8 * byte)) & 0xff);
+                }
+        }
+}
+
+// packed[i].val[j] holds block 4i+j on entry
+static inline void pack_blocks(uint8x16x4_t packed[restrict 4])
+{
         uint8x16x4_t packed_0[4];
 
         for (size_t i = 0; i < 4; i++) {
@@ -287,10 +389,20 @@ void camellia_sliced_pack(uint8x16x4_t packed[restrict 4],
         }
 }
 
-void camellia_sliced_unpack(uint64_t x[restrict 16][2],
-                            const uint8x16x4_t packed[restrict 4])
+void camellia_sliced_pack(uint8x16x4_t packed[restrict 4],
+                          const uint64_t x[restrict 16][2])
 {
+        for (size_t i = 0; i < 4; i++) {
+                packed[i] = vld1q_u8_x4((uint8_t*)&x[i * 4][0]);
+        }
+
+        pack_blocks(packed);
+}
 
+// blocks[i].val[j] holds block 4i+j on return
+static inline void unpack_blocks(uint8x16x4_t blocks[restrict 4],
+                                 const uint8x16x4_t packed[restrict 4])
+{
         uint8x16x4_t unpacked[4];
         for (size_t i = 0; i < 4; i++) {
                 for (size_t j = 0; j < 4; j++) {
@@ -298,17 +410,22 @@ void camellia_sliced_unpack(uint64_t x[restrict 16][2],
                 }
         }
 
-        uint8x16x4_t unpacked_0[4];
-
         // pack_single_inv = pack_group
         for (size_t i = 0; i < 4; i++) {
                 for (size_t j = 0; j < 4; j++) {
-                        unpacked_0[i].val[j] = vqtbl4q_u8(unpacked[i], pack_group.val[j]);
+                        blocks[i].val[j] = vqtbl4q_u8(unpacked[i], pack_group.val[j]);
                 }
         }
+}
+
+void camellia_sliced_unpack(uint64_t x[restrict 16][2],
+                            const uint8x16x4_t packed[restrict 4])
+{
+        uint8x16x4_t unpacked[4];
+        unpack_blocks(unpacked, packed);
 
         for (size_t i = 0; i < 4; i++) {
-                vst1q_u8_x4((uint8_t*)&x[i * 4][0], unpacked_0[i]);
+                vst1q_u8_x4((uint8_t*)&x[i * 4][0], unpacked[i]);
         }
 }
 
@@ -377,37 +494,36 @@ void camellia_sliced_init(void)
         postfilter_2        = vld1q_u8_x2((uint8_t*)postfilter_2_u64);
 }
 
-void camellia_sliced_encrypt_128(uint64_t c[restrict 16][2],
-                                 const uint64_t m[restrict 16][2],
-                                 struct camellia_rks_sliced_128 *restrict rks)
+// feistel rounds start to end - 1; the FL/FL^-1 layers belong to the start of
+// rounds 6 and 12, the whitening to round 0 and the end of round 17
+static inline void encrypt_128(uint8x16x4_t state[restrict 4],
+                               const struct camellia_rks_sliced_128 *restrict rks,
+                               const int start, const int end)
 {
-        uint8x16x4_t state[4];
-        camellia_sliced_pack(state, m);
+        if (start == end) {
+                return;
+        }
 
         // kw0/kw1
-        for (size_t byte = 0; byte < 16; byte++) {
-                uint8x16_t *reg     = &state[byte / 4].val[byte % 4];
-                uint8x16x4_t *key   = &rks->kw[byte / 8 + 0][(byte % 8) / 4];
-
-                *reg = veorq_u8(*reg, key->val[byte % 4]);
-        }
+        if (start == 0) {
+                for (size_t byte = 0; byte < 16; byte++) {
+                        uint8x16_t *reg     = &state[byte / 4].val[byte % 4];
+                        const uint8x16x4_t *key = &rks->kw[byte / 8 + 0][(byte % 8) / 4];
 
-        for (size_t i = 0; i < 6; i++) {
-                camellia_sliced_feistel_round(state, rks->ku[i + 0]);
+                        *reg = veorq_u8(*reg, key->val[byte % 4]);
+                }
         }
 
-        camellia_sliced_FL(&state[0], rks->kl[0]);
-        camellia_sliced_FL_inv(&state[2], rks->kl[1]);
-
-        for (size_t i = 0; i < 6; i++) {
-                camellia_sliced_feistel_round(state, rks->ku[i + 6]);
+        for (int i = start; i < end; i++) {
+                if (i == 6 || i == 12) {
+                        camellia_sliced_FL(&state[0], rks->kl[i / 3 - 2]);
+                        camellia_sliced_FL_inv(&state[2], rks->kl[i / 3 - 1]);
+                }
+                camellia_sliced_feistel_round(state, rks->ku[i]);
         }
 
-        camellia_sliced_FL(&state[0], rks->kl[2]);
-        camellia_sliced_FL_inv(&state[2], rks->kl[3]);
-
-        for (size_t i = 0; i < 6; i++) {
-                camellia_sliced_feistel_round(state, rks->ku[i + 12]);
+        if (end < CAMELLIA_ROUNDS_128) {
+                return;
         }
 
         // swap state[0,1] and state[2,3] (concatenation of R||L)
@@ -421,25 +537,69 @@ void camellia_sliced_encrypt_128(uint64_t c[restrict 16][2],
         // kw2/kw3
         for (size_t byte = 0; byte < 16; byte++) {
                 uint8x16_t *reg     = &state[byte / 4].val[byte % 4];
-                uint8x16x4_t *key   = &rks->kw[byte / 8 + 2][(byte % 8) / 4];
+                const uint8x16x4_t *key = &rks->kw[byte / 8 + 2][(byte % 8) / 4];
 
                 *reg = veorq_u8(*reg, key->val[byte % 4]);
         }
+}
 
+void camellia_sliced_encrypt_128(uint64_t c[16][2],
+                                 const uint64_t m[16][2],
+                                 const struct camellia_rks_sliced_128 *restrict rks)
+{
+        uint8x16x4_t state[4];
+        camellia_sliced_pack(state, m);
+        encrypt_128(state, rks, 0, CAMELLIA_ROUNDS_128);
         camellia_sliced_unpack(c, state);
 }
 
-void camellia_sliced_decrypt_128(uint64_t m[restrict 16][2],
-                                 const uint64_t c[restrict 16][2],
-                                 struct camellia_rks_sliced_128 *restrict rks)
+void camellia_sliced_encrypt_128_rounds(uint64_t c[16][2],
+                                        const uint64_t m[16][2],
+                                        const struct camellia_rks_sliced_128 *restrict rks,
+                                        const int start, const int end)
 {
         uint8x16x4_t state[4];
-        camellia_sliced_pack(state, c);
+        camellia_sliced_pack(state, m);
+        encrypt_128(state, rks, start, end);
+        camellia_sliced_unpack(c, state);
+}
+
+// block i of the batch from m + i * stride, packed
+static inline void load_strided(uint8x16x4_t state[restrict 4], const uint8_t *m,
+                                const size_t stride)
+{
+        for (size_t i = 0; i < 16; i++) {
+                state[i / 4].val[i % 4] = vld1q_u8(m + i * stride);
+        }
+        pack_blocks(state);
+}
 
+static inline void store_strided(uint8_t *c, const size_t stride,
+                                 const uint8x16x4_t state[restrict 4])
+{
+        uint8x16x4_t blocks[4];
+        unpack_blocks(blocks, state);
+        for (size_t i = 0; i < 16; i++) {
+                vst1q_u8(c + i * stride, blocks[i / 4].val[i % 4]);
+        }
+}
+
+void camellia_sliced_encrypt_128_strided(uint8_t *c, const uint8_t *m, const size_t stride,
+                                         const struct camellia_rks_sliced_128 *restrict rks)
+{
+        uint8x16x4_t state[4];
+        load_strided(state, m, stride);
+        encrypt_128(state, rks, 0, CAMELLIA_ROUNDS_128);
+        store_strided(c, stride, state);
+}
+
+static inline void decrypt_128(uint8x16x4_t state[restrict 4],
+                               const struct camellia_rks_sliced_128 *restrict rks)
+{
         // kw2/kw3
         for (size_t byte = 0; byte < 16; byte++) {
                 uint8x16_t *reg     = &state[byte / 4].val[byte % 4];
-                uint8x16x4_t *key   = &rks->kw[byte / 8 + 2][(byte % 8) / 4];
+                const uint8x16x4_t *key = &rks->kw[byte / 8 + 2][(byte % 8) / 4];
 
                 *reg = veorq_u8(*reg, key->val[byte % 4]);
         }
@@ -474,10 +634,148 @@ void camellia_sliced_decrypt_128(uint64_t m[restrict 16][2],
         // kw0/kw1
         for (size_t byte = 0; byte < 16; byte++) {
                 uint8x16_t *reg     = &state[byte / 4].val[byte % 4];
-                uint8x16x4_t *key   = &rks->kw[byte / 8 + 0][(byte % 8) / 4];
+                const uint8x16x4_t *key = &rks->kw[byte / 8 + 0][(byte % 8) / 4];
 
                 *reg = veorq_u8(*reg, key->val[byte % 4]);
         }
+}
 
+void camellia_sliced_decrypt_128(uint64_t m[16][2],
+                                 const uint64_t c[16][2],
+                                 const struct camellia_rks_sliced_128 *restrict rks)
+{
+        uint8x16x4_t state[4];
+        camellia_sliced_pack(state, c);
+        decrypt_128(state, rks);
         camellia_sliced_unpack(m, state);
 }
+
+void camellia_sliced_decrypt_128_strided(uint8_t *m, const uint8_t *c, const size_t stride,
+                                         const struct camellia_rks_sliced_128 *restrict rks)
+{
+        uint8x16x4_t state[4];
+        load_strided(state, c, stride);
+        decrypt_128(state, rks);
+        store_strided(m, stride, state);
+}
+
+static inline void encrypt_256(uint8x16x4_t state[restrict 4],
+                               const struct camellia_rks_sliced_256 *restrict rks)
+{
+        // kw0/kw1
+        for (size_t byte = 0; byte < 16; byte++) {
+                uint8x16_t *reg     = &state[byte / 4].val[byte % 4];
+                const uint8x16x4_t *key = &rks->kw[byte / 8 + 0][(byte % 8) / 4];
+
+                *reg = veorq_u8(*reg, key->val[byte % 4]);
+        }
+
+        // 24 rounds in blocks of 6, separated by 3 FL layers
+        for (size_t i = 0; i < 6; i++) {
+                camellia_sliced_feistel_round(state, rks->ku[i + 0]);
+        }
+
+        for (size_t layer = 0; layer < 3; layer++) {
+                camellia_sliced_FL(&state[0], rks->kl[2 * layer + 0]);
+                camellia_sliced_FL_inv(&state[2], rks->kl[2 * layer + 1]);
+
+                for (size_t i = 0; i < 6; i++) {
+                        camellia_sliced_feistel_round(state, rks->ku[i + 6 * (layer + 1)]);
+                }
+        }
+
+        // swap state[0,1] and state[2,3] (concatenation of R||L)
+        uint8x16x4_t tmp = state[0];
+        state[0] = state[2];
+        state[2] = tmp;
+        tmp = state[1];
+        state[1] = state[3];
+        state[3] = tmp;
+
+        // kw2/kw3
+        for (size_t byte = 0; byte < 16; byte++) {
+                uint8x16_t *reg     = &state[byte / 4].val[byte % 4];
+                const uint8x16x4_t *key = &rks->kw[byte / 8 + 2][(byte % 8) / 4];
+
+                *reg = veorq_u8(*reg, key->val[byte % 4]);
+        }
+}
+
+static inline void decrypt_256(uint8x16x4_t state[restrict 4],
+                               const struct camellia_rks_sliced_256 *restrict rks)
+{
+        // kw2/kw3
+        for (size_t byte = 0; byte < 16; byte++) {
+                uint8x16_t *reg     = &state[byte / 4].val[byte % 4];
+                const uint8x16x4_t *key = &rks->kw[byte / 8 + 2][(byte % 8) / 4];
+
+                *reg = veorq_u8(*reg, key->val[byte % 4]);
+        }
+
+        // swap state[0,1] and state[2,3] (concatenation of R||L)
+        uint8x16x4_t tmp = state[0];
+        state[0] = state[2];
+        state[2] = tmp;
+        tmp = state[1];
+        state[1] = state[3];
+        state[3] = tmp;
+
+        for (size_t layer = 3; layer --> 0; ) {
+                for (size_t i = 6; i --> 0; ) {
+                        camellia_sliced_feistel_round_inv(state, rks->ku[i + 6 * (layer + 1)]);
+                }
+
+                camellia_sliced_FL(&state[2], rks->kl[2 * layer + 1]);
+                camellia_sliced_FL_inv(&state[0], rks->kl[2 * layer + 0]);
+        }
+
+        for (size_t i = 6; i --> 0; ) {
+                camellia_sliced_feistel_round_inv(state, rks->ku[i + 0]);
+        }
+
+        // kw0/kw1
+        for (size_t byte = 0; byte < 16; byte++) {
+                uint8x16_t *reg     = &state[byte / 4].val[byte % 4];
+                const uint8x16x4_t *key = &rks->kw[byte / 8 + 0][(byte % 8) / 4];
+
+                *reg = veorq_u8(*reg, key->val[byte % 4]);
+        }
+}
+
+void camellia_sliced_encrypt_256(uint64_t c[16][2],
+                                 const uint64_t m[16][2],
+                                 const struct camellia_rks_sliced_256 *restrict rks)
+{
+        uint8x16x4_t state[4];
+        camellia_sliced_pack(state, m);
+        encrypt_256(state, rks);
+        camellia_sliced_unpack(c, state);
+}
+
+void camellia_sliced_decrypt_256(uint64_t m[16][2],
+                                 const uint64_t c[16][2],
+                                 const struct camellia_rks_sliced_256 *restrict rks)
+{
+        uint8x16x4_t state[4];
+        camellia_sliced_pack(state, c);
+        decrypt_256(state, rks);
+        camellia_sliced_unpack(m, state);
+}
+
+void camellia_sliced_encrypt_256_strided(uint8_t *c, const uint8_t *m, const size_t stride,
+                                         const struct camellia_rks_sliced_256 *restrict rks)
+{
+        uint8x16x4_t state[4];
+        load_strided(state, m, stride);
+        encrypt_256(state, rks);
+        store_strided(c, stride, state);
+}
+
+void camellia_sliced_decrypt_256_strided(uint8_t *m, const uint8_t *c, const size_t stride,
+                                         const struct camellia_rks_sliced_256 *restrict rks)
+{
+        uint8x16x4_t state[4];
+        load_strided(state, c, stride);
+        decrypt_256(state, rks);
+        store_strided(m, stride, state);
+}
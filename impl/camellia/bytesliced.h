@@ -1,10 +1,11 @@
 #pragma once
 
-// 128-bit bitsliced camellia with 16 blocks encrypted in parallel
+// 128-bit and 256-bit bitsliced camellia with 16 blocks encrypted in parallel
 
 
 #include <stdint.h>
-#include <arm_neon.h>
+#include <stddef.h>
+#include "../simd.h"
 
 #include "camellia_keys.h"
 
@@ -22,6 +23,14 @@ void camellia_sliced_feistel_round_inv(uint8x16x4_t state[restrict 4],
                                        const uint8x16x4_t kr[restrict 2]);
 void camellia_sliced_generate_round_keys_128(struct camellia_rks_sliced_128 *restrict rks,
                                              const uint64_t key[2]);
+// keys[l] is used for block l of camellia_sliced_encrypt_128/decrypt_128, the
+// pack variant only transposes schedules the caller already expanded
+void camellia_sliced_pack_round_keys_128_multi(struct camellia_rks_sliced_128 *restrict rks,
+                                               const struct camellia_rks_128 *const rks_128[restrict 16]);
+void camellia_sliced_generate_round_keys_128_multi(struct camellia_rks_sliced_128 *restrict rks,
+                                                   const uint64_t keys[restrict 16][2]);
+void camellia_sliced_generate_round_keys_256(struct camellia_rks_sliced_256 *restrict rks,
+                                             const uint64_t key[4]);
 
 void camellia_sliced_pack(uint8x16x4_t packed[restrict 4],
                           const uint64_t x[restrict 16][2]);
@@ -29,12 +38,48 @@ void camellia_sliced_pack(uint8x16x4_t packed[restrict 4],
 void camellia_sliced_unpack(uint64_t x[restrict 16][2],
                             const uint8x16x4_t packed[restrict 4]);
 
+// feistel rounds of the 128-bit key schedule
+#define CAMELLIA_ROUNDS_128 18
+
 void camellia_sliced_init(void);
 
-void camellia_sliced_encrypt_128(uint64_t c[restrict 16][2],
-                                 const uint64_t m[restrict 16][2],
-                                 struct camellia_rks_sliced_128 *restrict rks);
+// c may equal m, all blocks are loaded before the first one is stored
+void camellia_sliced_encrypt_128(uint64_t c[16][2],
+                                 const uint64_t m[16][2],
+                                 const struct camellia_rks_sliced_128 *restrict rks);
+
+// feistel rounds start to end - 1 of CAMELLIA_ROUNDS_128, for reduced-round
+// analysis. the FL/FL^-1 layers run before rounds 6 and 12, kw0/kw1 only with
+// start 0 and the final swap and kw2/kw3 only with end 18 (an empty range does
+// nothing), so [a, b) followed by [b, c) is [a, c); in between c holds L || R
+void camellia_sliced_encrypt_128_rounds(uint64_t c[16][2],
+                                        const uint64_t m[16][2],
+                                        const struct camellia_rks_sliced_128 *restrict rks,
+                                        int start, int end);
+
+void camellia_sliced_decrypt_128(uint64_t m[16][2],
+                                 const uint64_t c[16][2],
+                                 const struct camellia_rks_sliced_128 *restrict rks);
+
+// block i at m + i * stride (c + i * stride) with no alignment needed, so
+// blocks can be encrypted inside larger records; c may equal m as well
+void camellia_sliced_encrypt_128_strided(uint8_t *c, const uint8_t *m, size_t stride,
+                                         const struct camellia_rks_sliced_128 *restrict rks);
+
+void camellia_sliced_decrypt_128_strided(uint8_t *m, const uint8_t *c, size_t stride,
+                                         const struct camellia_rks_sliced_128 *restrict rks);
+
+// same in-place and strided forms as the 128-bit kernels
+void camellia_sliced_encrypt_256(uint64_t c[16][2],
+                                 const uint64_t m[16][2],
+                                 const struct camellia_rks_sliced_256 *restrict rks);
+
+void camellia_sliced_decrypt_256(uint64_t m[16][2],
+                                 const uint64_t c[16][2],
+                                 const struct camellia_rks_sliced_256 *restrict rks);
+
+void camellia_sliced_encrypt_256_strided(uint8_t *c, const uint8_t *m, size_t stride,
+                                         const struct camellia_rks_sliced_256 *restrict rks);
 
-void camellia_sliced_decrypt_128(uint64_t m[restrict 16][2],
-                                 const uint64_t c[restrict 16][2],
-                                 struct camellia_rks_sliced_128 *restrict rks);
+void camellia_sliced_decrypt_256_strided(uint8_t *m, const uint8_t *c, size_t stride,
+                                         const struct camellia_rks_sliced_256 *restrict rks);
@@ -0,0 +1,430 @@
+#include <stdint.h>
+#include <stddef.h>
+
+#include "bytesliced_avx2.h"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+typedef struct { __m256i val[4]; } uint8x32x4_t;
+
+// a four-register tbl becomes four pshufb, one per source register
+static __m256i pack_group[4][4];
+static __m256i pack_group_inv[4][4];
+static __m256i pack_single[4][4];
+
+static __m256i lower_4_bits_mask;
+static __m256i shiftrows_inv;
+
+// store two for low ([0]) and high ([1]) bits of matrix multiplication
+static __m256i prefilter_0[2];
+static __m256i prefilter_3[2];  // s3(x) = s0(x <<< 1)
+static __m256i postfilter_0[2];
+static __m256i postfilter_1[2]; // s1(x) = s0(x) <<< 1
+static __m256i postfilter_2[2]; // s2(x) = s0(x) >>> 1
+
+static inline __m256i tbl4(const uint8x32x4_t t, const __m256i idx[4])
+{
+        return _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(t.val[0], idx[0]),
+                                               _mm256_shuffle_epi8(t.val[1], idx[1])),
+                               _mm256_or_si256(_mm256_shuffle_epi8(t.val[2], idx[2]),
+                                               _mm256_shuffle_epi8(t.val[3], idx[3])));
+}
+
+static inline __m256i round_key(const uint8x16_t k)
+{
+        return _mm256_broadcastsi128_si256(k);
+}
+
+static void rol32_1(uint8x32x4_t *a)
+{
+        const __m256i a3 = a->val[3];
+        const __m256i low_bit = _mm256_set1_epi8(0x01);
+
+        // byte shifts by one through 16-bit lanes
+        for (size_t i = 3; i > 0; i--) {
+                const __m256i overflow = _mm256_and_si256(_mm256_srli_epi16(a->val[i - 1], 7), low_bit);
+                a->val[i] = _mm256_or_si256(_mm256_add_epi8(a->val[i], a->val[i]), overflow);
+        }
+
+        const __m256i overflow = _mm256_and_si256(_mm256_srli_epi16(a3, 7), low_bit);
+        a->val[0] = _mm256_or_si256(_mm256_add_epi8(a->val[0], a->val[0]), overflow);
+}
+
+static inline __m256i aesenclast_zero(const __m256i x)
+{
+#ifdef __VAES__
+        return _mm256_aesenclast_epi128(x, _mm256_setzero_si256());
+#else
+        const __m128i lo = _mm_aesenclast_si128(_mm256_castsi256_si128(x), _mm_setzero_si128());
+        const __m128i hi = _mm_aesenclast_si128(_mm256_extracti128_si256(x, 1), _mm_setzero_si128());
+        return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+#endif
+}
+
+static __m256i s(const __m256i X, const __m256i prefilter[2], const __m256i postfilter[2])
+{
+        // prefilter
+        const __m256i pre_low  = _mm256_shuffle_epi8(prefilter[0],
+                                                     _mm256_and_si256(X, lower_4_bits_mask));
+        const __m256i pre_high = _mm256_shuffle_epi8(prefilter[1],
+                                                     _mm256_and_si256(_mm256_srli_epi16(X, 4),
+                                                                      lower_4_bits_mask));
+        __m256i pre = _mm256_xor_si256(pre_low, pre_high);
+
+        // inverse ShiftRows
+        pre = _mm256_shuffle_epi8(pre, shiftrows_inv);
+
+        // AES last round with zero key (x <- AESSubBytes(AESShiftRows(x)))
+        const __m256i aes = aesenclast_zero(pre);
+
+        // postfilter
+        const __m256i post_low  = _mm256_shuffle_epi8(postfilter[0],
+                                                      _mm256_and_si256(aes, lower_4_bits_mask));
+        const __m256i post_high = _mm256_shuffle_epi8(postfilter[1],
+                                                      _mm256_and_si256(_mm256_srli_epi16(aes, 4),
+                                                                       lower_4_bits_mask));
+
+        return _mm256_xor_si256(post_low, post_high);
+}
+
+static void F(uint8x32x4_t X[restrict 2], const uint8x16x4_t k[restrict 2])
+{
+        // key additions
+        for (size_t byte = 0; byte < 8; byte++) {
+                __m256i *reg = &X[byte / 4].val[byte % 4];
+
+                *reg = _mm256_xor_si256(*reg, round_key(k[byte / 4].val[byte % 4]));
+        }
+
+        // S-boxes (beware of endianness)
+        X[1].val[3] = s(X[1].val[3], prefilter_0, postfilter_0); // s0
+        X[1].val[2] = s(X[1].val[2], prefilter_0, postfilter_1); // s1
+        X[1].val[1] = s(X[1].val[1], prefilter_0, postfilter_2); // s2
+        X[1].val[0] = s(X[1].val[0], prefilter_3, postfilter_0); // s3
+        X[0].val[3] = s(X[0].val[3], prefilter_0, postfilter_1); // s1
+        X[0].val[2] = s(X[0].val[2], prefilter_0, postfilter_2); // s2
+        X[0].val[1] = s(X[0].val[1], prefilter_3, postfilter_0); // s3
+        X[0].val[0] = s(X[0].val[0], prefilter_0, postfilter_0); // s0
+
+        // permutation
+        X[1].val[3] = _mm256_xor_si256(X[1].val[3], X[0].val[2]);
+        X[1].val[2] = _mm256_xor_si256(X[1].val[2], X[0].val[1]);
+        X[1].val[1] = _mm256_xor_si256(X[1].val[1], X[0].val[0]);
+        X[1].val[0] = _mm256_xor_si256(X[1].val[0], X[0].val[3]);
+        X[0].val[3] = _mm256_xor_si256(X[0].val[3], X[1].val[1]);
+        X[0].val[2] = _mm256_xor_si256(X[0].val[2], X[1].val[0]);
+        X[0].val[1] = _mm256_xor_si256(X[0].val[1], X[1].val[3]);
+        X[0].val[0] = _mm256_xor_si256(X[0].val[0], X[1].val[2]);
+
+        X[1].val[3] = _mm256_xor_si256(X[1].val[3], X[0].val[0]);
+        X[1].val[2] = _mm256_xor_si256(X[1].val[2], X[0].val[3]);
+        X[1].val[1] = _mm256_xor_si256(X[1].val[1], X[0].val[2]);
+        X[1].val[0] = _mm256_xor_si256(X[1].val[0], X[0].val[1]);
+        X[0].val[3] = _mm256_xor_si256(X[0].val[3], X[1].val[0]);
+        X[0].val[2] = _mm256_xor_si256(X[0].val[2], X[1].val[3]);
+        X[0].val[1] = _mm256_xor_si256(X[0].val[1], X[1].val[2]);
+        X[0].val[0] = _mm256_xor_si256(X[0].val[0], X[1].val[1]);
+
+        // X[0] and X[1] are swapped now; this is
+        // taken into account in the feistel round
+}
+
+static void FL(uint8x32x4_t X[restrict 2], const uint8x16x4_t kl[restrict 2])
+{
+        const uint8x32x4_t XL = X[1];
+        const uint8x32x4_t XR = X[0];
+
+        uint8x32x4_t YR;
+        for (size_t j = 0; j < 4; j++) {
+                YR.val[j] = _mm256_and_si256(XL.val[j], round_key(kl[1].val[j]));
+        }
+
+        rol32_1(&YR);
+
+        for (size_t j = 0; j < 4; j++) {
+                YR.val[j] = _mm256_xor_si256(YR.val[j], XR.val[j]);
+                X[1].val[j] = _mm256_xor_si256(_mm256_or_si256(YR.val[j], round_key(kl[0].val[j])),
+                                               XL.val[j]);
+        }
+
+        X[0] = YR;
+}
+
+static void FL_inv(uint8x32x4_t Y[restrict 2], const uint8x16x4_t kl[restrict 2])
+{
+        const uint8x32x4_t YL = Y[1];
+        const uint8x32x4_t YR = Y[0];
+
+        uint8x32x4_t XL, XR;
+        for (size_t j = 0; j < 4; j++) {
+                XL.val[j] = _mm256_xor_si256(_mm256_or_si256(YR.val[j], round_key(kl[0].val[j])),
+                                             YL.val[j]);
+                XR.val[j] = _mm256_and_si256(XL.val[j], round_key(kl[1].val[j]));
+        }
+
+        rol32_1(&XR);
+
+        for (size_t j = 0; j < 4; j++) {
+                XR.val[j] = _mm256_xor_si256(XR.val[j], YR.val[j]);
+        }
+
+        Y[0] = XR;
+        Y[1] = XL;
+}
+
+static void feistel_round(uint8x32x4_t state[restrict 4], const uint8x16x4_t kr[restrict 2])
+{
+        uint8x32x4_t X[2] = { state[0], state[1] };
+
+        // F function swaps result
+        F(X, kr);
+
+        for (size_t j = 0; j < 4; j++) {
+                X[0].val[j] = _mm256_xor_si256(state[3].val[j], X[0].val[j]);
+                X[1].val[j] = _mm256_xor_si256(state[2].val[j], X[1].val[j]);
+        }
+
+        state[2] = state[0];
+        state[3] = state[1];
+        state[0] = X[1];
+        state[1] = X[0];
+}
+
+static void feistel_round_inv(uint8x32x4_t state[restrict 4], const uint8x16x4_t kr[restrict 2])
+{
+        uint8x32x4_t X[2] = { state[2], state[3] };
+
+        // F function swaps result
+        F(X, kr);
+
+        for (size_t j = 0; j < 4; j++) {
+                X[0].val[j] = _mm256_xor_si256(state[1].val[j], X[0].val[j]);
+                X[1].val[j] = _mm256_xor_si256(state[0].val[j], X[1].val[j]);
+        }
+
+        state[0] = state[2];
+        state[1] = state[3];
+        state[2] = X[1];
+        state[3] = X[0];
+}
+
+// lane 0 holds the even and lane 1 the odd blocks, within a lane the layout
+// is that of camellia_sliced_pack
+static void pack(uint8x32x4_t packed[restrict 4], const uint64_t x[restrict 32][2])
+{
+        for (size_t i = 0; i < 4; i++) {
+                for (size_t j = 0; j < 4; j++) {
+                        packed[i].val[j] = _mm256_loadu_si256((const __m256i*)&x[(i * 4 + j) * 2][0]);
+                }
+        }
+
+        uint8x32x4_t packed_0[4];
+
+        for (size_t i = 0; i < 4; i++) {
+                for (size_t j = 0; j < 4; j++) {
+                        packed_0[i].val[j] = tbl4(packed[j], pack_group[i]);
+                }
+        }
+
+        for (size_t i = 0; i < 4; i++) {
+                for (size_t j = 0; j < 4; j++) {
+                        packed[i].val[j] = tbl4(packed_0[i], pack_single[j]);
+                }
+        }
+}
+
+static void unpack(uint64_t x[restrict 32][2], const uint8x32x4_t packed[restrict 4])
+{
+        uint8x32x4_t unpacked[4];
+        for (size_t i = 0; i < 4; i++) {
+                for (size_t j = 0; j < 4; j++) {
+                        unpacked[i].val[j] = tbl4(packed[j], pack_group_inv[i]);
+                }
+        }
+
+        // pack_single_inv = pack_group
+        for (size_t i = 0; i < 4; i++) {
+                for (size_t j = 0; j < 4; j++) {
+                        const __m256i b = tbl4(unpacked[i], pack_group[j]);
+                        _mm256_storeu_si256((__m256i*)&x[(i * 4 + j) * 2][0], b);
+                }
+        }
+}
+
+static void add_whitening(uint8x32x4_t state[restrict 4],
+                          const struct camellia_rks_sliced_128 *restrict rks, const size_t kw)
+{
+        for (size_t byte = 0; byte < 16; byte++) {
+                __m256i *reg = &state[byte / 4].val[byte % 4];
+                const uint8x16_t key = rks->kw[byte / 8 + kw][(byte % 8) / 4].val[byte % 4];
+
+                *reg = _mm256_xor_si256(*reg, round_key(key));
+        }
+}
+
+static void swap_halves(uint8x32x4_t state[restrict 4])
+{
+        // swap state[0,1] and state[2,3] (concatenation of R||L)
+        uint8x32x4_t tmp = state[0];
+        state[0] = state[2];
+        state[2] = tmp;
+        tmp = state[1];
+        state[1] = state[3];
+        state[3] = tmp;
+}
+
+static void split_tbl4(__m256i idx[4], const uint64_t table[2])
+{
+        const __m256i t = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)table));
+
+        // out of range indices get bit 7 set, pshufb clears those
+        for (int k = 0; k < 4; k++) {
+                idx[k] = _mm256_adds_epu8(_mm256_sub_epi8(t, _mm256_set1_epi8(16 * k)),
+                                          _mm256_set1_epi8(0x70));
+        }
+}
+
+static void load_filter(__m256i filter[2], const uint64_t table[2][2])
+{
+        filter[0] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)table[0]));
+        filter[1] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)table[1]));
+}
+
+void camellia_sliced_avx2_init(void)
+{
+        // same tables as bytesliced.c
+        static const uint64_t pack_group_u64[4][2] = {
+                { 0x1312111003020100UL, 0x3332313023222120UL },
+                { 0x1716151407060504UL, 0x3736353427262524UL },
+                { 0x1b1a19180b0a0908UL, 0x3b3a39382b2a2928UL },
+                { 0x1f1e1d1c0f0e0d0cUL, 0x3f3e3d3c2f2e2d2cUL },
+        };
+
+        static const uint64_t pack_group_inv_u64[4][2] = {
+                { 0x3121110130201000UL, 0x3323130332221202UL },
+                { 0x3525150534241404UL, 0x3727170736261606UL },
+                { 0x3929190938281808UL, 0x3b2b1b0b3a2a1a0aUL },
+                { 0x3d2d1d0d3c2c1c0cUL, 0x3f2f1f0f3e2e1e0eUL }
+        };
+
+        static const uint64_t pack_single_u64[4][2] = {
+                { 0x1c1814100c080400UL, 0x3c3834302c282420UL },
+                { 0x1d1915110d090501UL, 0x3d3935312d292521UL },
+                { 0x1e1a16120e0a0602UL, 0x3e3a36322e2a2622UL },
+                { 0x1f1b17130f0b0703UL, 0x3f3b37332f2b2723UL },
+        };
+
+        static const uint64_t shiftrows_inv_u64[2] = {
+                0x0b0e0104070a0d00UL, 0x0306090c0f020508UL };
+
+        static const uint64_t prefilter_0_u64[2][2] = {
+                { 0x862b832eed40e845UL, 0x88258d20e34ee64bUL },
+                { 0x2a7bdb8aa0f15100UL, 0x2372d283a9f85809UL } };
+
+        static const uint64_t prefilter_3_u64[2][2] = {
+                { 0x25204e4b2b2e4045UL, 0x74711f1a7a7f1114UL },
+                { 0x7283f8097b8af100UL, 0xdf2e55a4d6275cadUL } };
+
+        static const uint64_t postfilter_0_u64[2][2] = {
+                { 0x31c1c2323fcfcc3cUL, 0xd12122d2df2f2cdcUL },
+                { 0xa8512ed77f86f900UL, 0x0cf58a73db225da4UL } };
+
+        static const uint64_t postfilter_1_u64[2][2] = {
+                { 0x628385647e9f9978UL, 0xa34244a5bf5e58b9UL },
+                { 0x51a25caffe0df300UL, 0x18eb15e6b744ba49UL } };
+
+        static const uint64_t postfilter_2_u64[2][2] = {
+                { 0x98e061199fe7661eUL, 0xe8901169ef97166eUL },
+                { 0x54a817ebbf43fc00UL, 0x06fa45b9ed11ae52UL } };
+
+        for (size_t i = 0; i < 4; i++) {
+                split_tbl4(pack_group[i], pack_group_u64[i]);
+                split_tbl4(pack_group_inv[i], pack_group_inv_u64[i]);
+                split_tbl4(pack_single[i], pack_single_u64[i]);
+        }
+
+        lower_4_bits_mask = _mm256_set1_epi8(0x0f);
+        shiftrows_inv = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)shiftrows_inv_u64));
+
+        load_filter(prefilter_0, prefilter_0_u64);
+        load_filter(prefilter_3, prefilter_3_u64);
+        load_filter(postfilter_0, postfilter_0_u64);
+        load_filter(postfilter_1, postfilter_1_u64);
+        load_filter(postfilter_2, postfilter_2_u64);
+}
+
+void camellia_sliced_avx2_encrypt_128(uint64_t c[32][2],
+                                      const uint64_t m[32][2],
+                                      const struct camellia_rks_sliced_128 *restrict rks)
+{
+        uint8x32x4_t state[4];
+        pack(state, m);
+
+        // kw0/kw1
+        add_whitening(state, rks, 0);
+
+        for (size_t i = 0; i < 6; i++) {
+                feistel_round(state, rks->ku[i + 0]);
+        }
+
+        FL(&state[0], rks->kl[0]);
+        FL_inv(&state[2], rks->kl[1]);
+
+        for (size_t i = 0; i < 6; i++) {
+                feistel_round(state, rks->ku[i + 6]);
+        }
+
+        FL(&state[0], rks->kl[2]);
+        FL_inv(&state[2], rks->kl[3]);
+
+        for (size_t i = 0; i < 6; i++) {
+                feistel_round(state, rks->ku[i + 12]);
+        }
+
+        swap_halves(state);
+
+        // kw2/kw3
+        add_whitening(state, rks, 2);
+
+        unpack(c, state);
+}
+
+void camellia_sliced_avx2_decrypt_128(uint64_t m[32][2],
+                                      const uint64_t c[32][2],
+                                      const struct camellia_rks_sliced_128 *restrict rks)
+{
+        uint8x32x4_t state[4];
+        pack(state, c);
+
+        // kw2/kw3
+        add_whitening(state, rks, 2);
+
+        swap_halves(state);
+
+        for (size_t i = 6; i --> 0; ) {
+                feistel_round_inv(state, rks->ku[i + 12]);
+        }
+
+        FL(&state[2], rks->kl[3]);
+        FL_inv(&state[0], rks->kl[2]);
+
+        for (size_t i = 6; i --> 0; ) {
+                feistel_round_inv(state, rks->ku[i + 6]);
+        }
+
+        FL(&state[2], rks->kl[1]);
+        FL_inv(&state[0], rks->kl[0]);
+
+        for (size_t i = 6; i --> 0; ) {
+                feistel_round_inv(state, rks->ku[i + 0]);
+        }
+
+        // kw0/kw1
+        add_whitening(state, rks, 0);
+
+        unpack(m, state);
+}
+
+#endif
@@ -0,0 +1,24 @@
+#pragma once
+
+// 128-bit bytesliced camellia with 32 blocks encrypted in parallel on AVX2;
+// each 128-bit lane runs the bytesliced.c algorithm on 16 blocks of its own,
+// so the round keys of camellia_sliced_generate_round_keys_128 are reused
+
+#include <stdint.h>
+
+#include "camellia_keys.h"
+
+#ifdef __AVX2__
+
+void camellia_sliced_avx2_init(void);
+
+// c may equal m, all blocks are loaded before the first one is stored
+void camellia_sliced_avx2_encrypt_128(uint64_t c[32][2],
+                                      const uint64_t m[32][2],
+                                      const struct camellia_rks_sliced_128 *restrict rks);
+
+void camellia_sliced_avx2_decrypt_128(uint64_t m[32][2],
+                                      const uint64_t c[32][2],
+                                      const struct camellia_rks_sliced_128 *restrict rks);
+
+#endif
@@ -0,0 +1,282 @@
+#include <stdint.h>
+#include <stddef.h>
+
+#include "bytesliced_sha3.h"
+#include "bytesliced.h"
+
+#ifdef __ARM_FEATURE_SHA3
+
+static uint8x16_t lower_4_bits_mask;
+static uint8x16_t shiftrows_inv;
+
+// same tables as bytesliced.c
+static uint8x16x2_t prefilter_0;
+static uint8x16x2_t prefilter_3;  // s3(x) = s0(x <<< 1)
+static uint8x16x2_t postfilter_0;
+static uint8x16x2_t postfilter_1; // s1(x) = s0(x) <<< 1
+static uint8x16x2_t postfilter_2; // s2(x) = s0(x) >>> 1
+
+void camellia_sliced_sha3_init(void)
+{
+        static const uint64_t shiftrows_inv_u64[2] = {
+                0x0b0e0104070a0d00UL, 0x0306090c0f020508UL };
+
+        static const uint64_t prefilter_0_u64[2][2] = {
+                { 0x862b832eed40e845UL, 0x88258d20e34ee64bUL },
+                { 0x2a7bdb8aa0f15100UL, 0x2372d283a9f85809UL } };
+
+        static const uint64_t prefilter_3_u64[2][2] = {
+                { 0x25204e4b2b2e4045UL, 0x74711f1a7a7f1114UL },
+                { 0x7283f8097b8af100UL, 0xdf2e55a4d6275cadUL } };
+
+        static const uint64_t postfilter_0_u64[2][2] = {
+                { 0x31c1c2323fcfcc3cUL, 0xd12122d2df2f2cdcUL },
+                { 0xa8512ed77f86f900UL, 0x0cf58a73db225da4UL } };
+
+        static const uint64_t postfilter_1_u64[2][2] = {
+                { 0x628385647e9f9978UL, 0xa34244a5bf5e58b9UL },
+                { 0x51a25caffe0df300UL, 0x18eb15e6b744ba49UL } };
+
+        static const uint64_t postfilter_2_u64[2][2] = {
+                { 0x98e061199fe7661eUL, 0xe8901169ef97166eUL },
+                { 0x54a817ebbf43fc00UL, 0x06fa45b9ed11ae52UL } };
+
+        lower_4_bits_mask   = vdupq_n_u8(0x0f);
+        shiftrows_inv       = vld1q_u8((const uint8_t*)shiftrows_inv_u64);
+
+        prefilter_0         = vld1q_u8_x2((const uint8_t*)prefilter_0_u64);
+        prefilter_3         = vld1q_u8_x2((const uint8_t*)prefilter_3_u64);
+        postfilter_0        = vld1q_u8_x2((const uint8_t*)postfilter_0_u64);
+        postfilter_1        = vld1q_u8_x2((const uint8_t*)postfilter_1_u64);
+        postfilter_2        = vld1q_u8_x2((const uint8_t*)postfilter_2_u64);
+}
+
+static inline uint8x16_t s(const uint8x16_t X,
+                           const uint8x16x2_t prefilter,
+                           const uint8x16x2_t postfilter)
+{
+        // prefilter
+        const uint8x16_t pre_low  = vqtbl1q_u8(prefilter.val[0], vandq_u8(X, lower_4_bits_mask));
+        const uint8x16_t pre_high = vqtbl1q_u8(prefilter.val[1], vshrq_n_u8(X, 4));
+
+        // inverse ShiftRows
+        const uint8x16_t pre = vqtbl1q_u8(veorq_u8(pre_low, pre_high), shiftrows_inv);
+
+        // AES single round encryption (x <- AESSubBytes(AESShiftRows(x)))
+        const uint8x16_t aesd = vaeseq_u8(pre, vdupq_n_u8(0x0));
+
+        // postfilter
+        const uint8x16_t post_low  = vqtbl1q_u8(postfilter.val[0], vandq_u8(aesd, lower_4_bits_mask));
+        const uint8x16_t post_high = vqtbl1q_u8(postfilter.val[1], vshrq_n_u8(aesd, 4));
+
+        return veorq_u8(post_low, post_high);
+}
+
+// camellia_sliced_F on X followed by the XOR with the other half of the
+// state, Y[0] = F(X)[0] ^ T0 and Y[1] = F(X)[1] ^ T1; the 16 dependent XORs
+// of the permutation (a = X[0], b = X[1]) expand to
+//   p0 = a0 ^ b2 ^ a1    q3 = b3 ^ a2 ^ p0    Y[0].val[0] = p0 ^ q1 ^ T0.val[0]
+//   p1 = a1 ^ b3 ^ a2    q2 = b2 ^ a1 ^ p3    Y[0].val[1] = p1 ^ q2 ^ T0.val[1]
+//   p2 = a2 ^ b0 ^ a3    q1 = b1 ^ a0 ^ p2    Y[0].val[2] = p2 ^ q3 ^ T0.val[2]
+//   p3 = a3 ^ b1 ^ a0    q0 = b0 ^ a3 ^ p1    Y[0].val[3] = p3 ^ q0 ^ T0.val[3]
+// and Y[1].val[j] = qj ^ T1.val[j], 16 instructions instead of 24
+static inline void F_xor(uint8x16x4_t Y[restrict 2],
+                         const uint8x16x4_t X[restrict 2],
+                         const uint8x16x4_t k[restrict 2],
+                         const uint8x16x4_t *restrict T0,
+                         const uint8x16x4_t *restrict T1)
+{
+        // key additions and S-boxes (beware of endianness)
+        const uint8x16_t b3 = s(veorq_u8(X[1].val[3], k[1].val[3]), prefilter_0, postfilter_0); // s0
+        const uint8x16_t b2 = s(veorq_u8(X[1].val[2], k[1].val[2]), prefilter_0, postfilter_1); // s1
+        const uint8x16_t b1 = s(veorq_u8(X[1].val[1], k[1].val[1]), prefilter_0, postfilter_2); // s2
+        const uint8x16_t b0 = s(veorq_u8(X[1].val[0], k[1].val[0]), prefilter_3, postfilter_0); // s3
+        const uint8x16_t a3 = s(veorq_u8(X[0].val[3], k[0].val[3]), prefilter_0, postfilter_1); // s1
+        const uint8x16_t a2 = s(veorq_u8(X[0].val[2], k[0].val[2]), prefilter_0, postfilter_2); // s2
+        const uint8x16_t a1 = s(veorq_u8(X[0].val[1], k[0].val[1]), prefilter_3, postfilter_0); // s3
+        const uint8x16_t a0 = s(veorq_u8(X[0].val[0], k[0].val[0]), prefilter_0, postfilter_0); // s0
+
+        // permutation
+        const uint8x16_t p0 = veor3q_u8(a0, b2, a1);
+        const uint8x16_t p1 = veor3q_u8(a1, b3, a2);
+        const uint8x16_t p2 = veor3q_u8(a2, b0, a3);
+        const uint8x16_t p3 = veor3q_u8(a3, b1, a0);
+
+        const uint8x16_t q3 = veor3q_u8(b3, a2, p0);
+        const uint8x16_t q2 = veor3q_u8(b2, a1, p3);
+        const uint8x16_t q1 = veor3q_u8(b1, a0, p2);
+        const uint8x16_t q0 = veor3q_u8(b0, a3, p1);
+
+        Y[0].val[0] = veor3q_u8(p0, q1, T0->val[0]);
+        Y[0].val[1] = veor3q_u8(p1, q2, T0->val[1]);
+        Y[0].val[2] = veor3q_u8(p2, q3, T0->val[2]);
+        Y[0].val[3] = veor3q_u8(p3, q0, T0->val[3]);
+
+        Y[1].val[0] = veorq_u8(q0, T1->val[0]);
+        Y[1].val[1] = veorq_u8(q1, T1->val[1]);
+        Y[1].val[2] = veorq_u8(q2, T1->val[2]);
+        Y[1].val[3] = veorq_u8(q3, T1->val[3]);
+}
+
+static inline void feistel_round(uint8x16x4_t state[restrict 4],
+                                 const uint8x16x4_t kr[restrict 2])
+{
+        uint8x16x4_t F[2];
+
+        // F function swaps result
+        F_xor(F, &state[0], kr, &state[3], &state[2]);
+
+        state[2] = state[0];
+        state[3] = state[1];
+        state[0] = F[1];
+        state[1] = F[0];
+}
+
+static inline void feistel_round_inv(uint8x16x4_t state[restrict 4],
+                                     const uint8x16x4_t kr[restrict 2])
+{
+        uint8x16x4_t F[2];
+
+        // F function swaps result
+        F_xor(F, &state[2], kr, &state[1], &state[0]);
+
+        state[0] = state[2];
+        state[1] = state[3];
+        state[2] = F[1];
+        state[3] = F[0];
+}
+
+// the halves of rol32_1 never overlap, so the OR and the XOR that follows
+// it are a single EOR3: ((a_j << 1) | (a_j-1 >> 7)) ^ x_j
+static inline uint8x16_t rol_xor(const uint8x16x4_t a, const size_t j, const uint8x16_t x)
+{
+        return veor3q_u8(vshlq_n_u8(a.val[j], 1), vshrq_n_u8(a.val[(j + 3) % 4], 7), x);
+}
+
+static inline void FL(uint8x16x4_t X[restrict 2], const uint8x16x4_t kl[restrict 2])
+{
+        const uint8x16x4_t XL = X[1];
+        const uint8x16x4_t XR = X[0];
+
+        uint8x16x4_t YR_prerotate;
+        for (size_t j = 0; j < 4; j++) {
+                YR_prerotate.val[j] = vandq_u8(XL.val[j], kl[1].val[j]);
+        }
+
+        for (size_t j = 0; j < 4; j++) {
+                X[0].val[j] = rol_xor(YR_prerotate, j, XR.val[j]);
+                X[1].val[j] = veorq_u8(vorrq_u8(X[0].val[j], kl[0].val[j]), XL.val[j]);
+        }
+}
+
+static inline void FL_inv(uint8x16x4_t Y[restrict 2], const uint8x16x4_t kl[restrict 2])
+{
+        const uint8x16x4_t YL = Y[1];
+        const uint8x16x4_t YR = Y[0];
+
+        uint8x16x4_t XR_prerotate;
+        for (size_t j = 0; j < 4; j++) {
+                Y[1].val[j] = veorq_u8(vorrq_u8(YR.val[j], kl[0].val[j]), YL.val[j]);
+                XR_prerotate.val[j] = vandq_u8(Y[1].val[j], kl[1].val[j]);
+        }
+
+        for (size_t j = 0; j < 4; j++) {
+                Y[0].val[j] = rol_xor(XR_prerotate, j, YR.val[j]);
+        }
+}
+
+static inline void add_whitening(uint8x16x4_t state[restrict 4],
+                                 const struct camellia_rks_sliced_128 *restrict rks,
+                                 const size_t kw)
+{
+        for (size_t byte = 0; byte < 16; byte++) {
+                uint8x16_t *reg = &state[byte / 4].val[byte % 4];
+
+                *reg = veorq_u8(*reg, rks->kw[byte / 8 + kw][(byte % 8) / 4].val[byte % 4]);
+        }
+}
+
+// swap state[0,1] and state[2,3] (concatenation of R||L)
+static inline void swap_halves(uint8x16x4_t state[restrict 4])
+{
+        uint8x16x4_t tmp = state[0];
+        state[0] = state[2];
+        state[2] = tmp;
+        tmp = state[1];
+        state[1] = state[3];
+        state[3] = tmp;
+}
+
+void camellia_sliced_sha3_encrypt_128(uint64_t c[16][2],
+                                      const uint64_t m[16][2],
+                                      const struct camellia_rks_sliced_128 *restrict rks)
+{
+        uint8x16x4_t state[4];
+        camellia_sliced_pack(state, m);
+
+        // kw0/kw1
+        add_whitening(state, rks, 0);
+
+        for (size_t i = 0; i < 6; i++) {
+                feistel_round(state, rks->ku[i + 0]);
+        }
+
+        FL(&state[0], rks->kl[0]);
+        FL_inv(&state[2], rks->kl[1]);
+
+        for (size_t i = 0; i < 6; i++) {
+                feistel_round(state, rks->ku[i + 6]);
+        }
+
+        FL(&state[0], rks->kl[2]);
+        FL_inv(&state[2], rks->kl[3]);
+
+        for (size_t i = 0; i < 6; i++) {
+                feistel_round(state, rks->ku[i + 12]);
+        }
+
+        swap_halves(state);
+
+        // kw2/kw3
+        add_whitening(state, rks, 2);
+
+        camellia_sliced_unpack(c, state);
+}
+
+void camellia_sliced_sha3_decrypt_128(uint64_t m[16][2],
+                                      const uint64_t c[16][2],
+                                      const struct camellia_rks_sliced_128 *restrict rks)
+{
+        uint8x16x4_t state[4];
+        camellia_sliced_pack(state, c);
+
+        // kw2/kw3
+        add_whitening(state, rks, 2);
+
+        swap_halves(state);
+
+        for (size_t i = 6; i --> 0; ) {
+                feistel_round_inv(state, rks->ku[i + 12]);
+        }
+
+        FL(&state[2], rks->kl[3]);
+        FL_inv(&state[0], rks->kl[2]);
+
+        for (size_t i = 6; i --> 0; ) {
+                feistel_round_inv(state, rks->ku[i + 6]);
+        }
+
+        FL(&state[2], rks->kl[1]);
+        FL_inv(&state[0], rks->kl[0]);
+
+        for (size_t i = 6; i --> 0; ) {
+                feistel_round_inv(state, rks->ku[i + 0]);
+        }
+
+        // kw0/kw1
+        add_whitening(state, rks, 0);
+
+        camellia_sliced_unpack(m, state);
+}
+
+#endif
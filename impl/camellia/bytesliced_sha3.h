@@ -0,0 +1,35 @@
+#pragma once
+
+// 128-bit bytesliced camellia on 16 blocks like bytesliced.c, with the XOR
+// chains of F, the feistel round and FL fused by the ARMv8.2 SHA3
+// instructions (EOR3); same round keys as camellia_sliced_generate_round_keys_128
+//
+// instructions per call (round key loads not counted):
+//
+//                                   bytesliced.c    bytesliced_sha3.c
+//   feistel round (F and XOR)           128               120
+//     key addition                        8                 8
+//     S-boxes                            96                96
+//     permutation and XOR                24                16
+//   FL or FL^-1                          28                24
+//   encryption (18 rounds, 4 FL)       2448              2288
+
+#include <stdint.h>
+
+#include "camellia_keys.h"
+
+#ifdef __ARM_FEATURE_SHA3
+
+// after camellia_sliced_init (packing tables)
+void camellia_sliced_sha3_init(void);
+
+// c may equal m, all blocks are loaded before the first one is stored
+void camellia_sliced_sha3_encrypt_128(uint64_t c[16][2],
+                                      const uint64_t m[16][2],
+                                      const struct camellia_rks_sliced_128 *restrict rks);
+
+void camellia_sliced_sha3_decrypt_128(uint64_t m[16][2],
+                                      const uint64_t c[16][2],
+                                      const struct camellia_rks_sliced_128 *restrict rks);
+
+#endif
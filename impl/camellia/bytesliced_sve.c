@@ -0,0 +1,410 @@
+#include <stdint.h>
+#include <stddef.h>
+
+#include "bytesliced_sve.h"
+
+#if defined(__ARM_FEATURE_SVE2) && defined(__ARM_FEATURE_SVE2_AES)
+
+#include <arm_sve.h>
+
+// same tables as bytesliced.c
+static const uint64_t pack_group_u64[4][2] = {
+        { 0x1312111003020100UL, 0x3332313023222120UL },
+        { 0x1716151407060504UL, 0x3736353427262524UL },
+        { 0x1b1a19180b0a0908UL, 0x3b3a39382b2a2928UL },
+        { 0x1f1e1d1c0f0e0d0cUL, 0x3f3e3d3c2f2e2d2cUL },
+};
+
+static const uint64_t pack_group_inv_u64[4][2] = {
+        { 0x3121110130201000UL, 0x3323130332221202UL },
+        { 0x3525150534241404UL, 0x3727170736261606UL },
+        { 0x3929190938281808UL, 0x3b2b1b0b3a2a1a0aUL },
+        { 0x3d2d1d0d3c2c1c0cUL, 0x3f2f1f0f3e2e1e0eUL }
+};
+
+static const uint64_t pack_single_u64[4][2] = {
+        { 0x1c1814100c080400UL, 0x3c3834302c282420UL },
+        { 0x1d1915110d090501UL, 0x3d3935312d292521UL },
+        { 0x1e1a16120e0a0602UL, 0x3e3a36322e2a2622UL },
+        { 0x1f1b17130f0b0703UL, 0x3f3b37332f2b2723UL },
+};
+
+static const uint64_t shiftrows_inv_u64[2] = {
+        0x0b0e0104070a0d00UL, 0x0306090c0f020508UL };
+
+// low ([0]) and high ([1]) bits of matrix multiplication
+static const uint64_t prefilter_0_u64[2][2] = {
+        { 0x862b832eed40e845UL, 0x88258d20e34ee64bUL },
+        { 0x2a7bdb8aa0f15100UL, 0x2372d283a9f85809UL } };
+
+static const uint64_t prefilter_3_u64[2][2] = {  // s3(x) = s0(x <<< 1)
+        { 0x25204e4b2b2e4045UL, 0x74711f1a7a7f1114UL },
+        { 0x7283f8097b8af100UL, 0xdf2e55a4d6275cadUL } };
+
+static const uint64_t postfilter_0_u64[2][2] = {
+        { 0x31c1c2323fcfcc3cUL, 0xd12122d2df2f2cdcUL },
+        { 0xa8512ed77f86f900UL, 0x0cf58a73db225da4UL } };
+
+static const uint64_t postfilter_1_u64[2][2] = { // s1(x) = s0(x) <<< 1
+        { 0x628385647e9f9978UL, 0xa34244a5bf5e58b9UL },
+        { 0x51a25caffe0df300UL, 0x18eb15e6b744ba49UL } };
+
+static const uint64_t postfilter_2_u64[2][2] = { // s2(x) = s0(x) >>> 1
+        { 0x98e061199fe7661eUL, 0xe8901169ef97166eUL },
+        { 0x54a817ebbf43fc00UL, 0x06fa45b9ed11ae52UL } };
+
+// sizeless SVE types cannot live in arrays, structs or globals, so the state
+// is four svuint8x4_t tuples (state[0..3] of bytesliced.c) and every constant
+// is built from the tables above
+
+static inline svuint8_t load_table(const uint64_t table[2])
+{
+        return svld1rq_u8(svptrue_b8(), (const uint8_t*)table);
+}
+
+// tbl indices of bytesliced.c address 16 (64 for tbl4) bytes, across a whole
+// vector they need the offset of their 128-bit segment
+static inline svuint8_t segment_idx(const svuint8_t idx)
+{
+        const svbool_t pg = svptrue_b8();
+        return svadd_u8_x(pg, idx, svand_n_u8_x(pg, svindex_u8(0, 1), 0xf0));
+}
+
+// indices 16 * k to 16 * k + 15 pick from register k of t
+static inline svuint8_t tbl4(const svuint8x4_t t, const uint64_t table[2])
+{
+        const svbool_t pg = svptrue_b8();
+        const svuint8_t raw = load_table(table);
+        const svuint8_t idx = segment_idx(svand_n_u8_x(pg, raw, 0x0f));
+
+        svuint8_t r = svtbl_u8(svget4_u8(t, 0), idx);
+        r = svsel_u8(svcmpge_n_u8(pg, raw, 16), svtbl_u8(svget4_u8(t, 1), idx), r);
+        r = svsel_u8(svcmpge_n_u8(pg, raw, 32), svtbl_u8(svget4_u8(t, 2), idx), r);
+        r = svsel_u8(svcmpge_n_u8(pg, raw, 48), svtbl_u8(svget4_u8(t, 3), idx), r);
+        return r;
+}
+
+// register j is tbl4(tj, table)
+static inline svuint8x4_t tbl4_rows(const svuint8x4_t t0, const svuint8x4_t t1,
+                                    const svuint8x4_t t2, const svuint8x4_t t3,
+                                    const uint64_t table[2])
+{
+        return svcreate4_u8(tbl4(t0, table), tbl4(t1, table), tbl4(t2, table), tbl4(t3, table));
+}
+
+// register j is tbl4(t, table[j])
+static inline svuint8x4_t tbl4_cols(const svuint8x4_t t, const uint64_t table[4][2])
+{
+        return svcreate4_u8(tbl4(t, table[0]), tbl4(t, table[1]),
+                            tbl4(t, table[2]), tbl4(t, table[3]));
+}
+
+// every segment gets the same 16 key bytes
+static inline svuint8x4_t round_key(const uint8x16x4_t *k)
+{
+        const svbool_t pg = svptrue_b8();
+        return svcreate4_u8(svld1rq_u8(pg, (const uint8_t*)&k->val[0]),
+                            svld1rq_u8(pg, (const uint8_t*)&k->val[1]),
+                            svld1rq_u8(pg, (const uint8_t*)&k->val[2]),
+                            svld1rq_u8(pg, (const uint8_t*)&k->val[3]));
+}
+
+static inline svuint8x4_t xor4(const svuint8x4_t a, const svuint8x4_t b)
+{
+        const svbool_t pg = svptrue_b8();
+        return svcreate4_u8(sveor_u8_x(pg, svget4_u8(a, 0), svget4_u8(b, 0)),
+                            sveor_u8_x(pg, svget4_u8(a, 1), svget4_u8(b, 1)),
+                            sveor_u8_x(pg, svget4_u8(a, 2), svget4_u8(b, 2)),
+                            sveor_u8_x(pg, svget4_u8(a, 3), svget4_u8(b, 3)));
+}
+
+static inline svuint8x4_t and4(const svuint8x4_t a, const svuint8x4_t b)
+{
+        const svbool_t pg = svptrue_b8();
+        return svcreate4_u8(svand_u8_x(pg, svget4_u8(a, 0), svget4_u8(b, 0)),
+                            svand_u8_x(pg, svget4_u8(a, 1), svget4_u8(b, 1)),
+                            svand_u8_x(pg, svget4_u8(a, 2), svget4_u8(b, 2)),
+                            svand_u8_x(pg, svget4_u8(a, 3), svget4_u8(b, 3)));
+}
+
+static inline svuint8x4_t or4(const svuint8x4_t a, const svuint8x4_t b)
+{
+        const svbool_t pg = svptrue_b8();
+        return svcreate4_u8(svorr_u8_x(pg, svget4_u8(a, 0), svget4_u8(b, 0)),
+                            svorr_u8_x(pg, svget4_u8(a, 1), svget4_u8(b, 1)),
+                            svorr_u8_x(pg, svget4_u8(a, 2), svget4_u8(b, 2)),
+                            svorr_u8_x(pg, svget4_u8(a, 3), svget4_u8(b, 3)));
+}
+
+static inline svuint8_t rol_byte(const svuint8_t a, const svuint8_t prev)
+{
+        const svbool_t pg = svptrue_b8();
+        return svorr_u8_x(pg, svlsl_n_u8_x(pg, a, 1), svlsr_n_u8_x(pg, prev, 7));
+}
+
+static inline svuint8x4_t rol32_1(const svuint8x4_t a)
+{
+        return svcreate4_u8(rol_byte(svget4_u8(a, 0), svget4_u8(a, 3)),
+                            rol_byte(svget4_u8(a, 1), svget4_u8(a, 0)),
+                            rol_byte(svget4_u8(a, 2), svget4_u8(a, 1)),
+                            rol_byte(svget4_u8(a, 3), svget4_u8(a, 2)));
+}
+
+static inline svuint8_t s(const svuint8_t X,
+                          const uint64_t prefilter[2][2],
+                          const uint64_t postfilter[2][2])
+{
+        const svbool_t pg = svptrue_b8();
+
+        // prefilter (indices stay below 16, so only the first segment of
+        // the table is read)
+        const svuint8_t pre_low  = svtbl_u8(load_table(prefilter[0]), svand_n_u8_x(pg, X, 0x0f));
+        const svuint8_t pre_high = svtbl_u8(load_table(prefilter[1]), svlsr_n_u8_x(pg, X, 4));
+        svuint8_t pre = sveor_u8_x(pg, pre_low, pre_high);
+
+        // inverse ShiftRows
+        pre = svtbl_u8(pre, segment_idx(load_table(shiftrows_inv_u64)));
+
+        // AES single round encryption per segment (x <- AESSubBytes(AESShiftRows(x)))
+        const svuint8_t aes = svaese_u8(pre, svdup_n_u8(0x0));
+
+        // postfilter
+        const svuint8_t post_low  = svtbl_u8(load_table(postfilter[0]), svand_n_u8_x(pg, aes, 0x0f));
+        const svuint8_t post_high = svtbl_u8(load_table(postfilter[1]), svlsr_n_u8_x(pg, aes, 4));
+
+        return sveor_u8_x(pg, post_low, post_high);
+}
+
+static inline void F(svuint8x4_t *restrict X0, svuint8x4_t *restrict X1,
+                     const uint8x16x4_t k[restrict 2])
+{
+        const svbool_t pg = svptrue_b8();
+
+        // key additions
+        const svuint8x4_t a = xor4(*X0, round_key(&k[0]));
+        const svuint8x4_t b = xor4(*X1, round_key(&k[1]));
+
+        // S-boxes (beware of endianness)
+        svuint8_t b3 = s(svget4_u8(b, 3), prefilter_0_u64, postfilter_0_u64); // s0
+        svuint8_t b2 = s(svget4_u8(b, 2), prefilter_0_u64, postfilter_1_u64); // s1
+        svuint8_t b1 = s(svget4_u8(b, 1), prefilter_0_u64, postfilter_2_u64); // s2
+        svuint8_t b0 = s(svget4_u8(b, 0), prefilter_3_u64, postfilter_0_u64); // s3
+        svuint8_t a3 = s(svget4_u8(a, 3), prefilter_0_u64, postfilter_1_u64); // s1
+        svuint8_t a2 = s(svget4_u8(a, 2), prefilter_0_u64, postfilter_2_u64); // s2
+        svuint8_t a1 = s(svget4_u8(a, 1), prefilter_3_u64, postfilter_0_u64); // s3
+        svuint8_t a0 = s(svget4_u8(a, 0), prefilter_0_u64, postfilter_0_u64); // s0
+
+        // permutation (a = X[0], b = X[1] of bytesliced.c)
+        b3 = sveor_u8_x(pg, b3, a2);
+        b2 = sveor_u8_x(pg, b2, a1);
+        b1 = sveor_u8_x(pg, b1, a0);
+        b0 = sveor_u8_x(pg, b0, a3);
+        a3 = sveor_u8_x(pg, a3, b1);
+        a2 = sveor_u8_x(pg, a2, b0);
+        a1 = sveor_u8_x(pg, a1, b3);
+        a0 = sveor_u8_x(pg, a0, b2);
+
+        b3 = sveor_u8_x(pg, b3, a0);
+        b2 = sveor_u8_x(pg, b2, a3);
+        b1 = sveor_u8_x(pg, b1, a2);
+        b0 = sveor_u8_x(pg, b0, a1);
+        a3 = sveor_u8_x(pg, a3, b0);
+        a2 = sveor_u8_x(pg, a2, b3);
+        a1 = sveor_u8_x(pg, a1, b2);
+        a0 = sveor_u8_x(pg, a0, b1);
+
+        // X0 and X1 are swapped now; this is
+        // taken into account in the feistel round
+        *X0 = svcreate4_u8(a0, a1, a2, a3);
+        *X1 = svcreate4_u8(b0, b1, b2, b3);
+}
+
+// X0 = XR, X1 = XL
+static inline void FL(svuint8x4_t *restrict X0, svuint8x4_t *restrict X1,
+                      const uint8x16x4_t kl[restrict 2])
+{
+        const svuint8x4_t YR = xor4(rol32_1(and4(*X1, round_key(&kl[1]))), *X0);
+
+        *X1 = xor4(or4(YR, round_key(&kl[0])), *X1);
+        *X0 = YR;
+}
+
+// Y0 = YR, Y1 = YL
+static inline void FL_inv(svuint8x4_t *restrict Y0, svuint8x4_t *restrict Y1,
+                          const uint8x16x4_t kl[restrict 2])
+{
+        const svuint8x4_t XL = xor4(or4(*Y0, round_key(&kl[0])), *Y1);
+
+        *Y0 = xor4(rol32_1(and4(XL, round_key(&kl[1]))), *Y0);
+        *Y1 = XL;
+}
+
+static inline void feistel_round(svuint8x4_t *restrict s0, svuint8x4_t *restrict s1,
+                                 svuint8x4_t *restrict s2, svuint8x4_t *restrict s3,
+                                 const uint8x16x4_t kr[restrict 2])
+{
+        svuint8x4_t X0 = *s0;
+        svuint8x4_t X1 = *s1;
+
+        // F function swaps result
+        F(&X0, &X1, kr);
+
+        X0 = xor4(*s3, X0);
+        X1 = xor4(*s2, X1);
+
+        *s2 = *s0;
+        *s3 = *s1;
+        *s0 = X1;
+        *s1 = X0;
+}
+
+static inline void feistel_round_inv(svuint8x4_t *restrict s0, svuint8x4_t *restrict s1,
+                                     svuint8x4_t *restrict s2, svuint8x4_t *restrict s3,
+                                     const uint8x16x4_t kr[restrict 2])
+{
+        svuint8x4_t X0 = *s2;
+        svuint8x4_t X1 = *s3;
+
+        // F function swaps result
+        F(&X0, &X1, kr);
+
+        X0 = xor4(*s1, X0);
+        X1 = xor4(*s0, X1);
+
+        *s0 = *s2;
+        *s1 = *s3;
+        *s2 = X1;
+        *s3 = X0;
+}
+
+static inline void add_whitening(svuint8x4_t *restrict s0, svuint8x4_t *restrict s1,
+                                 svuint8x4_t *restrict s2, svuint8x4_t *restrict s3,
+                                 const struct camellia_rks_sliced_128 *restrict rks,
+                                 const size_t kw)
+{
+        *s0 = xor4(*s0, round_key(&rks->kw[kw + 0][0]));
+        *s1 = xor4(*s1, round_key(&rks->kw[kw + 0][1]));
+        *s2 = xor4(*s2, round_key(&rks->kw[kw + 1][0]));
+        *s3 = xor4(*s3, round_key(&rks->kw[kw + 1][1]));
+}
+
+static inline svuint8x4_t load4(const uint8_t *m, const size_t vl)
+{
+        const svbool_t pg = svptrue_b8();
+        return svcreate4_u8(svld1_u8(pg, m + 0 * vl), svld1_u8(pg, m + 1 * vl),
+                            svld1_u8(pg, m + 2 * vl), svld1_u8(pg, m + 3 * vl));
+}
+
+static inline void store4(uint8_t *c, const size_t vl, const svuint8x4_t t)
+{
+        const svbool_t pg = svptrue_b8();
+        svst1_u8(pg, c + 0 * vl, svget4_u8(t, 0));
+        svst1_u8(pg, c + 1 * vl, svget4_u8(t, 1));
+        svst1_u8(pg, c + 2 * vl, svget4_u8(t, 2));
+        svst1_u8(pg, c + 3 * vl, svget4_u8(t, 3));
+}
+
+// register r holds block r * segments + q in segment q, so within a segment
+// the layout is that of camellia_sliced_pack and every load is contiguous
+static inline void pack(svuint8x4_t *restrict s0, svuint8x4_t *restrict s1,
+                        svuint8x4_t *restrict s2, svuint8x4_t *restrict s3,
+                        const uint8_t *m)
+{
+        const size_t vl = svcntb();
+        const svuint8x4_t p0 = load4(m + 0 * vl, vl);
+        const svuint8x4_t p1 = load4(m + 4 * vl, vl);
+        const svuint8x4_t p2 = load4(m + 8 * vl, vl);
+        const svuint8x4_t p3 = load4(m + 12 * vl, vl);
+
+        *s0 = tbl4_cols(tbl4_rows(p0, p1, p2, p3, pack_group_u64[0]), pack_single_u64);
+        *s1 = tbl4_cols(tbl4_rows(p0, p1, p2, p3, pack_group_u64[1]), pack_single_u64);
+        *s2 = tbl4_cols(tbl4_rows(p0, p1, p2, p3, pack_group_u64[2]), pack_single_u64);
+        *s3 = tbl4_cols(tbl4_rows(p0, p1, p2, p3, pack_group_u64[3]), pack_single_u64);
+}
+
+// pack_single_inv = pack_group
+static inline void unpack(uint8_t *c,
+                          const svuint8x4_t s0, const svuint8x4_t s1,
+                          const svuint8x4_t s2, const svuint8x4_t s3)
+{
+        const size_t vl = svcntb();
+        store4(c + 0 * vl, vl, tbl4_cols(tbl4_rows(s0, s1, s2, s3, pack_group_inv_u64[0]), pack_group_u64));
+        store4(c + 4 * vl, vl, tbl4_cols(tbl4_rows(s0, s1, s2, s3, pack_group_inv_u64[1]), pack_group_u64));
+        store4(c + 8 * vl, vl, tbl4_cols(tbl4_rows(s0, s1, s2, s3, pack_group_inv_u64[2]), pack_group_u64));
+        store4(c + 12 * vl, vl, tbl4_cols(tbl4_rows(s0, s1, s2, s3, pack_group_inv_u64[3]), pack_group_u64));
+}
+
+size_t camellia_sliced_sve_blocks(void)
+{
+        return svcntb();
+}
+
+void camellia_sliced_sve_encrypt_128(uint64_t c[][2],
+                                     const uint64_t m[][2],
+                                     const struct camellia_rks_sliced_128 *restrict rks)
+{
+        svuint8x4_t s0, s1, s2, s3;
+        pack(&s0, &s1, &s2, &s3, (const uint8_t*)m);
+
+        // kw0/kw1
+        add_whitening(&s0, &s1, &s2, &s3, rks, 0);
+
+        for (size_t i = 0; i < 6; i++) {
+                feistel_round(&s0, &s1, &s2, &s3, rks->ku[i + 0]);
+        }
+
+        FL(&s0, &s1, rks->kl[0]);
+        FL_inv(&s2, &s3, rks->kl[1]);
+
+        for (size_t i = 0; i < 6; i++) {
+                feistel_round(&s0, &s1, &s2, &s3, rks->ku[i + 6]);
+        }
+
+        FL(&s0, &s1, rks->kl[2]);
+        FL_inv(&s2, &s3, rks->kl[3]);
+
+        for (size_t i = 0; i < 6; i++) {
+                feistel_round(&s0, &s1, &s2, &s3, rks->ku[i + 12]);
+        }
+
+        // swap s0,s1 and s2,s3 (concatenation of R||L), then kw2/kw3
+        add_whitening(&s2, &s3, &s0, &s1, rks, 2);
+
+        unpack((uint8_t*)c, s2, s3, s0, s1);
+}
+
+void camellia_sliced_sve_decrypt_128(uint64_t m[][2],
+                                     const uint64_t c[][2],
+                                     const struct camellia_rks_sliced_128 *restrict rks)
+{
+        svuint8x4_t s0, s1, s2, s3;
+        pack(&s2, &s3, &s0, &s1, (const uint8_t*)c);
+
+        // kw2/kw3 on the swapped halves
+        add_whitening(&s2, &s3, &s0, &s1, rks, 2);
+
+        for (size_t i = 6; i --> 0; ) {
+                feistel_round_inv(&s0, &s1, &s2, &s3, rks->ku[i + 12]);
+        }
+
+        FL(&s2, &s3, rks->kl[3]);
+        FL_inv(&s0, &s1, rks->kl[2]);
+
+        for (size_t i = 6; i --> 0; ) {
+                feistel_round_inv(&s0, &s1, &s2, &s3, rks->ku[i + 6]);
+        }
+
+        FL(&s2, &s3, rks->kl[1]);
+        FL_inv(&s0, &s1, rks->kl[0]);
+
+        for (size_t i = 6; i --> 0; ) {
+                feistel_round_inv(&s0, &s1, &s2, &s3, rks->ku[i + 0]);
+        }
+
+        // kw0/kw1
+        add_whitening(&s0, &s1, &s2, &s3, rks, 0);
+
+        unpack((uint8_t*)m, s0, s1, s2, s3);
+}
+
+#endif
@@ -0,0 +1,27 @@
+#pragma once
+
+// 128-bit bytesliced camellia on SVE2 (with the AES extension) with the batch
+// scaled to the vector length; each 128-bit segment runs the bytesliced.c
+// algorithm on 16 blocks of its own, so the round keys of
+// camellia_sliced_generate_round_keys_128 are reused
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "camellia_keys.h"
+
+#if defined(__ARM_FEATURE_SVE2) && defined(__ARM_FEATURE_SVE2_AES)
+
+// blocks per call on this core (svcntb(), 16 per 128 bits of vector)
+size_t camellia_sliced_sve_blocks(void);
+
+// c and m hold camellia_sliced_sve_blocks() blocks, c may equal m
+void camellia_sliced_sve_encrypt_128(uint64_t c[][2],
+                                     const uint64_t m[][2],
+                                     const struct camellia_rks_sliced_128 *restrict rks);
+
+void camellia_sliced_sve_decrypt_128(uint64_t m[][2],
+                                     const uint64_t c[][2],
+                                     const struct camellia_rks_sliced_128 *restrict rks);
+
+#endif
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <stdint.h>
-#include <arm_neon.h>
+#include "../simd.h"
 
 struct camellia_rks_128 {
         uint64_t kw[4]; // whitening
@@ -15,8 +15,79 @@ struct camellia_rks_256 {
         uint64_t kl[6]; // used in FL layer
 };
 
+// x <<< n for a 128-bit value with x[0] the high half, 0 < n < 64
+static inline void camellia_rol128(uint64_t x[2], const int n)
+{
+        const uint64_t hi = x[0];
+        x[0] = (x[0] << n) | (x[1] >> (64 - n));
+        x[1] = (x[1] << n) | (hi >> (64 - n));
+}
+
+// the 256-bit subkeys as rotations of KL, KR, KA and KB (which are
+// clobbered); the schedules only differ in how they derive KA and KB
+static inline void camellia_subkeys_256(struct camellia_rks_256 *restrict rks,
+                                        uint64_t KL[2], uint64_t KR[2],
+                                        uint64_t KA[2], uint64_t KB[2])
+{
+        // pre-whitening
+        rks->kw[0] = KL[0]; rks->kw[1] = KL[1];
+
+        // feistel rounds 0-5
+        rks->ku[0] = KB[0]; rks->ku[1] = KB[1];
+        camellia_rol128(KR, 15); // KR << 15
+        rks->ku[2] = KR[0]; rks->ku[3] = KR[1];
+        camellia_rol128(KA, 15); // KA << 15
+        rks->ku[4] = KA[0]; rks->ku[5] = KA[1];
+
+        // FL/FL-1
+        camellia_rol128(KR, 15); // KR << 30
+        rks->kl[0] = KR[0]; rks->kl[1] = KR[1];
+
+        // feistel rounds 6-11
+        camellia_rol128(KB, 30); // KB << 30
+        rks->ku[6] = KB[0]; rks->ku[7] = KB[1];
+        camellia_rol128(KL, 45); // KL << 45
+        rks->ku[8] = KL[0]; rks->ku[9] = KL[1];
+        camellia_rol128(KA, 30); // KA << 45
+        rks->ku[10] = KA[0]; rks->ku[11] = KA[1];
+
+        // FL/FL-1
+        camellia_rol128(KL, 15); // KL << 60
+        rks->kl[2] = KL[0]; rks->kl[3] = KL[1];
+
+        // feistel rounds 12-17
+        camellia_rol128(KR, 30); // KR << 60
+        rks->ku[12] = KR[0]; rks->ku[13] = KR[1];
+        camellia_rol128(KB, 30); // KB << 60
+        rks->ku[14] = KB[0]; rks->ku[15] = KB[1];
+        camellia_rol128(KL, 17); // KL << 77
+        rks->ku[16] = KL[0]; rks->ku[17] = KL[1];
+
+        // FL/FL-1
+        camellia_rol128(KA, 32); // KA << 77
+        rks->kl[4] = KA[0]; rks->kl[5] = KA[1];
+
+        // feistel rounds 18-25
+        camellia_rol128(KR, 34); // KR << 94
+        rks->ku[18] = KR[0]; rks->ku[19] = KR[1];
+        camellia_rol128(KA, 17); // KA << 94
+        rks->ku[20] = KA[0]; rks->ku[21] = KA[1];
+        camellia_rol128(KL, 34); // KL << 111
+        rks->ku[22] = KL[0]; rks->ku[23] = KL[1];
+
+        // post-whitening
+        camellia_rol128(KB, 51); // KB << 111
+        rks->kw[2] = KB[0]; rks->kw[3] = KB[1];
+}
+
 struct camellia_rks_sliced_128 {
         uint8x16x4_t kw[4][2]; // whitening
         uint8x16x4_t ku[18][2]; // used in F function
         uint8x16x4_t kl[4][2]; // used in FL layer
 };
+
+struct camellia_rks_sliced_256 {
+        uint8x16x4_t kw[4][2]; // whitening
+        uint8x16x4_t ku[24][2]; // used in F function
+        uint8x16x4_t kl[6][2]; // used in FL layer
+};
@@ -338,55 +338,7 @@ void camellia_naive_generate_round_keys_256(struct camellia_rks_256 *restrict rk
         camellia_naive_feistel_round(KB, keysched_const[4]);
         camellia_naive_feistel_round(KB, keysched_const[5]);
 
-        // pre-whitening
-        rks->kw[0] = KL[0]; rks->kw[1] = KL[1];
-
-        // feistel rounds 0-5
-        rks->ku[0] = KB[0]; rks->ku[1] = KB[1];
-        rol128(KR[0], KR[1], 15); // KR << 15
-        rks->ku[2] = KR[0]; rks->ku[3] = KR[1];
-        rol128(KA[0], KA[1], 15); // KA << 15
-        rks->ku[4] = KA[0]; rks->ku[5] = KA[1];
-
-        // FL/FL-1
-        rol128(KR[0], KR[1], 15); // KR << 30
-        rks->kl[0] = KR[0]; rks->kl[1] = KR[1];
-
-        // feistel rounds 6-11
-        rol128(KB[0], KB[1], 30) // KB << 30
-                rks->ku[6] = KB[0]; rks->ku[7] = KB[1];
-        rol128(KL[0], KL[1], 45) // KL << 45
-                rks->ku[8] = KL[0]; rks->ku[9] = KL[1];
-        rol128(KA[0], KA[1], 30) // KA << 45
-                rks->ku[10] = KA[0]; rks->ku[11] = KA[1];
-
-        // FL/FL-1
-        rol128(KL[0], KL[1], 15) // KL << 60
-                rks->kl[2] = KL[0]; rks->kl[3] = KL[1];
-
-        // feistel rounds 12-17
-        rol128(KR[0], KR[1], 30) // KR << 60
-                rks->ku[12] = KR[0]; rks->ku[13] = KR[1];
-        rol128(KB[0], KB[1], 30) // KB << 60
-                rks->ku[14] = KB[0]; rks->ku[15] = KB[1];
-        rol128(KL[0], KL[1], 17) // KL << 77
-                rks->ku[16] = KL[0]; rks->ku[17] = KL[1];
-
-        // FL/FL-1
-        rol128(KA[0], KA[1], 32) // KA << 77
-                rks->kl[4] = KA[0]; rks->kl[5] = KA[1];
-
-        // feistel rounds 18-25
-        rol128(KR[0], KR[1], 34) // KR << 94
-                rks->ku[18] = KR[0]; rks->ku[19] = KR[1];
-        rol128(KA[0], KA[1], 17) // KA << 94
-                rks->ku[20] = KA[0]; rks->ku[21] = KA[1];
-        rol128(KL[0], KL[1], 34) // KL << 111
-                rks->ku[22] = KL[0]; rks->ku[23] = KL[1];
-
-        // post-whitening
-        rol128(KB[0], KB[1], 51) // KB << 111
-                rks->kw[2] = KB[0]; rks->kw[3] = KB[1];
+        camellia_subkeys_256(rks, KL, KR, KA, KB);
 }
 
 void camellia_naive_encrypt_128(uint64_t c[restrict 2],
@@ -140,6 +140,34 @@ void camellia_spec_opt_generate_round_keys_128(struct camellia_rks_128 *restrict
         // KB not needed for 128 bit
 }
 
+void camellia_spec_opt_generate_round_keys_256(struct camellia_rks_256 *restrict rks,
+                                            const uint64_t key[restrict 4])
+{
+        uint64_t KL[2], KR[2], KA[2], KB[2];
+
+        // same derivation as the 128-bit schedule, but KA also depends on KR
+        // and KB is needed
+        memcpy(KL, &key[0], sizeof(KL));
+        memcpy(KR, &key[2], sizeof(KR));
+        memcpy(KA, KL, sizeof(KA));
+
+        // compute KA
+        KA[0] ^= KR[0]; KA[1] ^= KR[1];
+        camellia_spec_opt_feistel_round(KA, keysched_const[0]);
+        camellia_spec_opt_feistel_round(KA, keysched_const[1]);
+        KA[0] ^= KL[0], KA[1] ^= KL[1];
+        camellia_spec_opt_feistel_round(KA, keysched_const[2]);
+        camellia_spec_opt_feistel_round(KA, keysched_const[3]);
+
+        // compute KB
+        memcpy(KB, KA, sizeof(KB));
+        KB[0] ^= KR[0]; KB[1] ^= KR[1];
+        camellia_spec_opt_feistel_round(KB, keysched_const[4]);
+        camellia_spec_opt_feistel_round(KB, keysched_const[5]);
+
+        camellia_subkeys_256(rks, KL, KR, KA, KB);
+}
+
 void camellia_spec_opt_encrypt_128(uint64_t c[restrict 2],
                             const uint64_t m[restrict 2],
                             const struct camellia_rks_128 *restrict rks)
@@ -208,3 +236,85 @@ void camellia_spec_opt_decrypt_128(uint64_t m[restrict 2],
         m[0] ^= rks->kw[0]; m[1] ^= rks->kw[1];
 
 }
+
+void camellia_spec_opt_encrypt_256(uint64_t c[restrict 2],
+                            const uint64_t m[restrict 2],
+                            const struct camellia_rks_256 *restrict rks)
+{
+        memcpy(c, m, sizeof(c[0]) * 2);
+
+        c[0] ^= rks->kw[0];
+        c[1] ^= rks->kw[1];
+
+        for (size_t i = 0; i < 6; i++) {
+                camellia_spec_opt_feistel_round(c, rks->ku[i + 0]);
+        }
+
+        c[0] = camellia_spec_opt_FL(c[0], rks->kl[0]);
+        c[1] = camellia_spec_opt_FL_inv(c[1], rks->kl[1]);
+
+        for (size_t i = 0; i < 6; i++) {
+                camellia_spec_opt_feistel_round(c, rks->ku[i + 6]);
+        }
+
+        c[0] = camellia_spec_opt_FL(c[0], rks->kl[2]);
+        c[1] = camellia_spec_opt_FL_inv(c[1], rks->kl[3]);
+
+        for (size_t i = 0; i < 6; i++) {
+                camellia_spec_opt_feistel_round(c, rks->ku[i + 12]);
+        }
+
+        c[0] = camellia_spec_opt_FL(c[0], rks->kl[4]);
+        c[1] = camellia_spec_opt_FL_inv(c[1], rks->kl[5]);
+
+        for (size_t i = 0; i < 6; i++) {
+                camellia_spec_opt_feistel_round(c, rks->ku[i + 18]);
+        }
+
+        // swap c[0] and c[1] (concatenation of R||L)
+        uint64_t t = c[0];
+        c[0] = c[1]; c[1] = t;
+
+        c[0] ^= rks->kw[2];
+        c[1] ^= rks->kw[3];
+}
+
+void camellia_spec_opt_decrypt_256(uint64_t m[restrict 2],
+                            const uint64_t c[restrict 2],
+                            const struct camellia_rks_256 *restrict rks)
+{
+        memcpy(m, c, sizeof(m[0]) * 2);
+
+        m[0] ^= rks->kw[2]; m[1] ^= rks->kw[3];
+
+        // swap c[0] and c[1] (concatenation of R||L)
+        uint64_t t = m[0];
+        m[0] = m[1]; m[1] = t;
+
+        for (size_t i = 6; i --> 0; ) {
+                camellia_spec_opt_feistel_round_inv(m, rks->ku[i + 18]);
+        }
+
+        m[1] = camellia_spec_opt_FL(m[1], rks->kl[5]);
+        m[0] = camellia_spec_opt_FL_inv(m[0], rks->kl[4]);
+
+        for (size_t i = 6; i --> 0; ) {
+                camellia_spec_opt_feistel_round_inv(m, rks->ku[i + 12]);
+        }
+
+        m[1] = camellia_spec_opt_FL(m[1], rks->kl[3]);
+        m[0] = camellia_spec_opt_FL_inv(m[0], rks->kl[2]);
+
+        for (size_t i = 6; i --> 0; ) {
+                camellia_spec_opt_feistel_round_inv(m, rks->ku[i + 6]);
+        }
+
+        m[1] = camellia_spec_opt_FL(m[1], rks->kl[1]);
+        m[0] = camellia_spec_opt_FL_inv(m[0], rks->kl[0]);
+
+        for (size_t i = 6; i --> 0; ) {
+                camellia_spec_opt_feistel_round_inv(m, rks->ku[i + 0]);
+        }
+
+        m[0] ^= rks->kw[0]; m[1] ^= rks->kw[1];
+}
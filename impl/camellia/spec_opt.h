@@ -13,6 +13,8 @@ void camellia_spec_opt_feistel_round(uint64_t state[2], const uint64_t kr);
 void camellia_spec_opt_feistel_round_inv(uint64_t state[2], const uint64_t kr);
 void camellia_spec_opt_generate_round_keys_128(struct camellia_rks_128 *restrict rks,
                                             const uint64_t key[restrict 2]);
+void camellia_spec_opt_generate_round_keys_256(struct camellia_rks_256 *restrict rks,
+                                            const uint64_t key[restrict 4]);
 
 void camellia_spec_opt_encrypt_128(uint64_t c[restrict 2],
                             const uint64_t m[restrict 2],
@@ -21,3 +23,11 @@ void camellia_spec_opt_encrypt_128(uint64_t c[restrict 2],
 void camellia_spec_opt_decrypt_128(uint64_t m[restrict 2],
                             const uint64_t c[restrict 2],
                             const struct camellia_rks_128 *restrict rks);
+
+void camellia_spec_opt_encrypt_256(uint64_t c[restrict 2],
+                            const uint64_t m[restrict 2],
+                            const struct camellia_rks_256 *restrict rks);
+
+void camellia_spec_opt_decrypt_256(uint64_t m[restrict 2],
+                            const uint64_t c[restrict 2],
+                            const struct camellia_rks_256 *restrict rks);
@@ -0,0 +1,195 @@
+#include "analysis/gift_64_differential.h"
+#include "modes/parallel.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include <getopt.h>
+#include <unistd.h>
+
+#include <stdint.h>
+
+// usage: ./differential [options], see usage() below
+//
+// counts the output differences of --pairs random pairs (P, P ^ --delta)
+// through --rounds rounds of GIFT-64 and prints the most frequent ones with
+// their estimated probability
+
+#define DEFAULT_ROUNDS 5
+#define DEFAULT_LOG2_PAIRS 24
+#define DEFAULT_TOP 16
+#define DEFAULT_SEED 1
+#define MAX_TOP 65536
+
+static uint64_t now_ns(void)
+{
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000UL + ts.tv_nsec;
+}
+
+// strtoull with 0x prefixes and a check that all of s was used
+static int parse_u64(uint64_t *out, const char *s)
+{
+        char *end;
+        *out = strtoull(s, &end, 0);
+        return end != s && *end == '\0' ? 0 : -1;
+}
+
+static void usage(const char *name)
+{
+        fprintf(stderr,
+                "usage: %s [options]\n"
+                "  -d, --delta X       input difference (default 0x1)\n"
+                "  -r, --rounds N      rounds, 1 to %d (default %d)\n"
+                "  -n, --log2-pairs N  2^N pairs, rounded up to %d (default %d)\n"
+                "  -m, --mask X        only count diff & X (default all bits)\n"
+                "  -k, --key HI:LO     key words (default 0:0)\n"
+                "  -t, --threads N     pool size (default <cpus>)\n"
+                "  -T, --top N         differences to print, up to %d (default %d)\n"
+                "  -S, --seed N        seed for the plaintexts (default %d)\n"
+                "  -c, --max-entries N distinct differences kept per thread, 0 for\n"
+                "                      no limit (default 0)\n",
+                name, ROUNDS_GIFT_64, DEFAULT_ROUNDS, GIFT_64_DIFFERENTIAL_TILE_PAIRS,
+                DEFAULT_LOG2_PAIRS, MAX_TOP, DEFAULT_TOP, DEFAULT_SEED);
+}
+
+int main(int argc, char *argv[])
+{
+        static const struct option long_options[] = {
+                { "delta",       required_argument, NULL, 'd' },
+                { "rounds",      required_argument, NULL, 'r' },
+                { "log2-pairs",  required_argument, NULL, 'n' },
+                { "mask",        required_argument, NULL, 'm' },
+                { "key",         required_argument, NULL, 'k' },
+                { "threads",     required_argument, NULL, 't' },
+                { "top",         required_argument, NULL, 'T' },
+                { "seed",        required_argument, NULL, 'S' },
+                { "max-entries", required_argument, NULL, 'c' },
+                { "help",        no_argument,       NULL, 'h' },
+                { NULL, 0, NULL, 0 }
+        };
+
+        struct gift_64_differential_config cfg = {
+                .delta = 1,
+                .mask = ~0UL,
+                .rounds = DEFAULT_ROUNDS,
+                .seed = DEFAULT_SEED,
+                .pairs = 1UL << DEFAULT_LOG2_PAIRS,
+        };
+        int threads = sysconf(_SC_NPROCESSORS_ONLN);
+        size_t top_k = DEFAULT_TOP;
+
+        int c;
+        uint64_t v;
+        while ((c = getopt_long(argc, argv, "d:r:n:m:k:t:T:S:c:h",
+                                long_options, NULL)) != -1) {
+                switch (c) {
+                case 'd':
+                        if (parse_u64(&cfg.delta, optarg) < 0 || cfg.delta == 0) {
+                                fprintf(stderr, "invalid delta '%s'\n", optarg);
+                                return 1;
+                        }
+                        break;
+                case 'r':
+                        cfg.rounds = atoi(optarg);
+                        if (cfg.rounds < 1 || cfg.rounds > ROUNDS_GIFT_64) {
+                                fprintf(stderr, "rounds must be 1 to %d\n", ROUNDS_GIFT_64);
+                                return 1;
+                        }
+                        break;
+                case 'n':
+                        if (parse_u64(&v, optarg) < 0 || v > 62) {
+                                fprintf(stderr, "invalid pair count 2^%s\n", optarg);
+                                return 1;
+                        }
+                        cfg.pairs = 1UL << v;
+                        break;
+                case 'm':
+                        if (parse_u64(&cfg.mask, optarg) < 0) {
+                                fprintf(stderr, "invalid mask '%s'\n", optarg);
+                                return 1;
+                        }
+                        break;
+                case 'k': {
+                        char *end;
+                        cfg.key[1] = strtoull(optarg, &end, 0);
+                        if (*end != ':' || parse_u64(&cfg.key[0], end + 1) < 0) {
+                                fprintf(stderr, "invalid key '%s', expected HI:LO\n", optarg);
+                                return 1;
+                        }
+                        break;
+                }
+                case 't':
+                        threads = atoi(optarg);
+                        if (threads < 1) {
+                                fprintf(stderr, "need at least one thread\n");
+                                return 1;
+                        }
+                        break;
+                case 'T':
+                        if (parse_u64(&v, optarg) < 0 || v > MAX_TOP) {
+                                fprintf(stderr, "top must be 0 to %d\n", MAX_TOP);
+                                return 1;
+                        }
+                        top_k = v;
+                        break;
+                case 'S':
+                        if (parse_u64(&cfg.seed, optarg) < 0) {
+                                fprintf(stderr, "invalid seed '%s'\n", optarg);
+                                return 1;
+                        }
+                        break;
+                case 'c':
+                        if (parse_u64(&v, optarg) < 0) {
+                                fprintf(stderr, "invalid entry limit '%s'\n", optarg);
+                                return 1;
+                        }
+                        cfg.max_entries = v;
+                        break;
+                default:
+                        usage(argv[0]);
+                        return c == 'h' ? 0 : 1;
+                }
+        }
+
+        gift_64_vec_sliced_init();
+        struct parallel_pool *pool = parallel_pool_create(threads);
+        if (pool == NULL) {
+                fprintf(stderr, "cannot start %d threads\n", threads);
+                return 1;
+        }
+
+        struct gift_64_differential_hist hist;
+        const uint64_t t0 = now_ns();
+        if (gift_64_differential_run(pool, &cfg, &hist) < 0) {
+                fprintf(stderr, "out of memory for the histograms\n");
+                parallel_pool_destroy(pool);
+                return 1;
+        }
+        const double seconds = (now_ns() - t0) / 1e9;
+        parallel_pool_destroy(pool);
+
+        printf("delta 0x%016lx, %d rounds, mask 0x%016lx, %d threads\n",
+               cfg.delta, cfg.rounds, cfg.mask, threads);
+        printf("%lu pairs in %.3f s (%.1f Mpairs/s), %zu distinct, %lu dropped\n",
+               hist.total, seconds, hist.total / seconds / 1e6, hist.size, hist.dropped);
+
+        struct gift_64_differential_entry *top = malloc((top_k ? top_k : 1) * sizeof(*top));
+        if (top == NULL) {
+                perror("malloc");
+                gift_64_differential_hist_free(&hist);
+                return 1;
+        }
+        const size_t n = gift_64_differential_hist_top(&hist, top, top_k);
+        for (size_t i = 0; i < n; i++) {
+                printf("0x%016lx %12lu  2^%.2f\n", top[i].diff, top[i].count,
+                       log2((double)top[i].count / hist.total));
+        }
+
+        free(top);
+        gift_64_differential_hist_free(&hist);
+        return 0;
+}
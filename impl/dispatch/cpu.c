@@ -0,0 +1,60 @@
+#include <pthread.h>
+#include <string.h>
+
+#include "cpu.h"
+
+#if defined(__aarch64__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#elif defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+static struct cpu_features features;
+static pthread_once_t features_once = PTHREAD_ONCE_INIT;
+
+#if defined(__x86_64__)
+// the OS has to save the ymm registers for AVX to be usable
+static int os_saves_ymm(void)
+{
+        unsigned int xcr0_lo, xcr0_hi;
+        __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+        return (xcr0_lo & 0x6) == 0x6;
+}
+#endif
+
+static void detect(void)
+{
+        memset(&features, 0, sizeof(features));
+
+#if defined(__aarch64__)
+        const unsigned long hwcap = getauxval(AT_HWCAP);
+        features.neon  = (hwcap & HWCAP_ASIMD) != 0;
+        features.aes   = (hwcap & HWCAP_AES) != 0;
+        features.pmull = (hwcap & HWCAP_PMULL) != 0;
+        features.sha3  = (hwcap & HWCAP_SHA3) != 0;
+        features.sve   = (hwcap & HWCAP_SVE) != 0;
+
+        const unsigned long hwcap2 = getauxval(AT_HWCAP2);
+        features.sve2_aes = (hwcap2 & HWCAP2_SVE2) && (hwcap2 & HWCAP2_SVEAES);
+#elif defined(__x86_64__)
+        unsigned int eax, ebx, ecx, edx;
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+                features.ssse3  = (ecx & bit_SSSE3) != 0;
+                features.aesni  = (ecx & bit_AES) != 0;
+                features.pclmul = (ecx & bit_PCLMUL) != 0;
+
+                const int avx = (ecx & bit_OSXSAVE) && (ecx & bit_AVX) && os_saves_ymm();
+                if (avx && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+                        features.avx2 = (ebx & bit_AVX2) != 0;
+                        features.vaes = (ecx & (1 << 9)) != 0;
+                }
+        }
+#endif
+}
+
+const struct cpu_features *cpu_features(void)
+{
+        pthread_once(&features_once, detect);
+        return &features;
+}
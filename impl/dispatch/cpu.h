@@ -0,0 +1,22 @@
+#pragma once
+
+// CPU features relevant to the kernels, detected once at first use
+
+struct cpu_features {
+        // aarch64 (AT_HWCAP)
+        int neon;
+        int aes;
+        int pmull;
+        int sha3;
+        int sve;
+        int sve2_aes; // AT_HWCAP2
+
+        // x86-64 (CPUID)
+        int ssse3;
+        int aesni;
+        int pclmul;
+        int avx2;
+        int vaes;
+};
+
+const struct cpu_features *cpu_features(void);
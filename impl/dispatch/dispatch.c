@@ -0,0 +1,307 @@
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "dispatch.h"
+#include "cpu.h"
+#include "../gift/table.h"
+#include "../gift/vec_sliced.h"
+#include "../gift/vec_sliced_avx2.h"
+#include "../gift/vec_sliced_sha3.h"
+#include "../camellia/spec_opt.h"
+#include "../camellia/bytesliced.h"
+#include "../camellia/bytesliced_avx2.h"
+#include "../camellia/bytesliced_sha3.h"
+
+static pthread_once_t gift_64_once = PTHREAD_ONCE_INIT;
+static pthread_once_t camellia_once = PTHREAD_ONCE_INIT;
+
+static int have_neon(const struct cpu_features *f)
+{
+        return f->neon || f->ssse3;
+}
+
+static int have_avx2(const struct cpu_features *f)
+{
+#ifdef __AVX2__
+        return f->avx2;
+#else
+        (void)f;
+        return 0;
+#endif
+}
+
+// EOR3/BCAX (ARMv8.2 SHA3), the kernels are only built when the compiler
+// may use them
+static int have_sha3(const struct cpu_features *f)
+{
+#ifdef __ARM_FEATURE_SHA3
+        return f->sha3;
+#else
+        (void)f;
+        return 0;
+#endif
+}
+
+static void gift_64_init_tables(void)
+{
+        const struct cpu_features *f = cpu_features();
+
+        if (have_neon(f)) {
+                gift_64_vec_sliced_init();
+        }
+#ifdef __AVX2__
+        if (have_avx2(f)) {
+                gift_64_vec_sliced_avx2_init();
+        }
+#endif
+#ifdef __ARM_FEATURE_SHA3
+        if (have_neon(f) && have_sha3(f)) {
+                gift_64_vec_sliced_sha3_init();
+        }
+#endif
+}
+
+void gift_64_ctx_init(struct gift_64_ctx *restrict ctx, const uint64_t key[restrict 2])
+{
+        const struct cpu_features *f = cpu_features();
+        pthread_once(&gift_64_once, gift_64_init_tables);
+
+        ctx->vec_sliced = have_neon(f);
+        ctx->avx2 = ctx->vec_sliced && have_avx2(f);
+        ctx->sha3 = ctx->vec_sliced && have_sha3(f);
+
+        gift_64_table_generate_round_keys(ctx->rks_table, key);
+        gift_64_table_generate_round_keys_inv(ctx->rks_table_inv, key);
+        if (ctx->vec_sliced) {
+                gift_64_vec_sliced_generate_round_keys(ctx->rks_vec_sliced, key);
+        }
+}
+
+static void gift_64_blocks(const struct gift_64_ctx *restrict ctx,
+                           uint8_t *out, const uint8_t *in, const size_t stride, size_t nblocks,
+                           const int decrypt)
+{
+#ifdef __AVX2__
+        // the AVX2 kernels only take contiguous blocks
+        for (; ctx->avx2 && stride == 8 && nblocks >= 32; nblocks -= 32, out += 256, in += 256) {
+                if (decrypt) {
+                        gift_64_vec_sliced_avx2_decrypt((uint64_t*)out, (const uint64_t*)in,
+                                                        ctx->rks_vec_sliced);
+                } else {
+                        gift_64_vec_sliced_avx2_encrypt((uint64_t*)out, (const uint64_t*)in,
+                                                        ctx->rks_vec_sliced);
+                }
+        }
+#endif
+#ifdef __ARM_FEATURE_SHA3
+        // as do the SHA3 kernels
+        for (; ctx->sha3 && stride == 8 && nblocks >= 16; nblocks -= 16, out += 128, in += 128) {
+                if (decrypt) {
+                        gift_64_vec_sliced_sha3_decrypt((uint64_t*)out, (const uint64_t*)in,
+                                                        ctx->rks_vec_sliced);
+                } else {
+                        gift_64_vec_sliced_sha3_encrypt((uint64_t*)out, (const uint64_t*)in,
+                                                        ctx->rks_vec_sliced);
+                }
+        }
+#endif
+
+        for (; ctx->vec_sliced && nblocks >= 16;
+             nblocks -= 16, out += 16 * stride, in += 16 * stride) {
+                if (decrypt) {
+                        gift_64_vec_sliced_decrypt_strided(out, in, stride, ctx->rks_vec_sliced);
+                } else {
+                        gift_64_vec_sliced_encrypt_strided(out, in, stride, ctx->rks_vec_sliced);
+                }
+        }
+
+        // a partial batch is padded if that is still cheaper than going
+        // block by block
+        if (ctx->vec_sliced && nblocks >= DISPATCH_MIN_SLICED_BLOCKS) {
+                uint8_t batch[16][8] = { { 0 } };
+                for (size_t i = 0; i < nblocks; i++) {
+                        memcpy(batch[i], in + i * stride, 8);
+                }
+                if (decrypt) {
+                        gift_64_vec_sliced_decrypt_strided(batch[0], batch[0], 8,
+                                                           ctx->rks_vec_sliced);
+                } else {
+                        gift_64_vec_sliced_encrypt_strided(batch[0], batch[0], 8,
+                                                           ctx->rks_vec_sliced);
+                }
+                for (size_t i = 0; i < nblocks; i++) {
+                        memcpy(out + i * stride, batch[i], 8);
+                }
+                return;
+        }
+
+        for (size_t i = 0; i < nblocks; i++) {
+                uint64_t block;
+                memcpy(&block, in + i * stride, 8);
+                block = decrypt ? gift_64_table_decrypt(block, ctx->rks_table_inv)
+                                : gift_64_table_encrypt(block, ctx->rks_table);
+                memcpy(out + i * stride, &block, 8);
+        }
+}
+
+void gift_64_encrypt_blocks(const struct gift_64_ctx *restrict ctx,
+                            uint8_t *out, const uint8_t *in, size_t nblocks)
+{
+        gift_64_blocks(ctx, out, in, 8, nblocks, 0);
+}
+
+void gift_64_decrypt_blocks(const struct gift_64_ctx *restrict ctx,
+                            uint8_t *out, const uint8_t *in, size_t nblocks)
+{
+        gift_64_blocks(ctx, out, in, 8, nblocks, 1);
+}
+
+void gift_64_encrypt_blocks_strided(const struct gift_64_ctx *restrict ctx,
+                                    uint8_t *out, const uint8_t *in, size_t stride,
+                                    size_t nblocks)
+{
+        gift_64_blocks(ctx, out, in, stride, nblocks, 0);
+}
+
+void gift_64_decrypt_blocks_strided(const struct gift_64_ctx *restrict ctx,
+                                    uint8_t *out, const uint8_t *in, size_t stride,
+                                    size_t nblocks)
+{
+        gift_64_blocks(ctx, out, in, stride, nblocks, 1);
+}
+
+// the bytesliced S-box runs on the AES instructions
+static int have_sliced(const struct cpu_features *f)
+{
+        return (f->neon && f->aes) || (f->ssse3 && f->aesni);
+}
+
+static void camellia_init_tables(void)
+{
+        const struct cpu_features *f = cpu_features();
+
+        if (have_sliced(f)) {
+                camellia_sliced_init();
+        }
+#ifdef __AVX2__
+        if (have_sliced(f) && have_avx2(f)) {
+                camellia_sliced_avx2_init();
+        }
+#endif
+#ifdef __ARM_FEATURE_SHA3
+        if (have_sliced(f) && have_sha3(f)) {
+                camellia_sliced_sha3_init();
+        }
+#endif
+}
+
+void camellia_ctx_init_128(struct camellia_ctx_128 *restrict ctx, const uint64_t key[restrict 2])
+{
+        const struct cpu_features *f = cpu_features();
+        pthread_once(&camellia_once, camellia_init_tables);
+
+        ctx->sliced = have_sliced(f);
+        ctx->avx2 = ctx->sliced && have_avx2(f);
+        ctx->sha3 = ctx->sliced && have_sha3(f);
+
+        camellia_spec_opt_generate_round_keys_128(&ctx->rks, key);
+        if (ctx->sliced) {
+                camellia_sliced_generate_round_keys_128(&ctx->rks_sliced, key);
+        }
+}
+
+static void camellia_blocks_128(const struct camellia_ctx_128 *restrict ctx,
+                                uint8_t *out, const uint8_t *in, const size_t stride,
+                                size_t nblocks, const int decrypt)
+{
+        const struct camellia_rks_sliced_128 *rks = &ctx->rks_sliced;
+
+#ifdef __AVX2__
+        // the AVX2 kernels only take contiguous blocks
+        for (; ctx->avx2 && stride == 16 && nblocks >= 32; nblocks -= 32, out += 512, in += 512) {
+                if (decrypt) {
+                        camellia_sliced_avx2_decrypt_128((uint64_t(*)[2])out,
+                                                         (const uint64_t(*)[2])in, rks);
+                } else {
+                        camellia_sliced_avx2_encrypt_128((uint64_t(*)[2])out,
+                                                         (const uint64_t(*)[2])in, rks);
+                }
+        }
+#endif
+#ifdef __ARM_FEATURE_SHA3
+        // as do the SHA3 kernels
+        for (; ctx->sha3 && stride == 16 && nblocks >= 16; nblocks -= 16, out += 256, in += 256) {
+                if (decrypt) {
+                        camellia_sliced_sha3_decrypt_128((uint64_t(*)[2])out,
+                                                         (const uint64_t(*)[2])in, rks);
+                } else {
+                        camellia_sliced_sha3_encrypt_128((uint64_t(*)[2])out,
+                                                         (const uint64_t(*)[2])in, rks);
+                }
+        }
+#endif
+
+        for (; ctx->sliced && nblocks >= 16;
+             nblocks -= 16, out += 16 * stride, in += 16 * stride) {
+                if (decrypt) {
+                        camellia_sliced_decrypt_128_strided(out, in, stride, rks);
+                } else {
+                        camellia_sliced_encrypt_128_strided(out, in, stride, rks);
+                }
+        }
+
+        if (ctx->sliced && nblocks >= DISPATCH_MIN_SLICED_BLOCKS) {
+                uint8_t batch[16][16] = { { 0 } };
+                for (size_t i = 0; i < nblocks; i++) {
+                        memcpy(batch[i], in + i * stride, 16);
+                }
+                if (decrypt) {
+                        camellia_sliced_decrypt_128_strided(batch[0], batch[0], 16, rks);
+                } else {
+                        camellia_sliced_encrypt_128_strided(batch[0], batch[0], 16, rks);
+                }
+                for (size_t i = 0; i < nblocks; i++) {
+                        memcpy(out + i * stride, batch[i], 16);
+                }
+                return;
+        }
+
+        for (size_t i = 0; i < nblocks; i++) {
+                uint64_t m[2], c[2];
+                memcpy(m, in + i * stride, 16);
+                if (decrypt) {
+                        camellia_spec_opt_decrypt_128(c, m, &ctx->rks);
+                } else {
+                        camellia_spec_opt_encrypt_128(c, m, &ctx->rks);
+                }
+                memcpy(out + i * stride, c, 16);
+        }
+}
+
+void camellia_encrypt_blocks_128(const struct camellia_ctx_128 *restrict ctx,
+                                 uint8_t *out, const uint8_t *in, size_t nblocks)
+{
+        camellia_blocks_128(ctx, out, in, 16, nblocks, 0);
+}
+
+void camellia_decrypt_blocks_128(const struct camellia_ctx_128 *restrict ctx,
+                                 uint8_t *out, const uint8_t *in, size_t nblocks)
+{
+        camellia_blocks_128(ctx, out, in, 16, nblocks, 1);
+}
+
+void camellia_encrypt_blocks_128_strided(const struct camellia_ctx_128 *restrict ctx,
+                                         uint8_t *out, const uint8_t *in, size_t stride,
+                                         size_t nblocks)
+{
+        camellia_blocks_128(ctx, out, in, stride, nblocks, 0);
+}
+
+void camellia_decrypt_blocks_128_strided(const struct camellia_ctx_128 *restrict ctx,
+                                         uint8_t *out, const uint8_t *in, size_t stride,
+                                         size_t nblocks)
+{
+        camellia_blocks_128(ctx, out, in, stride, nblocks, 1);
+}
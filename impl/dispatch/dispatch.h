@@ -0,0 +1,61 @@
+#pragma once
+
+// one front end per cipher: the kernel is picked at runtime from the CPU
+// features and the batch size, and the kernel tables are set up on first use
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../simd.h"
+#include "../gift/naive.h"
+#include "../camellia/camellia_keys.h"
+
+// below this many blocks the scalar kernels beat a padded 16-block batch
+#define DISPATCH_MIN_SLICED_BLOCKS 4
+
+struct gift_64_ctx {
+        int vec_sliced;
+        int avx2;
+        int sha3;
+
+        uint64_t rks_table[ROUNDS_GIFT_64];     // table (small encryptions)
+        uint64_t rks_table_inv[ROUNDS_GIFT_64]; // table (small decryptions)
+        uint8x16x4_t rks_vec_sliced[ROUNDS_GIFT_64][2];
+};
+
+struct camellia_ctx_128 {
+        int sliced;
+        int avx2;
+        int sha3;
+
+        struct camellia_rks_128 rks; // spec_opt
+        struct camellia_rks_sliced_128 rks_sliced;
+};
+
+// blocks are 8 (GIFT-64) or 16 (Camellia) bytes as laid out in memory by the
+// kernels, out may equal in; the strided variants take block i from
+// in + i * stride (to out + i * stride) at any alignment, so records inside
+// larger structs are encrypted where they sit
+void gift_64_ctx_init(struct gift_64_ctx *restrict ctx, const uint64_t key[restrict 2]);
+void gift_64_encrypt_blocks(const struct gift_64_ctx *restrict ctx,
+                            uint8_t *out, const uint8_t *in, size_t nblocks);
+void gift_64_decrypt_blocks(const struct gift_64_ctx *restrict ctx,
+                            uint8_t *out, const uint8_t *in, size_t nblocks);
+void gift_64_encrypt_blocks_strided(const struct gift_64_ctx *restrict ctx,
+                                    uint8_t *out, const uint8_t *in, size_t stride,
+                                    size_t nblocks);
+void gift_64_decrypt_blocks_strided(const struct gift_64_ctx *restrict ctx,
+                                    uint8_t *out, const uint8_t *in, size_t stride,
+                                    size_t nblocks);
+
+void camellia_ctx_init_128(struct camellia_ctx_128 *restrict ctx, const uint64_t key[restrict 2]);
+void camellia_encrypt_blocks_128(const struct camellia_ctx_128 *restrict ctx,
+                                 uint8_t *out, const uint8_t *in, size_t nblocks);
+void camellia_decrypt_blocks_128(const struct camellia_ctx_128 *restrict ctx,
+                                 uint8_t *out, const uint8_t *in, size_t nblocks);
+void camellia_encrypt_blocks_128_strided(const struct camellia_ctx_128 *restrict ctx,
+                                         uint8_t *out, const uint8_t *in, size_t stride,
+                                         size_t nblocks);
+void camellia_decrypt_blocks_128_strided(const struct camellia_ctx_128 *restrict ctx,
+                                         uint8_t *out, const uint8_t *in, size_t stride,
+                                         size_t nblocks);
@@ -0,0 +1,275 @@
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "fixsliced_128.h"
+#include "naive.h" // round keys are rearranged from the naive key schedule
+
+// where slice 3 of nibble i goes in the bit permutation, the slice that is
+// never moved (every other slice is rotated into its layout instead)
+static const uint8_t perm_slice_3[32] = {
+        24, 16, 8, 0, 25, 17, 9, 1, 26, 18, 10, 2, 27, 19, 11, 3,
+        28, 20, 12, 4, 29, 21, 13, 5, 30, 22, 14, 6, 31, 23, 15, 7
+};
+
+#define ror(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+#define nibble_ror_1(x) ((((x) >> 1) & 0x77777777) | (((x) & 0x11111111) << 3))
+#define nibble_ror_2(x) ((((x) >> 2) & 0x33333333) | (((x) & 0x33333333) << 2))
+#define nibble_ror_3(x) ((((x) >> 3) & 0x11111111) | (((x) & 0x77777777) << 1))
+
+#define half_ror_4(x)  ((((x) >> 4 ) & 0x0fff0fff) | (((x) & 0x000f000f) << 12))
+#define half_ror_8(x)  ((((x) >> 8 ) & 0x00ff00ff) | (((x) & 0x00ff00ff) << 8 ))
+#define half_ror_12(x) ((((x) >> 12) & 0x000f000f) | (((x) & 0x0fff0fff) << 4 ))
+
+#define byte_ror_2(x) ((((x) >> 2) & 0x3f3f3f3f) | (((x) & 0x03030303) << 6))
+#define byte_ror_4(x) ((((x) >> 4) & 0x0f0f0f0f) | (((x) & 0x0f0f0f0f) << 4))
+#define byte_ror_6(x) ((((x) >> 6) & 0x03030303) | (((x) & 0x3f3f3f3f) << 2))
+
+// swap the bits of a selected by m with the ones n positions higher
+#define swapmove_1(a, m, n)                                                 \
+{                                                                           \
+        const uint32_t _t = ((a) ^ ((a) >> (n))) & (m);                     \
+        (a) ^= _t;                                                          \
+        (a) ^= _t << (n);                                                   \
+}
+
+#define swapmove_2(a, b, m, n)                                              \
+{                                                                           \
+        const uint32_t _t = (((a) >> (n)) ^ (b)) & (m);                     \
+        (b) ^= _t;                                                          \
+        (a) ^= _t << (n);                                                   \
+}
+
+// bitsliced S-box, slice 0 ends up in s3 and slice 3 in s0 (the callers swap
+// the roles of the two words every round instead of moving them back)
+#define sbox(s0, s1, s2, s3)                                                \
+{                                                                           \
+        s1 ^= s0 & s2;                                                      \
+        s0 ^= s1 & s3;                                                      \
+        s2 ^= s0 | s1;                                                      \
+        s3 ^= s2;                                                           \
+        s1 ^= s3;                                                           \
+        s3 ^= 0xffffffff;                                                   \
+        s2 ^= s0 & s1;                                                      \
+}
+
+// undoes sbox() called with the same arguments
+#define sbox_inv(s0, s1, s2, s3)                                            \
+{                                                                           \
+        s2 ^= s0 & s1;                                                      \
+        s3 ^= 0xffffffff;                                                   \
+        s1 ^= s3;                                                           \
+        s3 ^= s2;                                                           \
+        s2 ^= s0 | s1;                                                      \
+        s0 ^= s1 & s3;                                                      \
+        s1 ^= s0 & s2;                                                      \
+}
+
+// five rounds after which all slices are back in the bitsliced layout
+static inline void quintuple_round(uint32_t s[restrict 4],
+                                   const uint32_t rk[restrict 5][3])
+{
+        uint32_t s0 = s[0], s1 = s[1], s2 = s[2], s3 = s[3];
+
+        sbox(s0, s1, s2, s3);
+        s3 = nibble_ror_1(s3);
+        s1 = nibble_ror_2(s1);
+        s2 = nibble_ror_3(s2);
+        s1 ^= rk[0][0];
+        s2 ^= rk[0][1];
+        s0 ^= rk[0][2];
+
+        sbox(s3, s1, s2, s0);
+        s0 = half_ror_4(s0);
+        s1 = half_ror_8(s1);
+        s2 = half_ror_12(s2);
+        s1 ^= rk[1][0];
+        s2 ^= rk[1][1];
+        s3 ^= rk[1][2];
+
+        sbox(s0, s1, s2, s3);
+        s3 = ror(s3, 16);
+        s2 = ror(s2, 16);
+        swapmove_1(s1, 0x55555555, 1);
+        swapmove_1(s2, 0x00005555, 1);
+        swapmove_1(s3, 0x55550000, 1);
+        s1 ^= rk[2][0];
+        s2 ^= rk[2][1];
+        s0 ^= rk[2][2];
+
+        sbox(s3, s1, s2, s0);
+        s0 = byte_ror_6(s0);
+        s1 = byte_ror_4(s1);
+        s2 = byte_ror_2(s2);
+        s1 ^= rk[3][0];
+        s2 ^= rk[3][1];
+        s3 ^= rk[3][2];
+
+        sbox(s0, s1, s2, s3);
+        s3 = ror(s3, 24);
+        s1 = ror(s1, 16);
+        s2 = ror(s2, 8);
+        s1 ^= rk[4][0];
+        s2 ^= rk[4][1];
+        s0 ^= rk[4][2];
+
+        // slice 0 is in s3 and slice 3 in s0 now
+        s[0] = s3;
+        s[1] = s1;
+        s[2] = s2;
+        s[3] = s0;
+}
+
+static inline void quintuple_round_inv(uint32_t s[restrict 4],
+                                       const uint32_t rk[restrict 5][3])
+{
+        uint32_t s0 = s[3], s1 = s[1], s2 = s[2], s3 = s[0];
+
+        s1 ^= rk[4][0];
+        s2 ^= rk[4][1];
+        s0 ^= rk[4][2];
+        s3 = ror(s3, 8);
+        s1 = ror(s1, 16);
+        s2 = ror(s2, 24);
+        sbox_inv(s0, s1, s2, s3);
+
+        s1 ^= rk[3][0];
+        s2 ^= rk[3][1];
+        s3 ^= rk[3][2];
+        s0 = byte_ror_2(s0);
+        s1 = byte_ror_4(s1);
+        s2 = byte_ror_6(s2);
+        sbox_inv(s3, s1, s2, s0);
+
+        s1 ^= rk[2][0];
+        s2 ^= rk[2][1];
+        s0 ^= rk[2][2];
+        swapmove_1(s1, 0x55555555, 1);
+        swapmove_1(s2, 0x00005555, 1);
+        swapmove_1(s3, 0x55550000, 1);
+        s3 = ror(s3, 16);
+        s2 = ror(s2, 16);
+        sbox_inv(s0, s1, s2, s3);
+
+        s1 ^= rk[1][0];
+        s2 ^= rk[1][1];
+        s3 ^= rk[1][2];
+        s0 = half_ror_12(s0);
+        s1 = half_ror_8(s1);
+        s2 = half_ror_4(s2);
+        sbox_inv(s3, s1, s2, s0);
+
+        s1 ^= rk[0][0];
+        s2 ^= rk[0][1];
+        s0 ^= rk[0][2];
+        s3 = nibble_ror_3(s3);
+        s1 = nibble_ror_2(s1);
+        s2 = nibble_ror_1(s2);
+        sbox_inv(s0, s1, s2, s3);
+
+        s[0] = s0;
+        s[1] = s1;
+        s[2] = s2;
+        s[3] = s3;
+}
+
+void gift_128_fixsliced_bits_pack(uint32_t s[restrict 4], const uint8_t m[restrict 16])
+{
+        memcpy(s, m, 16);
+
+        // within every word: bit j of nibbles 0-7 into byte j
+        for (size_t i = 0; i < 4; i++) {
+                swapmove_1(s[i], 0x0a0a0a0a, 3);
+                swapmove_1(s[i], 0x00cc00cc, 6);
+                swapmove_1(s[i], 0x0000f0f0, 12);
+                swapmove_1(s[i], 0x0000ff00, 8);
+        }
+
+        // 4x4 byte transpose, word j gets byte j of every word
+        swapmove_2(s[0], s[2], 0x0000ffff, 16);
+        swapmove_2(s[1], s[3], 0x0000ffff, 16);
+        swapmove_2(s[0], s[1], 0x00ff00ff, 8);
+        swapmove_2(s[2], s[3], 0x00ff00ff, 8);
+}
+
+void gift_128_fixsliced_bits_unpack(uint8_t m[restrict 16], const uint32_t s_[restrict 4])
+{
+        uint32_t s[4] = { s_[0], s_[1], s_[2], s_[3] };
+
+        // the swapmoves of gift_128_fixsliced_bits_pack in reverse
+        swapmove_2(s[2], s[3], 0x00ff00ff, 8);
+        swapmove_2(s[0], s[1], 0x00ff00ff, 8);
+        swapmove_2(s[1], s[3], 0x0000ffff, 16);
+        swapmove_2(s[0], s[2], 0x0000ffff, 16);
+
+        for (size_t i = 0; i < 4; i++) {
+                swapmove_1(s[i], 0x0000ff00, 8);
+                swapmove_1(s[i], 0x0000f0f0, 12);
+                swapmove_1(s[i], 0x00cc00cc, 6);
+                swapmove_1(s[i], 0x0a0a0a0a, 3);
+        }
+
+        memcpy(m, s, 16);
+}
+
+void gift_128_fixsliced_generate_round_keys(uint32_t rks[restrict ROUNDS_GIFT_128][3],
+                                            const uint64_t key[restrict 2])
+{
+        uint8_t round_keys[ROUNDS_GIFT_128][32];
+        gift_128_generate_round_keys(round_keys, key);
+
+        // bit b of every word holds nibble layout[b]; slice 3 never moves, so
+        // after each round the layout is that of slice 3 permuted once more
+        uint8_t layout[32];
+        for (size_t b = 0; b < 32; b++) {
+                layout[b] = b;
+        }
+
+        for (int round = 0; round < ROUNDS_GIFT_128; round++) {
+                for (size_t b = 0; b < 32; b++) {
+                        layout[b] = perm_slice_3[layout[b]];
+                }
+
+                // V (bit 1), U (bit 2), round constant and single bit (bit 3)
+                rks[round][0] = rks[round][1] = rks[round][2] = 0;
+                for (size_t b = 0; b < 32; b++) {
+                        const uint8_t rk = round_keys[round][layout[b]];
+                        rks[round][0] |= (uint32_t)((rk >> 1) & 0x1) << b;
+                        rks[round][1] |= (uint32_t)((rk >> 2) & 0x1) << b;
+                        rks[round][2] |= (uint32_t)((rk >> 3) & 0x1) << b;
+                }
+        }
+}
+
+void gift_128_fixsliced_encrypt_bits(uint32_t s[restrict 4],
+                                     const uint32_t rks[restrict ROUNDS_GIFT_128][3])
+{
+        for (int round = 0; round < ROUNDS_GIFT_128; round += 5) {
+                quintuple_round(s, &rks[round]);
+        }
+}
+
+void gift_128_fixsliced_encrypt(uint8_t c[restrict 16],
+                                const uint8_t m[restrict 16],
+                                const uint32_t rks[restrict ROUNDS_GIFT_128][3])
+{
+        uint32_t s[4];
+        gift_128_fixsliced_bits_pack(s, m);
+        gift_128_fixsliced_encrypt_bits(s, rks);
+        gift_128_fixsliced_bits_unpack(c, s);
+}
+
+void gift_128_fixsliced_decrypt(uint8_t m[restrict 16],
+                                const uint8_t c[restrict 16],
+                                const uint32_t rks[restrict ROUNDS_GIFT_128][3])
+{
+        uint32_t s[4];
+        gift_128_fixsliced_bits_pack(s, c);
+
+        for (int round = ROUNDS_GIFT_128 - 5; round >= 0; round -= 5) {
+                quintuple_round_inv(s, &rks[round]);
+        }
+
+        gift_128_fixsliced_bits_unpack(m, s);
+}
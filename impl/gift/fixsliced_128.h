@@ -0,0 +1,31 @@
+#pragma once
+
+// fixsliced GIFT-128 on 32-bit words for cores without NEON, one block at a
+// time. the state is bitsliced (word j holds bit j of every nibble) and the
+// bit permutation is never applied: every slice drifts through five layouts
+// that only need rotations and swapmoves, and the round keys are laid out to
+// match
+
+#include <stdint.h>
+
+#define ROUNDS_GIFT_128 40
+
+// expose for benchmarking
+void gift_128_fixsliced_bits_pack(uint32_t s[restrict 4], const uint8_t m[restrict 16]);
+void gift_128_fixsliced_bits_unpack(uint8_t m[restrict 16], const uint32_t s[restrict 4]);
+
+// per round: key words for slices 1 and 2, round constant word for slice 3
+void gift_128_fixsliced_generate_round_keys(uint32_t rks[restrict ROUNDS_GIFT_128][3],
+                                            const uint64_t key[restrict 2]);
+
+// the rounds alone on a packed state; word j is the big-endian word S_j of the
+// GIFT-COFB specification, so COFB loads its blocks straight into it
+void gift_128_fixsliced_encrypt_bits(uint32_t s[restrict 4],
+                                     const uint32_t rks[restrict ROUNDS_GIFT_128][3]);
+
+void gift_128_fixsliced_encrypt(uint8_t c[restrict 16],
+                                const uint8_t m[restrict 16],
+                                const uint32_t rks[restrict ROUNDS_GIFT_128][3]);
+void gift_128_fixsliced_decrypt(uint8_t m[restrict 16],
+                                const uint8_t c[restrict 16],
+                                const uint32_t rks[restrict ROUNDS_GIFT_128][3]);
@@ -1,5 +1,7 @@
 #include <stdint.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <string.h>
 
 #include "sliced.h"
 
@@ -198,77 +200,115 @@ void gift_64_sliced_permute_inv(uint64_t s[8])
         dst[63] = src[7][1];
 }
 
-void gift_64_sliced_encrypt(uint64_t c[8], const uint64_t m[8], const uint64_t key[2])
+void gift_64_sliced_ctx_init(struct gift_64_sliced_ctx *restrict ctx, const uint64_t key[2])
 {
-        // generate round keys
-        uint64_t round_keys[ROUNDS_GIFT_SLICED_64][8];
-        gift_64_sliced_generate_round_keys(round_keys, key);
+        gift_64_sliced_generate_round_keys(ctx->rks, key);
+}
 
-        // copy to state (eight 64-bit "registers") and pack message bits
-        uint64_t state[8];
-        memcpy(state, m, 8 * sizeof(m[0]));
-        bits_pack(state);
+static inline void encrypt_groups(const struct gift_64_sliced_ctx *restrict ctx,
+                                  uint64_t *c, const uint64_t *m, size_t ngroups,
+                                  const int start, const int end)
+{
+        for (size_t g = 0; g < ngroups; g++, c += 8, m += 8) {
+                // copy to state (eight 64-bit "registers") and pack message bits
+                uint64_t state[8];
+                memcpy(state, m, sizeof(state));
+                bits_pack(state);
 
-        // round loop
-        for (int round = 0; round < ROUNDS_GIFT_SLICED_64; round++) {
-                gift_64_sliced_subcells(state);
+                // round loop
+                for (int round = start; round < end; round++) {
+                        gift_64_sliced_subcells(state);
 #ifdef DEBUG
-                printf("GIFT_64_SLICED_ENCRYPT round %02d, subcells:      ", round);
-                print_unpacked(state);
+                        printf("GIFT_64_SLICED_ENCRYPT round %02d, subcells:      ", round);
+                        print_unpacked(state);
 #endif
-                gift_64_sliced_permute(state);
+                        gift_64_sliced_permute(state);
 #ifdef DEBUG
-                printf("GIFT_64_SLICED_ENCRYPT round %02d, permbits:      ", round);
-                print_unpacked(state);
+                        printf("GIFT_64_SLICED_ENCRYPT round %02d, permbits:      ", round);
+                        print_unpacked(state);
 #endif
-                for (size_t j = 0; j < 8; j++) {
-                        state[j] ^= round_keys[round][j];
-                }
+                        for (size_t j = 0; j < 8; j++) {
+                                state[j] ^= ctx->rks[round][j];
+                        }
 #ifdef DEBUG
-                printf("GIFT_64_SLICED_ENCRYPT round %02d, add round key: ", round);
-                print_unpacked(state);
+                        printf("GIFT_64_SLICED_ENCRYPT round %02d, add round key: ", round);
+                        print_unpacked(state);
 #endif
+                }
+
+                // unpack ciphertext bits and copy to ciphertext buffer
+                bits_pack(state);
+                memcpy(c, state, sizeof(state));
         }
+}
 
-        // unpack ciphertext bits and copy to ciphertext buffer
-        bits_pack(state);
-        memcpy(c, state, 8 * sizeof(state[0]));
+void gift_64_sliced_encrypt_groups(const struct gift_64_sliced_ctx *restrict ctx,
+                                   uint64_t *c, const uint64_t *m, size_t ngroups)
+{
+        encrypt_groups(ctx, c, m, ngroups, 0, ROUNDS_GIFT_SLICED_64);
 }
 
-void gift_64_sliced_decrypt(uint64_t m[8], const uint64_t c[8], const uint64_t key[2])
+void gift_64_sliced_encrypt_groups_rounds(const struct gift_64_sliced_ctx *restrict ctx,
+                                          uint64_t *c, const uint64_t *m, size_t ngroups,
+                                          const int start, const int end)
 {
-        // generate round keys
-        uint64_t round_keys[ROUNDS_GIFT_SLICED_64][8];
-        gift_64_sliced_generate_round_keys(round_keys, key);
-
-        // copy to state (eight 64-bit "registers") and pack message bits
-        uint64_t state[8];
-        memcpy(state, c, 8 * sizeof(m[0]));
-        bits_pack(state);
-
-        // round loop
-        for (int round = ROUNDS_GIFT_SLICED_64 - 1; round >= 0; round--) {
-                for (size_t j = 0; j < 8; j++) {
-                        state[j] ^= round_keys[round][j];
-                }
+        encrypt_groups(ctx, c, m, ngroups, start, end);
+}
+
+void gift_64_sliced_decrypt_groups(const struct gift_64_sliced_ctx *restrict ctx,
+                                   uint64_t *m, const uint64_t *c, size_t ngroups)
+{
+        for (size_t g = 0; g < ngroups; g++, c += 8, m += 8) {
+                // copy to state (eight 64-bit "registers") and pack message bits
+                uint64_t state[8];
+                memcpy(state, c, sizeof(state));
+                bits_pack(state);
+
+                // round loop
+                for (int round = ROUNDS_GIFT_SLICED_64 - 1; round >= 0; round--) {
+                        for (size_t j = 0; j < 8; j++) {
+                                state[j] ^= ctx->rks[round][j];
+                        }
 #ifdef DEBUG
-                printf("GIFT_64_SLICED_DECRYPT round %02d, add round key: ", round);
-                print_unpacked(state);
+                        printf("GIFT_64_SLICED_DECRYPT round %02d, add round key: ", round);
+                        print_unpacked(state);
 #endif
-                gift_64_sliced_permute_inv(state);
-
+                        gift_64_sliced_permute_inv(state);
 #ifdef DEBUG
-                printf("GIFT_64_SLICED_DECRYPT round %02d, permbits inv:  ", round);
-                print_unpacked(state);
+                        printf("GIFT_64_SLICED_DECRYPT round %02d, permbits inv:  ", round);
+                        print_unpacked(state);
 #endif
-                gift_64_sliced_subcells_inv(state);
+                        gift_64_sliced_subcells_inv(state);
 #ifdef DEBUG
-                printf("GIFT_64_SLICED_DECRYPT round %02d, subcells inv:  ", round);
-                print_unpacked(state);
+                        printf("GIFT_64_SLICED_DECRYPT round %02d, subcells inv:  ", round);
+                        print_unpacked(state);
 #endif
+                }
+
+                // unpack message bits and copy to message buffer
+                bits_pack(state);
+                memcpy(m, state, sizeof(state));
         }
+}
+
+void gift_64_sliced_encrypt(uint64_t c[8], const uint64_t m[8], const uint64_t key[2])
+{
+        struct gift_64_sliced_ctx ctx;
+        gift_64_sliced_ctx_init(&ctx, key);
+        gift_64_sliced_encrypt_groups(&ctx, c, m, 1);
+}
 
-        // unpack message bits and copy to message buffer
-        bits_pack(state);
-        memcpy(m, state, 8 * sizeof(state[0]));
+void gift_64_sliced_encrypt_rounds(uint64_t c[8], const uint64_t m[8], const uint64_t key[2],
+                                   const int start, const int end)
+{
+        struct gift_64_sliced_ctx ctx;
+        gift_64_sliced_ctx_init(&ctx, key);
+        encrypt_groups(&ctx, c, m, 1, start, end);
+}
+
+void gift_64_sliced_decrypt(uint64_t m[8], const uint64_t c[8], const uint64_t key[2])
+{
+        struct gift_64_sliced_ctx ctx;
+        gift_64_sliced_ctx_init(&ctx, key);
+        gift_64_sliced_decrypt_groups(&ctx, m, c, 1);
 }
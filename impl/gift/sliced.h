@@ -1,9 +1,15 @@
 #pragma once
 
 #include <stdint.h>
+#include <stddef.h>
 
 #define ROUNDS_GIFT_SLICED_64 28
 
+// expanded key, set up once by gift_64_sliced_ctx_init()
+struct gift_64_sliced_ctx {
+        uint64_t rks[ROUNDS_GIFT_SLICED_64][8];
+};
+
 void swapmove(uint64_t *a, uint64_t *b, uint64_t m, int n);
 void bits_pack(uint64_t m[8]);
 
@@ -14,5 +20,21 @@ void gift_64_sliced_subcells_inv(uint64_t s[8]);
 void gift_64_sliced_permute(uint64_t s[8]);
 void gift_64_sliced_permute_inv(uint64_t s[8]);
 
+void gift_64_sliced_ctx_init(struct gift_64_sliced_ctx *restrict ctx, const uint64_t key[2]);
+
+// ngroups groups of 8 blocks, c and m may be the same buffer
+void gift_64_sliced_encrypt_groups(const struct gift_64_sliced_ctx *restrict ctx,
+                                   uint64_t *c, const uint64_t *m, size_t ngroups);
+// rounds start to end - 1 only (with the keys of those rounds), for
+// reduced-round analysis; [a, b) followed by [b, c) is [a, c)
+void gift_64_sliced_encrypt_groups_rounds(const struct gift_64_sliced_ctx *restrict ctx,
+                                          uint64_t *c, const uint64_t *m, size_t ngroups,
+                                          int start, int end);
+void gift_64_sliced_decrypt_groups(const struct gift_64_sliced_ctx *restrict ctx,
+                                   uint64_t *m, const uint64_t *c, size_t ngroups);
+
+// single group, expands the key on every call
 void gift_64_sliced_encrypt(uint64_t c[8], const uint64_t m[8], const uint64_t key[2]);
+void gift_64_sliced_encrypt_rounds(uint64_t c[8], const uint64_t m[8], const uint64_t key[2],
+                                   int start, int end);
 void gift_64_sliced_decrypt(uint64_t m[8], const uint64_t c[8], const uint64_t key[2]);
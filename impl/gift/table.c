@@ -2,6 +2,7 @@
 #include <stddef.h>
 
 #include "table.h"
+#include "table_bytes.h"
 
 static const int round_const[] = {
         // rounds 0-15
@@ -34,6 +35,36 @@ static const uint64_t tables[16][16] = {
         { 0x0000000010000000UL, 0x0000200000008000UL, 0x4000000000000000UL, 0x4000000000008000UL, 0x4000200000000000UL, 0x4000200010008000UL, 0x0000200010000000UL, 0x0000000010008000UL, 0x0000200000000000UL, 0x4000000010008000UL, 0x0000200010008000UL, 0x4000200010000000UL, 0x4000000010000000UL, 0x0000000000000000UL, 0x0000000000008000UL, 0x4000200000008000UL }
 };
 
+// inverse S-box followed by inverse permutation (scripts/table_64_inv.py)
+static const uint64_t tables_inv[16][16] = {
+        { 0x0000000000008401UL, 0x0000000000000000UL, 0x0000000000008000UL, 0x0000000000000420UL, 0x0000000000000020UL, 0x0000000000008400UL, 0x0000000000000400UL, 0x0000000000008021UL, 0x0000000000008420UL, 0x0000000000000421UL, 0x0000000000000001UL, 0x0000000000008020UL, 0x0000000000000021UL, 0x0000000000008001UL, 0x0000000000008421UL, 0x0000000000000401UL },
+        { 0x0000000084010000UL, 0x0000000000000000UL, 0x0000000080000000UL, 0x0000000004200000UL, 0x0000000000200000UL, 0x0000000084000000UL, 0x0000000004000000UL, 0x0000000080210000UL, 0x0000000084200000UL, 0x0000000004210000UL, 0x0000000000010000UL, 0x0000000080200000UL, 0x0000000000210000UL, 0x0000000080010000UL, 0x0000000084210000UL, 0x0000000004010000UL },
+        { 0x0000840100000000UL, 0x0000000000000000UL, 0x0000800000000000UL, 0x0000042000000000UL, 0x0000002000000000UL, 0x0000840000000000UL, 0x0000040000000000UL, 0x0000802100000000UL, 0x0000842000000000UL, 0x0000042100000000UL, 0x0000000100000000UL, 0x0000802000000000UL, 0x0000002100000000UL, 0x0000800100000000UL, 0x0000842100000000UL, 0x0000040100000000UL },
+        { 0x8401000000000000UL, 0x0000000000000000UL, 0x8000000000000000UL, 0x0420000000000000UL, 0x0020000000000000UL, 0x8400000000000000UL, 0x0400000000000000UL, 0x8021000000000000UL, 0x8420000000000000UL, 0x0421000000000000UL, 0x0001000000000000UL, 0x8020000000000000UL, 0x0021000000000000UL, 0x8001000000000000UL, 0x8421000000000000UL, 0x0401000000000000UL },
+        { 0x0000000000001840UL, 0x0000000000000000UL, 0x0000000000000800UL, 0x0000000000000042UL, 0x0000000000000002UL, 0x0000000000000840UL, 0x0000000000000040UL, 0x0000000000001802UL, 0x0000000000000842UL, 0x0000000000001042UL, 0x0000000000001000UL, 0x0000000000000802UL, 0x0000000000001002UL, 0x0000000000001800UL, 0x0000000000001842UL, 0x0000000000001040UL },
+        { 0x0000000018400000UL, 0x0000000000000000UL, 0x0000000008000000UL, 0x0000000000420000UL, 0x0000000000020000UL, 0x0000000008400000UL, 0x0000000000400000UL, 0x0000000018020000UL, 0x0000000008420000UL, 0x0000000010420000UL, 0x0000000010000000UL, 0x0000000008020000UL, 0x0000000010020000UL, 0x0000000018000000UL, 0x0000000018420000UL, 0x0000000010400000UL },
+        { 0x0000184000000000UL, 0x0000000000000000UL, 0x0000080000000000UL, 0x0000004200000000UL, 0x0000000200000000UL, 0x0000084000000000UL, 0x0000004000000000UL, 0x0000180200000000UL, 0x0000084200000000UL, 0x0000104200000000UL, 0x0000100000000000UL, 0x0000080200000000UL, 0x0000100200000000UL, 0x0000180000000000UL, 0x0000184200000000UL, 0x0000104000000000UL },
+        { 0x1840000000000000UL, 0x0000000000000000UL, 0x0800000000000000UL, 0x0042000000000000UL, 0x0002000000000000UL, 0x0840000000000000UL, 0x0040000000000000UL, 0x1802000000000000UL, 0x0842000000000000UL, 0x1042000000000000UL, 0x1000000000000000UL, 0x0802000000000000UL, 0x1002000000000000UL, 0x1800000000000000UL, 0x1842000000000000UL, 0x1040000000000000UL },
+        { 0x0000000000000184UL, 0x0000000000000000UL, 0x0000000000000080UL, 0x0000000000002004UL, 0x0000000000002000UL, 0x0000000000000084UL, 0x0000000000000004UL, 0x0000000000002180UL, 0x0000000000002084UL, 0x0000000000002104UL, 0x0000000000000100UL, 0x0000000000002080UL, 0x0000000000002100UL, 0x0000000000000180UL, 0x0000000000002184UL, 0x0000000000000104UL },
+        { 0x0000000001840000UL, 0x0000000000000000UL, 0x0000000000800000UL, 0x0000000020040000UL, 0x0000000020000000UL, 0x0000000000840000UL, 0x0000000000040000UL, 0x0000000021800000UL, 0x0000000020840000UL, 0x0000000021040000UL, 0x0000000001000000UL, 0x0000000020800000UL, 0x0000000021000000UL, 0x0000000001800000UL, 0x0000000021840000UL, 0x0000000001040000UL },
+        { 0x0000018400000000UL, 0x0000000000000000UL, 0x0000008000000000UL, 0x0000200400000000UL, 0x0000200000000000UL, 0x0000008400000000UL, 0x0000000400000000UL, 0x0000218000000000UL, 0x0000208400000000UL, 0x0000210400000000UL, 0x0000010000000000UL, 0x0000208000000000UL, 0x0000210000000000UL, 0x0000018000000000UL, 0x0000218400000000UL, 0x0000010400000000UL },
+        { 0x0184000000000000UL, 0x0000000000000000UL, 0x0080000000000000UL, 0x2004000000000000UL, 0x2000000000000000UL, 0x0084000000000000UL, 0x0004000000000000UL, 0x2180000000000000UL, 0x2084000000000000UL, 0x2104000000000000UL, 0x0100000000000000UL, 0x2080000000000000UL, 0x2100000000000000UL, 0x0180000000000000UL, 0x2184000000000000UL, 0x0104000000000000UL },
+        { 0x0000000000004018UL, 0x0000000000000000UL, 0x0000000000000008UL, 0x0000000000004200UL, 0x0000000000000200UL, 0x0000000000004008UL, 0x0000000000004000UL, 0x0000000000000218UL, 0x0000000000004208UL, 0x0000000000004210UL, 0x0000000000000010UL, 0x0000000000000208UL, 0x0000000000000210UL, 0x0000000000000018UL, 0x0000000000004218UL, 0x0000000000004010UL },
+        { 0x0000000040180000UL, 0x0000000000000000UL, 0x0000000000080000UL, 0x0000000042000000UL, 0x0000000002000000UL, 0x0000000040080000UL, 0x0000000040000000UL, 0x0000000002180000UL, 0x0000000042080000UL, 0x0000000042100000UL, 0x0000000000100000UL, 0x0000000002080000UL, 0x0000000002100000UL, 0x0000000000180000UL, 0x0000000042180000UL, 0x0000000040100000UL },
+        { 0x0000401800000000UL, 0x0000000000000000UL, 0x0000000800000000UL, 0x0000420000000000UL, 0x0000020000000000UL, 0x0000400800000000UL, 0x0000400000000000UL, 0x0000021800000000UL, 0x0000420800000000UL, 0x0000421000000000UL, 0x0000001000000000UL, 0x0000020800000000UL, 0x0000021000000000UL, 0x0000001800000000UL, 0x0000421800000000UL, 0x0000401000000000UL },
+        { 0x4018000000000000UL, 0x0000000000000000UL, 0x0008000000000000UL, 0x4200000000000000UL, 0x0200000000000000UL, 0x4008000000000000UL, 0x4000000000000000UL, 0x0218000000000000UL, 0x4208000000000000UL, 0x4210000000000000UL, 0x0010000000000000UL, 0x0208000000000000UL, 0x0210000000000000UL, 0x0018000000000000UL, 0x4218000000000000UL, 0x4010000000000000UL },
+};
+
+static const int sbox[] = {
+        0x1, 0xa, 0x4, 0xc, 0x6, 0xf, 0x3, 0x9,
+        0x2, 0xd, 0xb, 0x7, 0x5, 0x0, 0x8, 0xe
+};
+
+static const int sbox_inv[] = {
+        0xd, 0x0, 0x8, 0x6, 0x2, 0xc, 0x4, 0xb,
+        0xe, 0x7, 0x1, 0xa, 0x3, 0x9, 0xf, 0x5
+};
+
 void gift_64_table_generate_round_keys(uint64_t rks[restrict ROUNDS_GIFT_64],
                                        const uint64_t key[restrict 2])
 {
@@ -86,16 +117,178 @@ uint64_t gift_64_table_subperm(const uint64_t cipher_state)
         return new_cipher_state;
 }
 
-uint64_t gift_64_table_encrypt(const uint64_t m,
-                               const uint64_t rks[restrict ROUNDS_GIFT_64])
+uint64_t gift_64_table_subperm_bytes(const uint64_t cipher_state)
+{
+        uint64_t new_cipher_state = 0;
+
+        for (size_t i = 0; i < 8; i++) {
+                int byte = (cipher_state >> (i * 8)) & 0xff;
+                new_cipher_state ^= tables_bytes[i][byte];
+        }
+
+        return new_cipher_state;
+}
+
+static inline uint64_t encrypt_nibbles(const uint64_t m,
+                                       const uint64_t rks[restrict ROUNDS_GIFT_64],
+                                       const int start, const int end)
 {
         uint64_t c = m;
 
         // round loop
-        for (int round = 0; round < ROUNDS_GIFT_64; round++) {
+        for (int round = start; round < end; round++) {
                 c = gift_64_table_subperm(c);
                 c ^= rks[round];
         }
 
         return c;
 }
+
+static inline uint64_t encrypt_bytes(const uint64_t m,
+                                     const uint64_t rks[restrict ROUNDS_GIFT_64],
+                                     const int start, const int end)
+{
+        uint64_t c = m;
+
+        // round loop
+        for (int round = start; round < end; round++) {
+                c = gift_64_table_subperm_bytes(c);
+                c ^= rks[round];
+        }
+
+        return c;
+}
+
+uint64_t gift_64_table_encrypt_nibbles(const uint64_t m,
+                                       const uint64_t rks[restrict ROUNDS_GIFT_64])
+{
+        return encrypt_nibbles(m, rks, 0, ROUNDS_GIFT_64);
+}
+
+uint64_t gift_64_table_encrypt_bytes(const uint64_t m,
+                                     const uint64_t rks[restrict ROUNDS_GIFT_64])
+{
+        return encrypt_bytes(m, rks, 0, ROUNDS_GIFT_64);
+}
+
+uint64_t gift_64_table_encrypt(const uint64_t m,
+                               const uint64_t rks[restrict ROUNDS_GIFT_64])
+{
+#ifdef GIFT_64_TABLE_BYTES
+        return gift_64_table_encrypt_bytes(m, rks);
+#else
+        return gift_64_table_encrypt_nibbles(m, rks);
+#endif
+}
+
+uint64_t gift_64_table_encrypt_rounds(const uint64_t m,
+                                      const uint64_t rks[restrict ROUNDS_GIFT_64],
+                                      const int start, const int end)
+{
+#ifdef GIFT_64_TABLE_BYTES
+        return encrypt_bytes(m, rks, start, end);
+#else
+        return encrypt_nibbles(m, rks, start, end);
+#endif
+}
+
+void gift_64_table_generate_round_keys_inv(uint64_t rks[restrict ROUNDS_GIFT_64],
+                                           const uint64_t key[restrict 2])
+{
+        gift_64_table_generate_round_keys(rks, key);
+
+        // the rounds are regrouped to S-box^-1, key addition, permutation^-1 so
+        // the tables apply, that moves every key but the last one through the
+        // inverse permutation (which is the inverse table on S-box(key))
+        for (int round = 0; round < ROUNDS_GIFT_64 - 1; round++) {
+                rks[round] = gift_64_table_subperm_inv(gift_64_table_sub(rks[round]));
+        }
+}
+
+uint64_t gift_64_table_sub(const uint64_t cipher_state)
+{
+        uint64_t new_cipher_state = 0;
+
+        for (size_t i = 0; i < 16; i++) {
+                int nibble = (cipher_state >> (i * 4)) & 0xf;
+                new_cipher_state |= (uint64_t)sbox[nibble] << (i * 4);
+        }
+
+        return new_cipher_state;
+}
+
+uint64_t gift_64_table_sub_inv(const uint64_t cipher_state)
+{
+        uint64_t new_cipher_state = 0;
+
+        for (size_t i = 0; i < 16; i++) {
+                int nibble = (cipher_state >> (i * 4)) & 0xf;
+                new_cipher_state |= (uint64_t)sbox_inv[nibble] << (i * 4);
+        }
+
+        return new_cipher_state;
+}
+
+uint64_t gift_64_table_subperm_inv(const uint64_t cipher_state)
+{
+        uint64_t new_cipher_state = 0;
+
+        for (size_t i = 0; i < 16; i++) {
+                int nibble = (cipher_state >> (i * 4)) & 0xf;
+                new_cipher_state ^= tables_inv[i][nibble];
+        }
+
+        return new_cipher_state;
+}
+
+uint64_t gift_64_table_subperm_inv_bytes(const uint64_t cipher_state)
+{
+        uint64_t new_cipher_state = 0;
+
+        for (size_t i = 0; i < 8; i++) {
+                int byte = (cipher_state >> (i * 8)) & 0xff;
+                new_cipher_state ^= tables_bytes_inv[i][byte];
+        }
+
+        return new_cipher_state;
+}
+
+uint64_t gift_64_table_decrypt_nibbles(const uint64_t c,
+                                       const uint64_t rks[restrict ROUNDS_GIFT_64])
+{
+        // last round key and inverse permutation, P^-1(x) = T^-1(S(x))
+        uint64_t m = c ^ rks[ROUNDS_GIFT_64 - 1];
+        m = gift_64_table_subperm_inv(gift_64_table_sub(m));
+
+        // round loop (in reverse), keys are already permuted
+        for (int round = ROUNDS_GIFT_64 - 2; round >= 0; round--) {
+                m = gift_64_table_subperm_inv(m);
+                m ^= rks[round];
+        }
+
+        return gift_64_table_sub_inv(m);
+}
+
+uint64_t gift_64_table_decrypt_bytes(const uint64_t c,
+                                     const uint64_t rks[restrict ROUNDS_GIFT_64])
+{
+        uint64_t m = c ^ rks[ROUNDS_GIFT_64 - 1];
+        m = gift_64_table_subperm_inv_bytes(gift_64_table_sub(m));
+
+        for (int round = ROUNDS_GIFT_64 - 2; round >= 0; round--) {
+                m = gift_64_table_subperm_inv_bytes(m);
+                m ^= rks[round];
+        }
+
+        return gift_64_table_sub_inv(m);
+}
+
+uint64_t gift_64_table_decrypt(const uint64_t c,
+                               const uint64_t rks[restrict ROUNDS_GIFT_64])
+{
+#ifdef GIFT_64_TABLE_BYTES
+        return gift_64_table_decrypt_bytes(c, rks);
+#else
+        return gift_64_table_decrypt_nibbles(c, rks);
+#endif
+}
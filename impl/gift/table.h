@@ -7,8 +7,36 @@
 void gift_64_table_generate_round_keys(uint64_t rks[restrict ROUNDS_GIFT_64],
                                  const uint64_t key[restrict 2]);
 
+// decryption keys differ from the encryption ones (permuted, see table.c)
+void gift_64_table_generate_round_keys_inv(uint64_t rks[restrict ROUNDS_GIFT_64],
+                                           const uint64_t key[restrict 2]);
+
+uint64_t gift_64_table_sub(const uint64_t cipher_state);
+uint64_t gift_64_table_sub_inv(const uint64_t cipher_state);
 uint64_t gift_64_table_subperm(const uint64_t cipher_state);
+uint64_t gift_64_table_subperm_inv(const uint64_t cipher_state);
+uint64_t gift_64_table_subperm_bytes(const uint64_t cipher_state);
+uint64_t gift_64_table_subperm_inv_bytes(const uint64_t cipher_state);
+
+// 16 lookups per round into 16x16 tables (2 KiB) or 8 lookups into 8x256
+// tables (16 KiB)
+uint64_t gift_64_table_encrypt_nibbles(const uint64_t m,
+                                       const uint64_t rks[restrict ROUNDS_GIFT_64]);
+uint64_t gift_64_table_decrypt_nibbles(const uint64_t c,
+                                       const uint64_t rks[restrict ROUNDS_GIFT_64]);
+uint64_t gift_64_table_encrypt_bytes(const uint64_t m,
+                                     const uint64_t rks[restrict ROUNDS_GIFT_64]);
+uint64_t gift_64_table_decrypt_bytes(const uint64_t c,
+                                     const uint64_t rks[restrict ROUNDS_GIFT_64]);
 
-// can only encrypt using table technique!
+// one of the above, the byte tables if built with -DGIFT_64_TABLE_BYTES
+// (make TABLE=bytes)
 uint64_t gift_64_table_encrypt(const uint64_t m,
                                const uint64_t rks[restrict ROUNDS_GIFT_64]);
+// rounds start to end - 1 only (with rks[start] to rks[end - 1] of the full
+// schedule), for reduced-round analysis; [a, b) followed by [b, c) is [a, c)
+uint64_t gift_64_table_encrypt_rounds(const uint64_t m,
+                                      const uint64_t rks[restrict ROUNDS_GIFT_64],
+                                      int start, int end);
+uint64_t gift_64_table_decrypt(const uint64_t c,
+                               const uint64_t rks[restrict ROUNDS_GIFT_64]);
@@ -0,0 +1,1067 @@
+#pragma once
+
+// generated by scripts/table_64_bytes.py, included by table.c only
+
+#include <stdint.h>
+
+static const uint64_t tables_bytes[8][256] = {
+        {
+                0x0001000000000001UL, 0x0009000000020000UL, 0x0001000400000000UL, 0x0009000400000000UL,
+                0x0001000400020000UL, 0x0009000400020001UL, 0x0001000000020001UL, 0x0009000000000001UL,
+                0x0001000000020000UL, 0x0009000400000001UL, 0x0009000000020001UL, 0x0001000400020001UL,
+                0x0001000400000001UL, 0x0001000000000000UL, 0x0009000000000000UL, 0x0009000400020000UL,
+                0x0000000800000003UL, 0x0008000800020002UL, 0x0000000c00000002UL, 0x0008000c00000002UL,
+                0x0000000c00020002UL, 0x0008000c00020003UL, 0x0000000800020003UL, 0x0008000800000003UL,
+                0x0000000800020002UL, 0x0008000c00000003UL, 0x0008000800020003UL, 0x0000000c00020003UL,
+                0x0000000c00000003UL, 0x0000000800000002UL, 0x0008000800000002UL, 0x0008000c00020002UL,
+                0x0000000000040001UL, 0x0008000000060000UL, 0x0000000400040000UL, 0x0008000400040000UL,
+                0x0000000400060000UL, 0x0008000400060001UL, 0x0000000000060001UL, 0x0008000000040001UL,
+                0x0000000000060000UL, 0x0008000400040001UL, 0x0008000000060001UL, 0x0000000400060001UL,
+                0x0000000400040001UL, 0x0000000000040000UL, 0x0008000000040000UL, 0x0008000400060000UL,
+                0x0000000800040001UL, 0x0008000800060000UL, 0x0000000c00040000UL, 0x0008000c00040000UL,
+                0x0000000c00060000UL, 0x0008000c00060001UL, 0x0000000800060001UL, 0x0008000800040001UL,
+                0x0000000800060000UL, 0x0008000c00040001UL, 0x0008000800060001UL, 0x0000000c00060001UL,
+                0x0000000c00040001UL, 0x0000000800040000UL, 0x0008000800040000UL, 0x0008000c00060000UL,
+                0x0000000000040003UL, 0x0008000000060002UL, 0x0000000400040002UL, 0x0008000400040002UL,
+                0x0000000400060002UL, 0x0008000400060003UL, 0x0000000000060003UL, 0x0008000000040003UL,
+                0x0000000000060002UL, 0x0008000400040003UL, 0x0008000000060003UL, 0x0000000400060003UL,
+                0x0000000400040003UL, 0x0000000000040002UL, 0x0008000000040002UL, 0x0008000400060002UL,
+                0x0001000800040003UL, 0x0009000800060002UL, 0x0001000c00040002UL, 0x0009000c00040002UL,
+                0x0001000c00060002UL, 0x0009000c00060003UL, 0x0001000800060003UL, 0x0009000800040003UL,
+                0x0001000800060002UL, 0x0009000c00040003UL, 0x0009000800060003UL, 0x0001000c00060003UL,
+                0x0001000c00040003UL, 0x0001000800040002UL, 0x0009000800040002UL, 0x0009000c00060002UL,
+                0x0001000000000003UL, 0x0009000000020002UL, 0x0001000400000002UL, 0x0009000400000002UL,
+                0x0001000400020002UL, 0x0009000400020003UL, 0x0001000000020003UL, 0x0009000000000003UL,
+                0x0001000000020002UL, 0x0009000400000003UL, 0x0009000000020003UL, 0x0001000400020003UL,
+                0x0001000400000003UL, 0x0001000000000002UL, 0x0009000000000002UL, 0x0009000400020002UL,
+                0x0001000800000001UL, 0x0009000800020000UL, 0x0001000c00000000UL, 0x0009000c00000000UL,
+                0x0001000c00020000UL, 0x0009000c00020001UL, 0x0001000800020001UL, 0x0009000800000001UL,
+                0x0001000800020000UL, 0x0009000c00000001UL, 0x0009000800020001UL, 0x0001000c00020001UL,
+                0x0001000c00000001UL, 0x0001000800000000UL, 0x0009000800000000UL, 0x0009000c00020000UL,
+                0x0000000000000003UL, 0x0008000000020002UL, 0x0000000400000002UL, 0x0008000400000002UL,
+                0x0000000400020002UL, 0x0008000400020003UL, 0x0000000000020003UL, 0x0008000000000003UL,
+                0x0000000000020002UL, 0x0008000400000003UL, 0x0008000000020003UL, 0x0000000400020003UL,
+                0x0000000400000003UL, 0x0000000000000002UL, 0x0008000000000002UL, 0x0008000400020002UL,
+                0x0001000800040001UL, 0x0009000800060000UL, 0x0001000c00040000UL, 0x0009000c00040000UL,
+                0x0001000c00060000UL, 0x0009000c00060001UL, 0x0001000800060001UL, 0x0009000800040001UL,
+                0x0001000800060000UL, 0x0009000c00040001UL, 0x0009000800060001UL, 0x0001000c00060001UL,
+                0x0001000c00040001UL, 0x0001000800040000UL, 0x0009000800040000UL, 0x0009000c00060000UL,
+                0x0001000800000003UL, 0x0009000800020002UL, 0x0001000c00000002UL, 0x0009000c00000002UL,
+                0x0001000c00020002UL, 0x0009000c00020003UL, 0x0001000800020003UL, 0x0009000800000003UL,
+                0x0001000800020002UL, 0x0009000c00000003UL, 0x0009000800020003UL, 0x0001000c00020003UL,
+                0x0001000c00000003UL, 0x0001000800000002UL, 0x0009000800000002UL, 0x0009000c00020002UL,
+                0x0001000000040003UL, 0x0009000000060002UL, 0x0001000400040002UL, 0x0009000400040002UL,
+                0x0001000400060002UL, 0x0009000400060003UL, 0x0001000000060003UL, 0x0009000000040003UL,
+                0x0001000000060002UL, 0x0009000400040003UL, 0x0009000000060003UL, 0x0001000400060003UL,
+                0x0001000400040003UL, 0x0001000000040002UL, 0x0009000000040002UL, 0x0009000400060002UL,
+                0x0001000000040001UL, 0x0009000000060000UL, 0x0001000400040000UL, 0x0009000400040000UL,
+                0x0001000400060000UL, 0x0009000400060001UL, 0x0001000000060001UL, 0x0009000000040001UL,
+                0x0001000000060000UL, 0x0009000400040001UL, 0x0009000000060001UL, 0x0001000400060001UL,
+                0x0001000400040001UL, 0x0001000000040000UL, 0x0009000000040000UL, 0x0009000400060000UL,
+                0x0000000000000001UL, 0x0008000000020000UL, 0x0000000400000000UL, 0x0008000400000000UL,
+                0x0000000400020000UL, 0x0008000400020001UL, 0x0000000000020001UL, 0x0008000000000001UL,
+                0x0000000000020000UL, 0x0008000400000001UL, 0x0008000000020001UL, 0x0000000400020001UL,
+                0x0000000400000001UL, 0x0000000000000000UL, 0x0008000000000000UL, 0x0008000400020000UL,
+                0x0000000800000001UL, 0x0008000800020000UL, 0x0000000c00000000UL, 0x0008000c00000000UL,
+                0x0000000c00020000UL, 0x0008000c00020001UL, 0x0000000800020001UL, 0x0008000800000001UL,
+                0x0000000800020000UL, 0x0008000c00000001UL, 0x0008000800020001UL, 0x0000000c00020001UL,
+                0x0000000c00000001UL, 0x0000000800000000UL, 0x0008000800000000UL, 0x0008000c00020000UL,
+                0x0000000800040003UL, 0x0008000800060002UL, 0x0000000c00040002UL, 0x0008000c00040002UL,
+                0x0000000c00060002UL, 0x0008000c00060003UL, 0x0000000800060003UL, 0x0008000800040003UL,
+                0x0000000800060002UL, 0x0008000c00040003UL, 0x0008000800060003UL, 0x0000000c00060003UL,
+                0x0000000c00040003UL, 0x0000000800040002UL, 0x0008000800040002UL, 0x0008000c00060002UL,
+        },
+        {
+                0x0000000100010000UL, 0x0002000000090000UL, 0x0000000000010004UL, 0x0000000000090004UL,
+                0x0002000000010004UL, 0x0002000100090004UL, 0x0002000100010000UL, 0x0000000100090000UL,
+                0x0002000000010000UL, 0x0000000100090004UL, 0x0002000100090000UL, 0x0002000100010004UL,
+                0x0000000100010004UL, 0x0000000000010000UL, 0x0000000000090000UL, 0x0002000000090004UL,
+                0x0000000300000008UL, 0x0002000200080008UL, 0x000000020000000cUL, 0x000000020008000cUL,
+                0x000200020000000cUL, 0x000200030008000cUL, 0x0002000300000008UL, 0x0000000300080008UL,
+                0x0002000200000008UL, 0x000000030008000cUL, 0x0002000300080008UL, 0x000200030000000cUL,
+                0x000000030000000cUL, 0x0000000200000008UL, 0x0000000200080008UL, 0x000200020008000cUL,
+                0x0004000100000000UL, 0x0006000000080000UL, 0x0004000000000004UL, 0x0004000000080004UL,
+                0x0006000000000004UL, 0x0006000100080004UL, 0x0006000100000000UL, 0x0004000100080000UL,
+                0x0006000000000000UL, 0x0004000100080004UL, 0x0006000100080000UL, 0x0006000100000004UL,
+                0x0004000100000004UL, 0x0004000000000000UL, 0x0004000000080000UL, 0x0006000000080004UL,
+                0x0004000100000008UL, 0x0006000000080008UL, 0x000400000000000cUL, 0x000400000008000cUL,
+                0x000600000000000cUL, 0x000600010008000cUL, 0x0006000100000008UL, 0x0004000100080008UL,
+                0x0006000000000008UL, 0x000400010008000cUL, 0x0006000100080008UL, 0x000600010000000cUL,
+                0x000400010000000cUL, 0x0004000000000008UL, 0x0004000000080008UL, 0x000600000008000cUL,
+                0x0004000300000000UL, 0x0006000200080000UL, 0x0004000200000004UL, 0x0004000200080004UL,
+                0x0006000200000004UL, 0x0006000300080004UL, 0x0006000300000000UL, 0x0004000300080000UL,
+                0x0006000200000000UL, 0x0004000300080004UL, 0x0006000300080000UL, 0x0006000300000004UL,
+                0x0004000300000004UL, 0x0004000200000000UL, 0x0004000200080000UL, 0x0006000200080004UL,
+                0x0004000300010008UL, 0x0006000200090008UL, 0x000400020001000cUL, 0x000400020009000cUL,
+                0x000600020001000cUL, 0x000600030009000cUL, 0x0006000300010008UL, 0x0004000300090008UL,
+                0x0006000200010008UL, 0x000400030009000cUL, 0x0006000300090008UL, 0x000600030001000cUL,
+                0x000400030001000cUL, 0x0004000200010008UL, 0x0004000200090008UL, 0x000600020009000cUL,
+                0x0000000300010000UL, 0x0002000200090000UL, 0x0000000200010004UL, 0x0000000200090004UL,
+                0x0002000200010004UL, 0x0002000300090004UL, 0x0002000300010000UL, 0x0000000300090000UL,
+                0x0002000200010000UL, 0x0000000300090004UL, 0x0002000300090000UL, 0x0002000300010004UL,
+                0x0000000300010004UL, 0x0000000200010000UL, 0x0000000200090000UL, 0x0002000200090004UL,
+                0x0000000100010008UL, 0x0002000000090008UL, 0x000000000001000cUL, 0x000000000009000cUL,
+                0x000200000001000cUL, 0x000200010009000cUL, 0x0002000100010008UL, 0x0000000100090008UL,
+                0x0002000000010008UL, 0x000000010009000cUL, 0x0002000100090008UL, 0x000200010001000cUL,
+                0x000000010001000cUL, 0x0000000000010008UL, 0x0000000000090008UL, 0x000200000009000cUL,
+                0x0000000300000000UL, 0x0002000200080000UL, 0x0000000200000004UL, 0x0000000200080004UL,
+                0x0002000200000004UL, 0x0002000300080004UL, 0x0002000300000000UL, 0x0000000300080000UL,
+                0x0002000200000000UL, 0x0000000300080004UL, 0x0002000300080000UL, 0x0002000300000004UL,
+                0x0000000300000004UL, 0x0000000200000000UL, 0x0000000200080000UL, 0x0002000200080004UL,
+                0x0004000100010008UL, 0x0006000000090008UL, 0x000400000001000cUL, 0x000400000009000cUL,
+                0x000600000001000cUL, 0x000600010009000cUL, 0x0006000100010008UL, 0x0004000100090008UL,
+                0x0006000000010008UL, 0x000400010009000cUL, 0x0006000100090008UL, 0x000600010001000cUL,
+                0x000400010001000cUL, 0x0004000000010008UL, 0x0004000000090008UL, 0x000600000009000cUL,
+                0x0000000300010008UL, 0x0002000200090008UL, 0x000000020001000cUL, 0x000000020009000cUL,
+                0x000200020001000cUL, 0x000200030009000cUL, 0x0002000300010008UL, 0x0000000300090008UL,
+                0x0002000200010008UL, 0x000000030009000cUL, 0x0002000300090008UL, 0x000200030001000cUL,
+                0x000000030001000cUL, 0x0000000200010008UL, 0x0000000200090008UL, 0x000200020009000cUL,
+                0x0004000300010000UL, 0x0006000200090000UL, 0x0004000200010004UL, 0x0004000200090004UL,
+                0x0006000200010004UL, 0x0006000300090004UL, 0x0006000300010000UL, 0x0004000300090000UL,
+                0x0006000200010000UL, 0x0004000300090004UL, 0x0006000300090000UL, 0x0006000300010004UL,
+                0x0004000300010004UL, 0x0004000200010000UL, 0x0004000200090000UL, 0x0006000200090004UL,
+                0x0004000100010000UL, 0x0006000000090000UL, 0x0004000000010004UL, 0x0004000000090004UL,
+                0x0006000000010004UL, 0x0006000100090004UL, 0x0006000100010000UL, 0x0004000100090000UL,
+                0x0006000000010000UL, 0x0004000100090004UL, 0x0006000100090000UL, 0x0006000100010004UL,
+                0x0004000100010004UL, 0x0004000000010000UL, 0x0004000000090000UL, 0x0006000000090004UL,
+                0x0000000100000000UL, 0x0002000000080000UL, 0x0000000000000004UL, 0x0000000000080004UL,
+                0x0002000000000004UL, 0x0002000100080004UL, 0x0002000100000000UL, 0x0000000100080000UL,
+                0x0002000000000000UL, 0x0000000100080004UL, 0x0002000100080000UL, 0x0002000100000004UL,
+                0x0000000100000004UL, 0x0000000000000000UL, 0x0000000000080000UL, 0x0002000000080004UL,
+                0x0000000100000008UL, 0x0002000000080008UL, 0x000000000000000cUL, 0x000000000008000cUL,
+                0x000200000000000cUL, 0x000200010008000cUL, 0x0002000100000008UL, 0x0000000100080008UL,
+                0x0002000000000008UL, 0x000000010008000cUL, 0x0002000100080008UL, 0x000200010000000cUL,
+                0x000000010000000cUL, 0x0000000000000008UL, 0x0000000000080008UL, 0x000200000008000cUL,
+                0x0004000300000008UL, 0x0006000200080008UL, 0x000400020000000cUL, 0x000400020008000cUL,
+                0x000600020000000cUL, 0x000600030008000cUL, 0x0006000300000008UL, 0x0004000300080008UL,
+                0x0006000200000008UL, 0x000400030008000cUL, 0x0006000300080008UL, 0x000600030000000cUL,
+                0x000400030000000cUL, 0x0004000200000008UL, 0x0004000200080008UL, 0x000600020008000cUL,
+        },
+        {
+                0x0010000000000010UL, 0x0090000000200000UL, 0x0010004000000000UL, 0x0090004000000000UL,
+                0x0010004000200000UL, 0x0090004000200010UL, 0x0010000000200010UL, 0x0090000000000010UL,
+                0x0010000000200000UL, 0x0090004000000010UL, 0x0090000000200010UL, 0x0010004000200010UL,
+                0x0010004000000010UL, 0x0010000000000000UL, 0x0090000000000000UL, 0x0090004000200000UL,
+                0x0000008000000030UL, 0x0080008000200020UL, 0x000000c000000020UL, 0x008000c000000020UL,
+                0x000000c000200020UL, 0x008000c000200030UL, 0x0000008000200030UL, 0x0080008000000030UL,
+                0x0000008000200020UL, 0x008000c000000030UL, 0x0080008000200030UL, 0x000000c000200030UL,
+                0x000000c000000030UL, 0x0000008000000020UL, 0x0080008000000020UL, 0x008000c000200020UL,
+                0x0000000000400010UL, 0x0080000000600000UL, 0x0000004000400000UL, 0x0080004000400000UL,
+                0x0000004000600000UL, 0x0080004000600010UL, 0x0000000000600010UL, 0x0080000000400010UL,
+                0x0000000000600000UL, 0x0080004000400010UL, 0x0080000000600010UL, 0x0000004000600010UL,
+                0x0000004000400010UL, 0x0000000000400000UL, 0x0080000000400000UL, 0x0080004000600000UL,
+                0x0000008000400010UL, 0x0080008000600000UL, 0x000000c000400000UL, 0x008000c000400000UL,
+                0x000000c000600000UL, 0x008000c000600010UL, 0x0000008000600010UL, 0x0080008000400010UL,
+                0x0000008000600000UL, 0x008000c000400010UL, 0x0080008000600010UL, 0x000000c000600010UL,
+                0x000000c000400010UL, 0x0000008000400000UL, 0x0080008000400000UL, 0x008000c000600000UL,
+                0x0000000000400030UL, 0x0080000000600020UL, 0x0000004000400020UL, 0x0080004000400020UL,
+                0x0000004000600020UL, 0x0080004000600030UL, 0x0000000000600030UL, 0x0080000000400030UL,
+                0x0000000000600020UL, 0x0080004000400030UL, 0x0080000000600030UL, 0x0000004000600030UL,
+                0x0000004000400030UL, 0x0000000000400020UL, 0x0080000000400020UL, 0x0080004000600020UL,
+                0x0010008000400030UL, 0x0090008000600020UL, 0x001000c000400020UL, 0x009000c000400020UL,
+                0x001000c000600020UL, 0x009000c000600030UL, 0x0010008000600030UL, 0x0090008000400030UL,
+                0x0010008000600020UL, 0x009000c000400030UL, 0x0090008000600030UL, 0x001000c000600030UL,
+                0x001000c000400030UL, 0x0010008000400020UL, 0x0090008000400020UL, 0x009000c000600020UL,
+                0x0010000000000030UL, 0x0090000000200020UL, 0x0010004000000020UL, 0x0090004000000020UL,
+                0x0010004000200020UL, 0x0090004000200030UL, 0x0010000000200030UL, 0x0090000000000030UL,
+                0x0010000000200020UL, 0x0090004000000030UL, 0x0090000000200030UL, 0x0010004000200030UL,
+                0x0010004000000030UL, 0x0010000000000020UL, 0x0090000000000020UL, 0x0090004000200020UL,
+                0x0010008000000010UL, 0x0090008000200000UL, 0x001000c000000000UL, 0x009000c000000000UL,
+                0x001000c000200000UL, 0x009000c000200010UL, 0x0010008000200010UL, 0x0090008000000010UL,
+                0x0010008000200000UL, 0x009000c000000010UL, 0x0090008000200010UL, 0x001000c000200010UL,
+                0x001000c000000010UL, 0x0010008000000000UL, 0x0090008000000000UL, 0x009000c000200000UL,
+                0x0000000000000030UL, 0x0080000000200020UL, 0x0000004000000020UL, 0x0080004000000020UL,
+                0x0000004000200020UL, 0x0080004000200030UL, 0x0000000000200030UL, 0x0080000000000030UL,
+                0x0000000000200020UL, 0x0080004000000030UL, 0x0080000000200030UL, 0x0000004000200030UL,
+                0x0000004000000030UL, 0x0000000000000020UL, 0x0080000000000020UL, 0x0080004000200020UL,
+                0x0010008000400010UL, 0x0090008000600000UL, 0x001000c000400000UL, 0x009000c000400000UL,
+                0x001000c000600000UL, 0x009000c000600010UL, 0x0010008000600010UL, 0x0090008000400010UL,
+                0x0010008000600000UL, 0x009000c000400010UL, 0x0090008000600010UL, 0x001000c000600010UL,
+                0x001000c000400010UL, 0x0010008000400000UL, 0x0090008000400000UL, 0x009000c000600000UL,
+                0x0010008000000030UL, 0x0090008000200020UL, 0x001000c000000020UL, 0x009000c000000020UL,
+                0x001000c000200020UL, 0x009000c000200030UL, 0x0010008000200030UL, 0x0090008000000030UL,
+                0x0010008000200020UL, 0x009000c000000030UL, 0x0090008000200030UL, 0x001000c000200030UL,
+                0x001000c000000030UL, 0x0010008000000020UL, 0x0090008000000020UL, 0x009000c000200020UL,
+                0x0010000000400030UL, 0x0090000000600020UL, 0x0010004000400020UL, 0x0090004000400020UL,
+                0x0010004000600020UL, 0x0090004000600030UL, 0x0010000000600030UL, 0x0090000000400030UL,
+                0x0010000000600020UL, 0x0090004000400030UL, 0x0090000000600030UL, 0x0010004000600030UL,
+                0x0010004000400030UL, 0x0010000000400020UL, 0x0090000000400020UL, 0x0090004000600020UL,
+                0x0010000000400010UL, 0x0090000000600000UL, 0x0010004000400000UL, 0x0090004000400000UL,
+                0x0010004000600000UL, 0x0090004000600010UL, 0x0010000000600010UL, 0x0090000000400010UL,
+                0x0010000000600000UL, 0x0090004000400010UL, 0x0090000000600010UL, 0x0010004000600010UL,
+                0x0010004000400010UL, 0x0010000000400000UL, 0x0090000000400000UL, 0x0090004000600000UL,
+                0x0000000000000010UL, 0x0080000000200000UL, 0x0000004000000000UL, 0x0080004000000000UL,
+                0x0000004000200000UL, 0x0080004000200010UL, 0x0000000000200010UL, 0x0080000000000010UL,
+                0x0000000000200000UL, 0x0080004000000010UL, 0x0080000000200010UL, 0x0000004000200010UL,
+                0x0000004000000010UL, 0x0000000000000000UL, 0x0080000000000000UL, 0x0080004000200000UL,
+                0x0000008000000010UL, 0x0080008000200000UL, 0x000000c000000000UL, 0x008000c000000000UL,
+                0x000000c000200000UL, 0x008000c000200010UL, 0x0000008000200010UL, 0x0080008000000010UL,
+                0x0000008000200000UL, 0x008000c000000010UL, 0x0080008000200010UL, 0x000000c000200010UL,
+                0x000000c000000010UL, 0x0000008000000000UL, 0x0080008000000000UL, 0x008000c000200000UL,
+                0x0000008000400030UL, 0x0080008000600020UL, 0x000000c000400020UL, 0x008000c000400020UL,
+                0x000000c000600020UL, 0x008000c000600030UL, 0x0000008000600030UL, 0x0080008000400030UL,
+                0x0000008000600020UL, 0x008000c000400030UL, 0x0080008000600030UL, 0x000000c000600030UL,
+                0x000000c000400030UL, 0x0000008000400020UL, 0x0080008000400020UL, 0x008000c000600020UL,
+        },
+        {
+                0x0000001000100000UL, 0x0020000000900000UL, 0x0000000000100040UL, 0x0000000000900040UL,
+                0x0020000000100040UL, 0x0020001000900040UL, 0x0020001000100000UL, 0x0000001000900000UL,
+                0x0020000000100000UL, 0x0000001000900040UL, 0x0020001000900000UL, 0x0020001000100040UL,
+                0x0000001000100040UL, 0x0000000000100000UL, 0x0000000000900000UL, 0x0020000000900040UL,
+                0x0000003000000080UL, 0x0020002000800080UL, 0x00000020000000c0UL, 0x00000020008000c0UL,
+                0x00200020000000c0UL, 0x00200030008000c0UL, 0x0020003000000080UL, 0x0000003000800080UL,
+                0x0020002000000080UL, 0x00000030008000c0UL, 0x0020003000800080UL, 0x00200030000000c0UL,
+                0x00000030000000c0UL, 0x0000002000000080UL, 0x0000002000800080UL, 0x00200020008000c0UL,
+                0x0040001000000000UL, 0x0060000000800000UL, 0x0040000000000040UL, 0x0040000000800040UL,
+                0x0060000000000040UL, 0x0060001000800040UL, 0x0060001000000000UL, 0x0040001000800000UL,
+                0x0060000000000000UL, 0x0040001000800040UL, 0x0060001000800000UL, 0x0060001000000040UL,
+                0x0040001000000040UL, 0x0040000000000000UL, 0x0040000000800000UL, 0x0060000000800040UL,
+                0x0040001000000080UL, 0x0060000000800080UL, 0x00400000000000c0UL, 0x00400000008000c0UL,
+                0x00600000000000c0UL, 0x00600010008000c0UL, 0x0060001000000080UL, 0x0040001000800080UL,
+                0x0060000000000080UL, 0x00400010008000c0UL, 0x0060001000800080UL, 0x00600010000000c0UL,
+                0x00400010000000c0UL, 0x0040000000000080UL, 0x0040000000800080UL, 0x00600000008000c0UL,
+                0x0040003000000000UL, 0x0060002000800000UL, 0x0040002000000040UL, 0x0040002000800040UL,
+                0x0060002000000040UL, 0x0060003000800040UL, 0x0060003000000000UL, 0x0040003000800000UL,
+                0x0060002000000000UL, 0x0040003000800040UL, 0x0060003000800000UL, 0x0060003000000040UL,
+                0x0040003000000040UL, 0x0040002000000000UL, 0x0040002000800000UL, 0x0060002000800040UL,
+                0x0040003000100080UL, 0x0060002000900080UL, 0x00400020001000c0UL, 0x00400020009000c0UL,
+                0x00600020001000c0UL, 0x00600030009000c0UL, 0x0060003000100080UL, 0x0040003000900080UL,
+                0x0060002000100080UL, 0x00400030009000c0UL, 0x0060003000900080UL, 0x00600030001000c0UL,
+                0x00400030001000c0UL, 0x0040002000100080UL, 0x0040002000900080UL, 0x00600020009000c0UL,
+                0x0000003000100000UL, 0x0020002000900000UL, 0x0000002000100040UL, 0x0000002000900040UL,
+                0x0020002000100040UL, 0x0020003000900040UL, 0x0020003000100000UL, 0x0000003000900000UL,
+                0x0020002000100000UL, 0x0000003000900040UL, 0x0020003000900000UL, 0x0020003000100040UL,
+                0x0000003000100040UL, 0x0000002000100000UL, 0x0000002000900000UL, 0x0020002000900040UL,
+                0x0000001000100080UL, 0x0020000000900080UL, 0x00000000001000c0UL, 0x00000000009000c0UL,
+                0x00200000001000c0UL, 0x00200010009000c0UL, 0x0020001000100080UL, 0x0000001000900080UL,
+                0x0020000000100080UL, 0x00000010009000c0UL, 0x0020001000900080UL, 0x00200010001000c0UL,
+                0x00000010001000c0UL, 0x0000000000100080UL, 0x0000000000900080UL, 0x00200000009000c0UL,
+                0x0000003000000000UL, 0x0020002000800000UL, 0x0000002000000040UL, 0x0000002000800040UL,
+                0x0020002000000040UL, 0x0020003000800040UL, 0x0020003000000000UL, 0x0000003000800000UL,
+                0x0020002000000000UL, 0x0000003000800040UL, 0x0020003000800000UL, 0x0020003000000040UL,
+                0x0000003000000040UL, 0x0000002000000000UL, 0x0000002000800000UL, 0x0020002000800040UL,
+                0x0040001000100080UL, 0x0060000000900080UL, 0x00400000001000c0UL, 0x00400000009000c0UL,
+                0x00600000001000c0UL, 0x00600010009000c0UL, 0x0060001000100080UL, 0x0040001000900080UL,
+                0x0060000000100080UL, 0x00400010009000c0UL, 0x0060001000900080UL, 0x00600010001000c0UL,
+                0x00400010001000c0UL, 0x0040000000100080UL, 0x0040000000900080UL, 0x00600000009000c0UL,
+                0x0000003000100080UL, 0x0020002000900080UL, 0x00000020001000c0UL, 0x00000020009000c0UL,
+                0x00200020001000c0UL, 0x00200030009000c0UL, 0x0020003000100080UL, 0x0000003000900080UL,
+                0x0020002000100080UL, 0x00000030009000c0UL, 0x0020003000900080UL, 0x00200030001000c0UL,
+                0x00000030001000c0UL, 0x0000002000100080UL, 0x0000002000900080UL, 0x00200020009000c0UL,
+                0x0040003000100000UL, 0x0060002000900000UL, 0x0040002000100040UL, 0x0040002000900040UL,
+                0x0060002000100040UL, 0x0060003000900040UL, 0x0060003000100000UL, 0x0040003000900000UL,
+                0x0060002000100000UL, 0x0040003000900040UL, 0x0060003000900000UL, 0x0060003000100040UL,
+                0x0040003000100040UL, 0x0040002000100000UL, 0x0040002000900000UL, 0x0060002000900040UL,
+                0x0040001000100000UL, 0x0060000000900000UL, 0x0040000000100040UL, 0x0040000000900040UL,
+                0x0060000000100040UL, 0x0060001000900040UL, 0x0060001000100000UL, 0x0040001000900000UL,
+                0x0060000000100000UL, 0x0040001000900040UL, 0x0060001000900000UL, 0x0060001000100040UL,
+                0x0040001000100040UL, 0x0040000000100000UL, 0x0040000000900000UL, 0x0060000000900040UL,
+                0x0000001000000000UL, 0x0020000000800000UL, 0x0000000000000040UL, 0x0000000000800040UL,
+                0x0020000000000040UL, 0x0020001000800040UL, 0x0020001000000000UL, 0x0000001000800000UL,
+                0x0020000000000000UL, 0x0000001000800040UL, 0x0020001000800000UL, 0x0020001000000040UL,
+                0x0000001000000040UL, 0x0000000000000000UL, 0x0000000000800000UL, 0x0020000000800040UL,
+                0x0000001000000080UL, 0x0020000000800080UL, 0x00000000000000c0UL, 0x00000000008000c0UL,
+                0x00200000000000c0UL, 0x00200010008000c0UL, 0x0020001000000080UL, 0x0000001000800080UL,
+                0x0020000000000080UL, 0x00000010008000c0UL, 0x0020001000800080UL, 0x00200010000000c0UL,
+                0x00000010000000c0UL, 0x0000000000000080UL, 0x0000000000800080UL, 0x00200000008000c0UL,
+                0x0040003000000080UL, 0x0060002000800080UL, 0x00400020000000c0UL, 0x00400020008000c0UL,
+                0x00600020000000c0UL, 0x00600030008000c0UL, 0x0060003000000080UL, 0x0040003000800080UL,
+                0x0060002000000080UL, 0x00400030008000c0UL, 0x0060003000800080UL, 0x00600030000000c0UL,
+                0x00400030000000c0UL, 0x0040002000000080UL, 0x0040002000800080UL, 0x00600020008000c0UL,
+        },
+        {
+                0x0100000000000100UL, 0x0900000002000000UL, 0x0100040000000000UL, 0x0900040000000000UL,
+                0x0100040002000000UL, 0x0900040002000100UL, 0x0100000002000100UL, 0x0900000000000100UL,
+                0x0100000002000000UL, 0x0900040000000100UL, 0x0900000002000100UL, 0x0100040002000100UL,
+                0x0100040000000100UL, 0x0100000000000000UL, 0x0900000000000000UL, 0x0900040002000000UL,
+                0x0000080000000300UL, 0x0800080002000200UL, 0x00000c0000000200UL, 0x08000c0000000200UL,
+                0x00000c0002000200UL, 0x08000c0002000300UL, 0x0000080002000300UL, 0x0800080000000300UL,
+                0x0000080002000200UL, 0x08000c0000000300UL, 0x0800080002000300UL, 0x00000c0002000300UL,
+                0x00000c0000000300UL, 0x0000080000000200UL, 0x0800080000000200UL, 0x08000c0002000200UL,
+                0x0000000004000100UL, 0x0800000006000000UL, 0x0000040004000000UL, 0x0800040004000000UL,
+                0x0000040006000000UL, 0x0800040006000100UL, 0x0000000006000100UL, 0x0800000004000100UL,
+                0x0000000006000000UL, 0x0800040004000100UL, 0x0800000006000100UL, 0x0000040006000100UL,
+                0x0000040004000100UL, 0x0000000004000000UL, 0x0800000004000000UL, 0x0800040006000000UL,
+                0x0000080004000100UL, 0x0800080006000000UL, 0x00000c0004000000UL, 0x08000c0004000000UL,
+                0x00000c0006000000UL, 0x08000c0006000100UL, 0x0000080006000100UL, 0x0800080004000100UL,
+                0x0000080006000000UL, 0x08000c0004000100UL, 0x0800080006000100UL, 0x00000c0006000100UL,
+                0x00000c0004000100UL, 0x0000080004000000UL, 0x0800080004000000UL, 0x08000c0006000000UL,
+                0x0000000004000300UL, 0x0800000006000200UL, 0x0000040004000200UL, 0x0800040004000200UL,
+                0x0000040006000200UL, 0x0800040006000300UL, 0x0000000006000300UL, 0x0800000004000300UL,
+                0x0000000006000200UL, 0x0800040004000300UL, 0x0800000006000300UL, 0x0000040006000300UL,
+                0x0000040004000300UL, 0x0000000004000200UL, 0x0800000004000200UL, 0x0800040006000200UL,
+                0x0100080004000300UL, 0x0900080006000200UL, 0x01000c0004000200UL, 0x09000c0004000200UL,
+                0x01000c0006000200UL, 0x09000c0006000300UL, 0x0100080006000300UL, 0x0900080004000300UL,
+                0x0100080006000200UL, 0x09000c0004000300UL, 0x0900080006000300UL, 0x01000c0006000300UL,
+                0x01000c0004000300UL, 0x0100080004000200UL, 0x0900080004000200UL, 0x09000c0006000200UL,
+                0x0100000000000300UL, 0x0900000002000200UL, 0x0100040000000200UL, 0x0900040000000200UL,
+                0x0100040002000200UL, 0x0900040002000300UL, 0x0100000002000300UL, 0x0900000000000300UL,
+                0x0100000002000200UL, 0x0900040000000300UL, 0x0900000002000300UL, 0x0100040002000300UL,
+                0x0100040000000300UL, 0x0100000000000200UL, 0x0900000000000200UL, 0x0900040002000200UL,
+                0x0100080000000100UL, 0x0900080002000000UL, 0x01000c0000000000UL, 0x09000c0000000000UL,
+                0x01000c0002000000UL, 0x09000c0002000100UL, 0x0100080002000100UL, 0x0900080000000100UL,
+                0x0100080002000000UL, 0x09000c0000000100UL, 0x0900080002000100UL, 0x01000c0002000100UL,
+                0x01000c0000000100UL, 0x0100080000000000UL, 0x0900080000000000UL, 0x09000c0002000000UL,
+                0x0000000000000300UL, 0x0800000002000200UL, 0x0000040000000200UL, 0x0800040000000200UL,
+                0x0000040002000200UL, 0x0800040002000300UL, 0x0000000002000300UL, 0x0800000000000300UL,
+                0x0000000002000200UL, 0x0800040000000300UL, 0x0800000002000300UL, 0x0000040002000300UL,
+                0x0000040000000300UL, 0x0000000000000200UL, 0x0800000000000200UL, 0x0800040002000200UL,
+                0x0100080004000100UL, 0x0900080006000000UL, 0x01000c0004000000UL, 0x09000c0004000000UL,
+                0x01000c0006000000UL, 0x09000c0006000100UL, 0x0100080006000100UL, 0x0900080004000100UL,
+                0x0100080006000000UL, 0x09000c0004000100UL, 0x0900080006000100UL, 0x01000c0006000100UL,
+                0x01000c0004000100UL, 0x0100080004000000UL, 0x0900080004000000UL, 0x09000c0006000000UL,
+                0x0100080000000300UL, 0x0900080002000200UL, 0x01000c0000000200UL, 0x09000c0000000200UL,
+                0x01000c0002000200UL, 0x09000c0002000300UL, 0x0100080002000300UL, 0x0900080000000300UL,
+                0x0100080002000200UL, 0x09000c0000000300UL, 0x0900080002000300UL, 0x01000c0002000300UL,
+                0x01000c0000000300UL, 0x0100080000000200UL, 0x0900080000000200UL, 0x09000c0002000200UL,
+                0x0100000004000300UL, 0x0900000006000200UL, 0x0100040004000200UL, 0x0900040004000200UL,
+                0x0100040006000200UL, 0x0900040006000300UL, 0x0100000006000300UL, 0x0900000004000300UL,
+                0x0100000006000200UL, 0x0900040004000300UL, 0x0900000006000300UL, 0x0100040006000300UL,
+                0x0100040004000300UL, 0x0100000004000200UL, 0x0900000004000200UL, 0x0900040006000200UL,
+                0x0100000004000100UL, 0x0900000006000000UL, 0x0100040004000000UL, 0x0900040004000000UL,
+                0x0100040006000000UL, 0x0900040006000100UL, 0x0100000006000100UL, 0x0900000004000100UL,
+                0x0100000006000000UL, 0x0900040004000100UL, 0x0900000006000100UL, 0x0100040006000100UL,
+                0x0100040004000100UL, 0x0100000004000000UL, 0x0900000004000000UL, 0x0900040006000000UL,
+                0x0000000000000100UL, 0x0800000002000000UL, 0x0000040000000000UL, 0x0800040000000000UL,
+                0x0000040002000000UL, 0x0800040002000100UL, 0x0000000002000100UL, 0x0800000000000100UL,
+                0x0000000002000000UL, 0x0800040000000100UL, 0x0800000002000100UL, 0x0000040002000100UL,
+                0x0000040000000100UL, 0x0000000000000000UL, 0x0800000000000000UL, 0x0800040002000000UL,
+                0x0000080000000100UL, 0x0800080002000000UL, 0x00000c0000000000UL, 0x08000c0000000000UL,
+                0x00000c0002000000UL, 0x08000c0002000100UL, 0x0000080002000100UL, 0x0800080000000100UL,
+                0x0000080002000000UL, 0x08000c0000000100UL, 0x0800080002000100UL, 0x00000c0002000100UL,
+                0x00000c0000000100UL, 0x0000080000000000UL, 0x0800080000000000UL, 0x08000c0002000000UL,
+                0x0000080004000300UL, 0x0800080006000200UL, 0x00000c0004000200UL, 0x08000c0004000200UL,
+                0x00000c0006000200UL, 0x08000c0006000300UL, 0x0000080006000300UL, 0x0800080004000300UL,
+                0x0000080006000200UL, 0x08000c0004000300UL, 0x0800080006000300UL, 0x00000c0006000300UL,
+                0x00000c0004000300UL, 0x0000080004000200UL, 0x0800080004000200UL, 0x08000c0006000200UL,
+        },
+        {
+                0x0000010001000000UL, 0x0200000009000000UL, 0x0000000001000400UL, 0x0000000009000400UL,
+                0x0200000001000400UL, 0x0200010009000400UL, 0x0200010001000000UL, 0x0000010009000000UL,
+                0x0200000001000000UL, 0x0000010009000400UL, 0x0200010009000000UL, 0x0200010001000400UL,
+                0x0000010001000400UL, 0x0000000001000000UL, 0x0000000009000000UL, 0x0200000009000400UL,
+                0x0000030000000800UL, 0x0200020008000800UL, 0x0000020000000c00UL, 0x0000020008000c00UL,
+                0x0200020000000c00UL, 0x0200030008000c00UL, 0x0200030000000800UL, 0x0000030008000800UL,
+                0x0200020000000800UL, 0x0000030008000c00UL, 0x0200030008000800UL, 0x0200030000000c00UL,
+                0x0000030000000c00UL, 0x0000020000000800UL, 0x0000020008000800UL, 0x0200020008000c00UL,
+                0x0400010000000000UL, 0x0600000008000000UL, 0x0400000000000400UL, 0x0400000008000400UL,
+                0x0600000000000400UL, 0x0600010008000400UL, 0x0600010000000000UL, 0x0400010008000000UL,
+                0x0600000000000000UL, 0x0400010008000400UL, 0x0600010008000000UL, 0x0600010000000400UL,
+                0x0400010000000400UL, 0x0400000000000000UL, 0x0400000008000000UL, 0x0600000008000400UL,
+                0x0400010000000800UL, 0x0600000008000800UL, 0x0400000000000c00UL, 0x0400000008000c00UL,
+                0x0600000000000c00UL, 0x0600010008000c00UL, 0x0600010000000800UL, 0x0400010008000800UL,
+                0x0600000000000800UL, 0x0400010008000c00UL, 0x0600010008000800UL, 0x0600010000000c00UL,
+                0x0400010000000c00UL, 0x0400000000000800UL, 0x0400000008000800UL, 0x0600000008000c00UL,
+                0x0400030000000000UL, 0x0600020008000000UL, 0x0400020000000400UL, 0x0400020008000400UL,
+                0x0600020000000400UL, 0x0600030008000400UL, 0x0600030000000000UL, 0x0400030008000000UL,
+                0x0600020000000000UL, 0x0400030008000400UL, 0x0600030008000000UL, 0x0600030000000400UL,
+                0x0400030000000400UL, 0x0400020000000000UL, 0x0400020008000000UL, 0x0600020008000400UL,
+                0x0400030001000800UL, 0x0600020009000800UL, 0x0400020001000c00UL, 0x0400020009000c00UL,
+                0x0600020001000c00UL, 0x0600030009000c00UL, 0x0600030001000800UL, 0x0400030009000800UL,
+                0x0600020001000800UL, 0x0400030009000c00UL, 0x0600030009000800UL, 0x0600030001000c00UL,
+                0x0400030001000c00UL, 0x0400020001000800UL, 0x0400020009000800UL, 0x0600020009000c00UL,
+                0x0000030001000000UL, 0x0200020009000000UL, 0x0000020001000400UL, 0x0000020009000400UL,
+                0x0200020001000400UL, 0x0200030009000400UL, 0x0200030001000000UL, 0x0000030009000000UL,
+                0x0200020001000000UL, 0x0000030009000400UL, 0x0200030009000000UL, 0x0200030001000400UL,
+                0x0000030001000400UL, 0x0000020001000000UL, 0x0000020009000000UL, 0x0200020009000400UL,
+                0x0000010001000800UL, 0x0200000009000800UL, 0x0000000001000c00UL, 0x0000000009000c00UL,
+                0x0200000001000c00UL, 0x0200010009000c00UL, 0x0200010001000800UL, 0x0000010009000800UL,
+                0x0200000001000800UL, 0x0000010009000c00UL, 0x0200010009000800UL, 0x0200010001000c00UL,
+                0x0000010001000c00UL, 0x0000000001000800UL, 0x0000000009000800UL, 0x0200000009000c00UL,
+                0x0000030000000000UL, 0x0200020008000000UL, 0x0000020000000400UL, 0x0000020008000400UL,
+                0x0200020000000400UL, 0x0200030008000400UL, 0x0200030000000000UL, 0x0000030008000000UL,
+                0x0200020000000000UL, 0x0000030008000400UL, 0x0200030008000000UL, 0x0200030000000400UL,
+                0x0000030000000400UL, 0x0000020000000000UL, 0x0000020008000000UL, 0x0200020008000400UL,
+                0x0400010001000800UL, 0x0600000009000800UL, 0x0400000001000c00UL, 0x0400000009000c00UL,
+                0x0600000001000c00UL, 0x0600010009000c00UL, 0x0600010001000800UL, 0x0400010009000800UL,
+                0x0600000001000800UL, 0x0400010009000c00UL, 0x0600010009000800UL, 0x0600010001000c00UL,
+                0x0400010001000c00UL, 0x0400000001000800UL, 0x0400000009000800UL, 0x0600000009000c00UL,
+                0x0000030001000800UL, 0x0200020009000800UL, 0x0000020001000c00UL, 0x0000020009000c00UL,
+                0x0200020001000c00UL, 0x0200030009000c00UL, 0x0200030001000800UL, 0x0000030009000800UL,
+                0x0200020001000800UL, 0x0000030009000c00UL, 0x0200030009000800UL, 0x0200030001000c00UL,
+                0x0000030001000c00UL, 0x0000020001000800UL, 0x0000020009000800UL, 0x0200020009000c00UL,
+                0x0400030001000000UL, 0x0600020009000000UL, 0x0400020001000400UL, 0x0400020009000400UL,
+                0x0600020001000400UL, 0x0600030009000400UL, 0x0600030001000000UL, 0x0400030009000000UL,
+                0x0600020001000000UL, 0x0400030009000400UL, 0x0600030009000000UL, 0x0600030001000400UL,
+                0x0400030001000400UL, 0x0400020001000000UL, 0x0400020009000000UL, 0x0600020009000400UL,
+                0x0400010001000000UL, 0x0600000009000000UL, 0x0400000001000400UL, 0x0400000009000400UL,
+                0x0600000001000400UL, 0x0600010009000400UL, 0x0600010001000000UL, 0x0400010009000000UL,
+                0x0600000001000000UL, 0x0400010009000400UL, 0x0600010009000000UL, 0x0600010001000400UL,
+                0x0400010001000400UL, 0x0400000001000000UL, 0x0400000009000000UL, 0x0600000009000400UL,
+                0x0000010000000000UL, 0x0200000008000000UL, 0x0000000000000400UL, 0x0000000008000400UL,
+                0x0200000000000400UL, 0x0200010008000400UL, 0x0200010000000000UL, 0x0000010008000000UL,
+                0x0200000000000000UL, 0x0000010008000400UL, 0x0200010008000000UL, 0x0200010000000400UL,
+                0x0000010000000400UL, 0x0000000000000000UL, 0x0000000008000000UL, 0x0200000008000400UL,
+                0x0000010000000800UL, 0x0200000008000800UL, 0x0000000000000c00UL, 0x0000000008000c00UL,
+                0x0200000000000c00UL, 0x0200010008000c00UL, 0x0200010000000800UL, 0x0000010008000800UL,
+                0x0200000000000800UL, 0x0000010008000c00UL, 0x0200010008000800UL, 0x0200010000000c00UL,
+                0x0000010000000c00UL, 0x0000000000000800UL, 0x0000000008000800UL, 0x0200000008000c00UL,
+                0x0400030000000800UL, 0x0600020008000800UL, 0x0400020000000c00UL, 0x0400020008000c00UL,
+                0x0600020000000c00UL, 0x0600030008000c00UL, 0x0600030000000800UL, 0x0400030008000800UL,
+                0x0600020000000800UL, 0x0400030008000c00UL, 0x0600030008000800UL, 0x0600030000000c00UL,
+                0x0400030000000c00UL, 0x0400020000000800UL, 0x0400020008000800UL, 0x0600020008000c00UL,
+        },
+        {
+                0x1000000000001000UL, 0x9000000020000000UL, 0x1000400000000000UL, 0x9000400000000000UL,
+                0x1000400020000000UL, 0x9000400020001000UL, 0x1000000020001000UL, 0x9000000000001000UL,
+                0x1000000020000000UL, 0x9000400000001000UL, 0x9000000020001000UL, 0x1000400020001000UL,
+                0x1000400000001000UL, 0x1000000000000000UL, 0x9000000000000000UL, 0x9000400020000000UL,
+                0x0000800000003000UL, 0x8000800020002000UL, 0x0000c00000002000UL, 0x8000c00000002000UL,
+                0x0000c00020002000UL, 0x8000c00020003000UL, 0x0000800020003000UL, 0x8000800000003000UL,
+                0x0000800020002000UL, 0x8000c00000003000UL, 0x8000800020003000UL, 0x0000c00020003000UL,
+                0x0000c00000003000UL, 0x0000800000002000UL, 0x8000800000002000UL, 0x8000c00020002000UL,
+                0x0000000040001000UL, 0x8000000060000000UL, 0x0000400040000000UL, 0x8000400040000000UL,
+                0x0000400060000000UL, 0x8000400060001000UL, 0x0000000060001000UL, 0x8000000040001000UL,
+                0x0000000060000000UL, 0x8000400040001000UL, 0x8000000060001000UL, 0x0000400060001000UL,
+                0x0000400040001000UL, 0x0000000040000000UL, 0x8000000040000000UL, 0x8000400060000000UL,
+                0x0000800040001000UL, 0x8000800060000000UL, 0x0000c00040000000UL, 0x8000c00040000000UL,
+                0x0000c00060000000UL, 0x8000c00060001000UL, 0x0000800060001000UL, 0x8000800040001000UL,
+                0x0000800060000000UL, 0x8000c00040001000UL, 0x8000800060001000UL, 0x0000c00060001000UL,
+                0x0000c00040001000UL, 0x0000800040000000UL, 0x8000800040000000UL, 0x8000c00060000000UL,
+                0x0000000040003000UL, 0x8000000060002000UL, 0x0000400040002000UL, 0x8000400040002000UL,
+                0x0000400060002000UL, 0x8000400060003000UL, 0x0000000060003000UL, 0x8000000040003000UL,
+                0x0000000060002000UL, 0x8000400040003000UL, 0x8000000060003000UL, 0x0000400060003000UL,
+                0x0000400040003000UL, 0x0000000040002000UL, 0x8000000040002000UL, 0x8000400060002000UL,
+                0x1000800040003000UL, 0x9000800060002000UL, 0x1000c00040002000UL, 0x9000c00040002000UL,
+                0x1000c00060002000UL, 0x9000c00060003000UL, 0x1000800060003000UL, 0x9000800040003000UL,
+                0x1000800060002000UL, 0x9000c00040003000UL, 0x9000800060003000UL, 0x1000c00060003000UL,
+                0x1000c00040003000UL, 0x1000800040002000UL, 0x9000800040002000UL, 0x9000c00060002000UL,
+                0x1000000000003000UL, 0x9000000020002000UL, 0x1000400000002000UL, 0x9000400000002000UL,
+                0x1000400020002000UL, 0x9000400020003000UL, 0x1000000020003000UL, 0x9000000000003000UL,
+                0x1000000020002000UL, 0x9000400000003000UL, 0x9000000020003000UL, 0x1000400020003000UL,
+                0x1000400000003000UL, 0x1000000000002000UL, 0x9000000000002000UL, 0x9000400020002000UL,
+                0x1000800000001000UL, 0x9000800020000000UL, 0x1000c00000000000UL, 0x9000c00000000000UL,
+                0x1000c00020000000UL, 0x9000c00020001000UL, 0x1000800020001000UL, 0x9000800000001000UL,
+                0x1000800020000000UL, 0x9000c00000001000UL, 0x9000800020001000UL, 0x1000c00020001000UL,
+                0x1000c00000001000UL, 0x1000800000000000UL, 0x9000800000000000UL, 0x9000c00020000000UL,
+                0x0000000000003000UL, 0x8000000020002000UL, 0x0000400000002000UL, 0x8000400000002000UL,
+                0x0000400020002000UL, 0x8000400020003000UL, 0x0000000020003000UL, 0x8000000000003000UL,
+                0x0000000020002000UL, 0x8000400000003000UL, 0x8000000020003000UL, 0x0000400020003000UL,
+                0x0000400000003000UL, 0x0000000000002000UL, 0x8000000000002000UL, 0x8000400020002000UL,
+                0x1000800040001000UL, 0x9000800060000000UL, 0x1000c00040000000UL, 0x9000c00040000000UL,
+                0x1000c00060000000UL, 0x9000c00060001000UL, 0x1000800060001000UL, 0x9000800040001000UL,
+                0x1000800060000000UL, 0x9000c00040001000UL, 0x9000800060001000UL, 0x1000c00060001000UL,
+                0x1000c00040001000UL, 0x1000800040000000UL, 0x9000800040000000UL, 0x9000c00060000000UL,
+                0x1000800000003000UL, 0x9000800020002000UL, 0x1000c00000002000UL, 0x9000c00000002000UL,
+                0x1000c00020002000UL, 0x9000c00020003000UL, 0x1000800020003000UL, 0x9000800000003000UL,
+                0x1000800020002000UL, 0x9000c00000003000UL, 0x9000800020003000UL, 0x1000c00020003000UL,
+                0x1000c00000003000UL, 0x1000800000002000UL, 0x9000800000002000UL, 0x9000c00020002000UL,
+                0x1000000040003000UL, 0x9000000060002000UL, 0x1000400040002000UL, 0x9000400040002000UL,
+                0x1000400060002000UL, 0x9000400060003000UL, 0x1000000060003000UL, 0x9000000040003000UL,
+                0x1000000060002000UL, 0x9000400040003000UL, 0x9000000060003000UL, 0x1000400060003000UL,
+                0x1000400040003000UL, 0x1000000040002000UL, 0x9000000040002000UL, 0x9000400060002000UL,
+                0x1000000040001000UL, 0x9000000060000000UL, 0x1000400040000000UL, 0x9000400040000000UL,
+                0x1000400060000000UL, 0x9000400060001000UL, 0x1000000060001000UL, 0x9000000040001000UL,
+                0x1000000060000000UL, 0x9000400040001000UL, 0x9000000060001000UL, 0x1000400060001000UL,
+                0x1000400040001000UL, 0x1000000040000000UL, 0x9000000040000000UL, 0x9000400060000000UL,
+                0x0000000000001000UL, 0x8000000020000000UL, 0x0000400000000000UL, 0x8000400000000000UL,
+                0x0000400020000000UL, 0x8000400020001000UL, 0x0000000020001000UL, 0x8000000000001000UL,
+                0x0000000020000000UL, 0x8000400000001000UL, 0x8000000020001000UL, 0x0000400020001000UL,
+                0x0000400000001000UL, 0x0000000000000000UL, 0x8000000000000000UL, 0x8000400020000000UL,
+                0x0000800000001000UL, 0x8000800020000000UL, 0x0000c00000000000UL, 0x8000c00000000000UL,
+                0x0000c00020000000UL, 0x8000c00020001000UL, 0x0000800020001000UL, 0x8000800000001000UL,
+                0x0000800020000000UL, 0x8000c00000001000UL, 0x8000800020001000UL, 0x0000c00020001000UL,
+                0x0000c00000001000UL, 0x0000800000000000UL, 0x8000800000000000UL, 0x8000c00020000000UL,
+                0x0000800040003000UL, 0x8000800060002000UL, 0x0000c00040002000UL, 0x8000c00040002000UL,
+                0x0000c00060002000UL, 0x8000c00060003000UL, 0x0000800060003000UL, 0x8000800040003000UL,
+                0x0000800060002000UL, 0x8000c00040003000UL, 0x8000800060003000UL, 0x0000c00060003000UL,
+                0x0000c00040003000UL, 0x0000800040002000UL, 0x8000800040002000UL, 0x8000c00060002000UL,
+        },
+        {
+                0x0000100010000000UL, 0x2000000090000000UL, 0x0000000010004000UL, 0x0000000090004000UL,
+                0x2000000010004000UL, 0x2000100090004000UL, 0x2000100010000000UL, 0x0000100090000000UL,
+                0x2000000010000000UL, 0x0000100090004000UL, 0x2000100090000000UL, 0x2000100010004000UL,
+                0x0000100010004000UL, 0x0000000010000000UL, 0x0000000090000000UL, 0x2000000090004000UL,
+                0x0000300000008000UL, 0x2000200080008000UL, 0x000020000000c000UL, 0x000020008000c000UL,
+                0x200020000000c000UL, 0x200030008000c000UL, 0x2000300000008000UL, 0x0000300080008000UL,
+                0x2000200000008000UL, 0x000030008000c000UL, 0x2000300080008000UL, 0x200030000000c000UL,
+                0x000030000000c000UL, 0x0000200000008000UL, 0x0000200080008000UL, 0x200020008000c000UL,
+                0x4000100000000000UL, 0x6000000080000000UL, 0x4000000000004000UL, 0x4000000080004000UL,
+                0x6000000000004000UL, 0x6000100080004000UL, 0x6000100000000000UL, 0x4000100080000000UL,
+                0x6000000000000000UL, 0x4000100080004000UL, 0x6000100080000000UL, 0x6000100000004000UL,
+                0x4000100000004000UL, 0x4000000000000000UL, 0x4000000080000000UL, 0x6000000080004000UL,
+                0x4000100000008000UL, 0x6000000080008000UL, 0x400000000000c000UL, 0x400000008000c000UL,
+                0x600000000000c000UL, 0x600010008000c000UL, 0x6000100000008000UL, 0x4000100080008000UL,
+                0x6000000000008000UL, 0x400010008000c000UL, 0x6000100080008000UL, 0x600010000000c000UL,
+                0x400010000000c000UL, 0x4000000000008000UL, 0x4000000080008000UL, 0x600000008000c000UL,
+                0x4000300000000000UL, 0x6000200080000000UL, 0x4000200000004000UL, 0x4000200080004000UL,
+                0x6000200000004000UL, 0x6000300080004000UL, 0x6000300000000000UL, 0x4000300080000000UL,
+                0x6000200000000000UL, 0x4000300080004000UL, 0x6000300080000000UL, 0x6000300000004000UL,
+                0x4000300000004000UL, 0x4000200000000000UL, 0x4000200080000000UL, 0x6000200080004000UL,
+                0x4000300010008000UL, 0x6000200090008000UL, 0x400020001000c000UL, 0x400020009000c000UL,
+                0x600020001000c000UL, 0x600030009000c000UL, 0x6000300010008000UL, 0x4000300090008000UL,
+                0x6000200010008000UL, 0x400030009000c000UL, 0x6000300090008000UL, 0x600030001000c000UL,
+                0x400030001000c000UL, 0x4000200010008000UL, 0x4000200090008000UL, 0x600020009000c000UL,
+                0x0000300010000000UL, 0x2000200090000000UL, 0x0000200010004000UL, 0x0000200090004000UL,
+                0x2000200010004000UL, 0x2000300090004000UL, 0x2000300010000000UL, 0x0000300090000000UL,
+                0x2000200010000000UL, 0x0000300090004000UL, 0x2000300090000000UL, 0x2000300010004000UL,
+                0x0000300010004000UL, 0x0000200010000000UL, 0x0000200090000000UL, 0x2000200090004000UL,
+                0x0000100010008000UL, 0x2000000090008000UL, 0x000000001000c000UL, 0x000000009000c000UL,
+                0x200000001000c000UL, 0x200010009000c000UL, 0x2000100010008000UL, 0x0000100090008000UL,
+                0x2000000010008000UL, 0x000010009000c000UL, 0x2000100090008000UL, 0x200010001000c000UL,
+                0x000010001000c000UL, 0x0000000010008000UL, 0x0000000090008000UL, 0x200000009000c000UL,
+                0x0000300000000000UL, 0x2000200080000000UL, 0x0000200000004000UL, 0x0000200080004000UL,
+                0x2000200000004000UL, 0x2000300080004000UL, 0x2000300000000000UL, 0x0000300080000000UL,
+                0x2000200000000000UL, 0x0000300080004000UL, 0x2000300080000000UL, 0x2000300000004000UL,
+                0x0000300000004000UL, 0x0000200000000000UL, 0x0000200080000000UL, 0x2000200080004000UL,
+                0x4000100010008000UL, 0x6000000090008000UL, 0x400000001000c000UL, 0x400000009000c000UL,
+                0x600000001000c000UL, 0x600010009000c000UL, 0x6000100010008000UL, 0x4000100090008000UL,
+                0x6000000010008000UL, 0x400010009000c000UL, 0x6000100090008000UL, 0x600010001000c000UL,
+                0x400010001000c000UL, 0x4000000010008000UL, 0x4000000090008000UL, 0x600000009000c000UL,
+                0x0000300010008000UL, 0x2000200090008000UL, 0x000020001000c000UL, 0x000020009000c000UL,
+                0x200020001000c000UL, 0x200030009000c000UL, 0x2000300010008000UL, 0x0000300090008000UL,
+                0x2000200010008000UL, 0x000030009000c000UL, 0x2000300090008000UL, 0x200030001000c000UL,
+                0x000030001000c000UL, 0x0000200010008000UL, 0x0000200090008000UL, 0x200020009000c000UL,
+                0x4000300010000000UL, 0x6000200090000000UL, 0x4000200010004000UL, 0x4000200090004000UL,
+                0x6000200010004000UL, 0x6000300090004000UL, 0x6000300010000000UL, 0x4000300090000000UL,
+                0x6000200010000000UL, 0x4000300090004000UL, 0x6000300090000000UL, 0x6000300010004000UL,
+                0x4000300010004000UL, 0x4000200010000000UL, 0x4000200090000000UL, 0x6000200090004000UL,
+                0x4000100010000000UL, 0x6000000090000000UL, 0x4000000010004000UL, 0x4000000090004000UL,
+                0x6000000010004000UL, 0x6000100090004000UL, 0x6000100010000000UL, 0x4000100090000000UL,
+                0x6000000010000000UL, 0x4000100090004000UL, 0x6000100090000000UL, 0x6000100010004000UL,
+                0x4000100010004000UL, 0x4000000010000000UL, 0x4000000090000000UL, 0x6000000090004000UL,
+                0x0000100000000000UL, 0x2000000080000000UL, 0x0000000000004000UL, 0x0000000080004000UL,
+                0x2000000000004000UL, 0x2000100080004000UL, 0x2000100000000000UL, 0x0000100080000000UL,
+                0x2000000000000000UL, 0x0000100080004000UL, 0x2000100080000000UL, 0x2000100000004000UL,
+                0x0000100000004000UL, 0x0000000000000000UL, 0x0000000080000000UL, 0x2000000080004000UL,
+                0x0000100000008000UL, 0x2000000080008000UL, 0x000000000000c000UL, 0x000000008000c000UL,
+                0x200000000000c000UL, 0x200010008000c000UL, 0x2000100000008000UL, 0x0000100080008000UL,
+                0x2000000000008000UL, 0x000010008000c000UL, 0x2000100080008000UL, 0x200010000000c000UL,
+                0x000010000000c000UL, 0x0000000000008000UL, 0x0000000080008000UL, 0x200000008000c000UL,
+                0x4000300000008000UL, 0x6000200080008000UL, 0x400020000000c000UL, 0x400020008000c000UL,
+                0x600020000000c000UL, 0x600030008000c000UL, 0x6000300000008000UL, 0x4000300080008000UL,
+                0x6000200000008000UL, 0x400030008000c000UL, 0x6000300080008000UL, 0x600030000000c000UL,
+                0x400030000000c000UL, 0x4000200000008000UL, 0x4000200080008000UL, 0x600020008000c000UL,
+        },
+};
+
+static const uint64_t tables_bytes_inv[8][256] = {
+        {
+                0x0000000084018401UL, 0x0000000084010000UL, 0x0000000084018000UL, 0x0000000084010420UL,
+                0x0000000084010020UL, 0x0000000084018400UL, 0x0000000084010400UL, 0x0000000084018021UL,
+                0x0000000084018420UL, 0x0000000084010421UL, 0x0000000084010001UL, 0x0000000084018020UL,
+                0x0000000084010021UL, 0x0000000084018001UL, 0x0000000084018421UL, 0x0000000084010401UL,
+                0x0000000000008401UL, 0x0000000000000000UL, 0x0000000000008000UL, 0x0000000000000420UL,
+                0x0000000000000020UL, 0x0000000000008400UL, 0x0000000000000400UL, 0x0000000000008021UL,
+                0x0000000000008420UL, 0x0000000000000421UL, 0x0000000000000001UL, 0x0000000000008020UL,
+                0x0000000000000021UL, 0x0000000000008001UL, 0x0000000000008421UL, 0x0000000000000401UL,
+                0x0000000080008401UL, 0x0000000080000000UL, 0x0000000080008000UL, 0x0000000080000420UL,
+                0x0000000080000020UL, 0x0000000080008400UL, 0x0000000080000400UL, 0x0000000080008021UL,
+                0x0000000080008420UL, 0x0000000080000421UL, 0x0000000080000001UL, 0x0000000080008020UL,
+                0x0000000080000021UL, 0x0000000080008001UL, 0x0000000080008421UL, 0x0000000080000401UL,
+                0x0000000004208401UL, 0x0000000004200000UL, 0x0000000004208000UL, 0x0000000004200420UL,
+                0x0000000004200020UL, 0x0000000004208400UL, 0x0000000004200400UL, 0x0000000004208021UL,
+                0x0000000004208420UL, 0x0000000004200421UL, 0x0000000004200001UL, 0x0000000004208020UL,
+                0x0000000004200021UL, 0x0000000004208001UL, 0x0000000004208421UL, 0x0000000004200401UL,
+                0x0000000000208401UL, 0x0000000000200000UL, 0x0000000000208000UL, 0x0000000000200420UL,
+                0x0000000000200020UL, 0x0000000000208400UL, 0x0000000000200400UL, 0x0000000000208021UL,
+                0x0000000000208420UL, 0x0000000000200421UL, 0x0000000000200001UL, 0x0000000000208020UL,
+                0x0000000000200021UL, 0x0000000000208001UL, 0x0000000000208421UL, 0x0000000000200401UL,
+                0x0000000084008401UL, 0x0000000084000000UL, 0x0000000084008000UL, 0x0000000084000420UL,
+                0x0000000084000020UL, 0x0000000084008400UL, 0x0000000084000400UL, 0x0000000084008021UL,
+                0x0000000084008420UL, 0x0000000084000421UL, 0x0000000084000001UL, 0x0000000084008020UL,
+                0x0000000084000021UL, 0x0000000084008001UL, 0x0000000084008421UL, 0x0000000084000401UL,
+                0x0000000004008401UL, 0x0000000004000000UL, 0x0000000004008000UL, 0x0000000004000420UL,
+                0x0000000004000020UL, 0x0000000004008400UL, 0x0000000004000400UL, 0x0000000004008021UL,
+                0x0000000004008420UL, 0x0000000004000421UL, 0x0000000004000001UL, 0x0000000004008020UL,
+                0x0000000004000021UL, 0x0000000004008001UL, 0x0000000004008421UL, 0x0000000004000401UL,
+                0x0000000080218401UL, 0x0000000080210000UL, 0x0000000080218000UL, 0x0000000080210420UL,
+                0x0000000080210020UL, 0x0000000080218400UL, 0x0000000080210400UL, 0x0000000080218021UL,
+                0x0000000080218420UL, 0x0000000080210421UL, 0x0000000080210001UL, 0x0000000080218020UL,
+                0x0000000080210021UL, 0x0000000080218001UL, 0x0000000080218421UL, 0x0000000080210401UL,
+                0x0000000084208401UL, 0x0000000084200000UL, 0x0000000084208000UL, 0x0000000084200420UL,
+                0x0000000084200020UL, 0x0000000084208400UL, 0x0000000084200400UL, 0x0000000084208021UL,
+                0x0000000084208420UL, 0x0000000084200421UL, 0x0000000084200001UL, 0x0000000084208020UL,
+                0x0000000084200021UL, 0x0000000084208001UL, 0x0000000084208421UL, 0x0000000084200401UL,
+                0x0000000004218401UL, 0x0000000004210000UL, 0x0000000004218000UL, 0x0000000004210420UL,
+                0x0000000004210020UL, 0x0000000004218400UL, 0x0000000004210400UL, 0x0000000004218021UL,
+                0x0000000004218420UL, 0x0000000004210421UL, 0x0000000004210001UL, 0x0000000004218020UL,
+                0x0000000004210021UL, 0x0000000004218001UL, 0x0000000004218421UL, 0x0000000004210401UL,
+                0x0000000000018401UL, 0x0000000000010000UL, 0x0000000000018000UL, 0x0000000000010420UL,
+                0x0000000000010020UL, 0x0000000000018400UL, 0x0000000000010400UL, 0x0000000000018021UL,
+                0x0000000000018420UL, 0x0000000000010421UL, 0x0000000000010001UL, 0x0000000000018020UL,
+                0x0000000000010021UL, 0x0000000000018001UL, 0x0000000000018421UL, 0x0000000000010401UL,
+                0x0000000080208401UL, 0x0000000080200000UL, 0x0000000080208000UL, 0x0000000080200420UL,
+                0x0000000080200020UL, 0x0000000080208400UL, 0x0000000080200400UL, 0x0000000080208021UL,
+                0x0000000080208420UL, 0x0000000080200421UL, 0x0000000080200001UL, 0x0000000080208020UL,
+                0x0000000080200021UL, 0x0000000080208001UL, 0x0000000080208421UL, 0x0000000080200401UL,
+                0x0000000000218401UL, 0x0000000000210000UL, 0x0000000000218000UL, 0x0000000000210420UL,
+                0x0000000000210020UL, 0x0000000000218400UL, 0x0000000000210400UL, 0x0000000000218021UL,
+                0x0000000000218420UL, 0x0000000000210421UL, 0x0000000000210001UL, 0x0000000000218020UL,
+                0x0000000000210021UL, 0x0000000000218001UL, 0x0000000000218421UL, 0x0000000000210401UL,
+                0x0000000080018401UL, 0x0000000080010000UL, 0x0000000080018000UL, 0x0000000080010420UL,
+                0x0000000080010020UL, 0x0000000080018400UL, 0x0000000080010400UL, 0x0000000080018021UL,
+                0x0000000080018420UL, 0x0000000080010421UL, 0x0000000080010001UL, 0x0000000080018020UL,
+                0x0000000080010021UL, 0x0000000080018001UL, 0x0000000080018421UL, 0x0000000080010401UL,
+                0x0000000084218401UL, 0x0000000084210000UL, 0x0000000084218000UL, 0x0000000084210420UL,
+                0x0000000084210020UL, 0x0000000084218400UL, 0x0000000084210400UL, 0x0000000084218021UL,
+                0x0000000084218420UL, 0x0000000084210421UL, 0x0000000084210001UL, 0x0000000084218020UL,
+                0x0000000084210021UL, 0x0000000084218001UL, 0x0000000084218421UL, 0x0000000084210401UL,
+                0x0000000004018401UL, 0x0000000004010000UL, 0x0000000004018000UL, 0x0000000004010420UL,
+                0x0000000004010020UL, 0x0000000004018400UL, 0x0000000004010400UL, 0x0000000004018021UL,
+                0x0000000004018420UL, 0x0000000004010421UL, 0x0000000004010001UL, 0x0000000004018020UL,
+                0x0000000004010021UL, 0x0000000004018001UL, 0x0000000004018421UL, 0x0000000004010401UL,
+        },
+        {
+                0x8401840100000000UL, 0x8401000000000000UL, 0x8401800000000000UL, 0x8401042000000000UL,
+                0x8401002000000000UL, 0x8401840000000000UL, 0x8401040000000000UL, 0x8401802100000000UL,
+                0x8401842000000000UL, 0x8401042100000000UL, 0x8401000100000000UL, 0x8401802000000000UL,
+                0x8401002100000000UL, 0x8401800100000000UL, 0x8401842100000000UL, 0x8401040100000000UL,
+                0x0000840100000000UL, 0x0000000000000000UL, 0x0000800000000000UL, 0x0000042000000000UL,
+                0x0000002000000000UL, 0x0000840000000000UL, 0x0000040000000000UL, 0x0000802100000000UL,
+                0x0000842000000000UL, 0x0000042100000000UL, 0x0000000100000000UL, 0x0000802000000000UL,
+                0x0000002100000000UL, 0x0000800100000000UL, 0x0000842100000000UL, 0x0000040100000000UL,
+                0x8000840100000000UL, 0x8000000000000000UL, 0x8000800000000000UL, 0x8000042000000000UL,
+                0x8000002000000000UL, 0x8000840000000000UL, 0x8000040000000000UL, 0x8000802100000000UL,
+                0x8000842000000000UL, 0x8000042100000000UL, 0x8000000100000000UL, 0x8000802000000000UL,
+                0x8000002100000000UL, 0x8000800100000000UL, 0x8000842100000000UL, 0x8000040100000000UL,
+                0x0420840100000000UL, 0x0420000000000000UL, 0x0420800000000000UL, 0x0420042000000000UL,
+                0x0420002000000000UL, 0x0420840000000000UL, 0x0420040000000000UL, 0x0420802100000000UL,
+                0x0420842000000000UL, 0x0420042100000000UL, 0x0420000100000000UL, 0x0420802000000000UL,
+                0x0420002100000000UL, 0x0420800100000000UL, 0x0420842100000000UL, 0x0420040100000000UL,
+                0x0020840100000000UL, 0x0020000000000000UL, 0x0020800000000000UL, 0x0020042000000000UL,
+                0x0020002000000000UL, 0x0020840000000000UL, 0x0020040000000000UL, 0x0020802100000000UL,
+                0x0020842000000000UL, 0x0020042100000000UL, 0x0020000100000000UL, 0x0020802000000000UL,
+                0x0020002100000000UL, 0x0020800100000000UL, 0x0020842100000000UL, 0x0020040100000000UL,
+                0x8400840100000000UL, 0x8400000000000000UL, 0x8400800000000000UL, 0x8400042000000000UL,
+                0x8400002000000000UL, 0x8400840000000000UL, 0x8400040000000000UL, 0x8400802100000000UL,
+                0x8400842000000000UL, 0x8400042100000000UL, 0x8400000100000000UL, 0x8400802000000000UL,
+                0x8400002100000000UL, 0x8400800100000000UL, 0x8400842100000000UL, 0x8400040100000000UL,
+                0x0400840100000000UL, 0x0400000000000000UL, 0x0400800000000000UL, 0x0400042000000000UL,
+                0x0400002000000000UL, 0x0400840000000000UL, 0x0400040000000000UL, 0x0400802100000000UL,
+                0x0400842000000000UL, 0x0400042100000000UL, 0x0400000100000000UL, 0x0400802000000000UL,
+                0x0400002100000000UL, 0x0400800100000000UL, 0x0400842100000000UL, 0x0400040100000000UL,
+                0x8021840100000000UL, 0x8021000000000000UL, 0x8021800000000000UL, 0x8021042000000000UL,
+                0x8021002000000000UL, 0x8021840000000000UL, 0x8021040000000000UL, 0x8021802100000000UL,
+                0x8021842000000000UL, 0x8021042100000000UL, 0x8021000100000000UL, 0x8021802000000000UL,
+                0x8021002100000000UL, 0x8021800100000000UL, 0x8021842100000000UL, 0x8021040100000000UL,
+                0x8420840100000000UL, 0x8420000000000000UL, 0x8420800000000000UL, 0x8420042000000000UL,
+                0x8420002000000000UL, 0x8420840000000000UL, 0x8420040000000000UL, 0x8420802100000000UL,
+                0x8420842000000000UL, 0x8420042100000000UL, 0x8420000100000000UL, 0x8420802000000000UL,
+                0x8420002100000000UL, 0x8420800100000000UL, 0x8420842100000000UL, 0x8420040100000000UL,
+                0x0421840100000000UL, 0x0421000000000000UL, 0x0421800000000000UL, 0x0421042000000000UL,
+                0x0421002000000000UL, 0x0421840000000000UL, 0x0421040000000000UL, 0x0421802100000000UL,
+                0x0421842000000000UL, 0x0421042100000000UL, 0x0421000100000000UL, 0x0421802000000000UL,
+                0x0421002100000000UL, 0x0421800100000000UL, 0x0421842100000000UL, 0x0421040100000000UL,
+                0x0001840100000000UL, 0x0001000000000000UL, 0x0001800000000000UL, 0x0001042000000000UL,
+                0x0001002000000000UL, 0x0001840000000000UL, 0x0001040000000000UL, 0x0001802100000000UL,
+                0x0001842000000000UL, 0x0001042100000000UL, 0x0001000100000000UL, 0x0001802000000000UL,
+                0x0001002100000000UL, 0x0001800100000000UL, 0x0001842100000000UL, 0x0001040100000000UL,
+                0x8020840100000000UL, 0x8020000000000000UL, 0x8020800000000000UL, 0x8020042000000000UL,
+                0x8020002000000000UL, 0x8020840000000000UL, 0x8020040000000000UL, 0x8020802100000000UL,
+                0x8020842000000000UL, 0x8020042100000000UL, 0x8020000100000000UL, 0x8020802000000000UL,
+                0x8020002100000000UL, 0x8020800100000000UL, 0x8020842100000000UL, 0x8020040100000000UL,
+                0x0021840100000000UL, 0x0021000000000000UL, 0x0021800000000000UL, 0x0021042000000000UL,
+                0x0021002000000000UL, 0x0021840000000000UL, 0x0021040000000000UL, 0x0021802100000000UL,
+                0x0021842000000000UL, 0x0021042100000000UL, 0x0021000100000000UL, 0x0021802000000000UL,
+                0x0021002100000000UL, 0x0021800100000000UL, 0x0021842100000000UL, 0x0021040100000000UL,
+                0x8001840100000000UL, 0x8001000000000000UL, 0x8001800000000000UL, 0x8001042000000000UL,
+                0x8001002000000000UL, 0x8001840000000000UL, 0x8001040000000000UL, 0x8001802100000000UL,
+                0x8001842000000000UL, 0x8001042100000000UL, 0x8001000100000000UL, 0x8001802000000000UL,
+                0x8001002100000000UL, 0x8001800100000000UL, 0x8001842100000000UL, 0x8001040100000000UL,
+                0x8421840100000000UL, 0x8421000000000000UL, 0x8421800000000000UL, 0x8421042000000000UL,
+                0x8421002000000000UL, 0x8421840000000000UL, 0x8421040000000000UL, 0x8421802100000000UL,
+                0x8421842000000000UL, 0x8421042100000000UL, 0x8421000100000000UL, 0x8421802000000000UL,
+                0x8421002100000000UL, 0x8421800100000000UL, 0x8421842100000000UL, 0x8421040100000000UL,
+                0x0401840100000000UL, 0x0401000000000000UL, 0x0401800000000000UL, 0x0401042000000000UL,
+                0x0401002000000000UL, 0x0401840000000000UL, 0x0401040000000000UL, 0x0401802100000000UL,
+                0x0401842000000000UL, 0x0401042100000000UL, 0x0401000100000000UL, 0x0401802000000000UL,
+                0x0401002100000000UL, 0x0401800100000000UL, 0x0401842100000000UL, 0x0401040100000000UL,
+        },
+        {
+                0x0000000018401840UL, 0x0000000018400000UL, 0x0000000018400800UL, 0x0000000018400042UL,
+                0x0000000018400002UL, 0x0000000018400840UL, 0x0000000018400040UL, 0x0000000018401802UL,
+                0x0000000018400842UL, 0x0000000018401042UL, 0x0000000018401000UL, 0x0000000018400802UL,
+                0x0000000018401002UL, 0x0000000018401800UL, 0x0000000018401842UL, 0x0000000018401040UL,
+                0x0000000000001840UL, 0x0000000000000000UL, 0x0000000000000800UL, 0x0000000000000042UL,
+                0x0000000000000002UL, 0x0000000000000840UL, 0x0000000000000040UL, 0x0000000000001802UL,
+                0x0000000000000842UL, 0x0000000000001042UL, 0x0000000000001000UL, 0x0000000000000802UL,
+                0x0000000000001002UL, 0x0000000000001800UL, 0x0000000000001842UL, 0x0000000000001040UL,
+                0x0000000008001840UL, 0x0000000008000000UL, 0x0000000008000800UL, 0x0000000008000042UL,
+                0x0000000008000002UL, 0x0000000008000840UL, 0x0000000008000040UL, 0x0000000008001802UL,
+                0x0000000008000842UL, 0x0000000008001042UL, 0x0000000008001000UL, 0x0000000008000802UL,
+                0x0000000008001002UL, 0x0000000008001800UL, 0x0000000008001842UL, 0x0000000008001040UL,
+                0x0000000000421840UL, 0x0000000000420000UL, 0x0000000000420800UL, 0x0000000000420042UL,
+                0x0000000000420002UL, 0x0000000000420840UL, 0x0000000000420040UL, 0x0000000000421802UL,
+                0x0000000000420842UL, 0x0000000000421042UL, 0x0000000000421000UL, 0x0000000000420802UL,
+                0x0000000000421002UL, 0x0000000000421800UL, 0x0000000000421842UL, 0x0000000000421040UL,
+                0x0000000000021840UL, 0x0000000000020000UL, 0x0000000000020800UL, 0x0000000000020042UL,
+                0x0000000000020002UL, 0x0000000000020840UL, 0x0000000000020040UL, 0x0000000000021802UL,
+                0x0000000000020842UL, 0x0000000000021042UL, 0x0000000000021000UL, 0x0000000000020802UL,
+                0x0000000000021002UL, 0x0000000000021800UL, 0x0000000000021842UL, 0x0000000000021040UL,
+                0x0000000008401840UL, 0x0000000008400000UL, 0x0000000008400800UL, 0x0000000008400042UL,
+                0x0000000008400002UL, 0x0000000008400840UL, 0x0000000008400040UL, 0x0000000008401802UL,
+                0x0000000008400842UL, 0x0000000008401042UL, 0x0000000008401000UL, 0x0000000008400802UL,
+                0x0000000008401002UL, 0x0000000008401800UL, 0x0000000008401842UL, 0x0000000008401040UL,
+                0x0000000000401840UL, 0x0000000000400000UL, 0x0000000000400800UL, 0x0000000000400042UL,
+                0x0000000000400002UL, 0x0000000000400840UL, 0x0000000000400040UL, 0x0000000000401802UL,
+                0x0000000000400842UL, 0x0000000000401042UL, 0x0000000000401000UL, 0x0000000000400802UL,
+                0x0000000000401002UL, 0x0000000000401800UL, 0x0000000000401842UL, 0x0000000000401040UL,
+                0x0000000018021840UL, 0x0000000018020000UL, 0x0000000018020800UL, 0x0000000018020042UL,
+                0x0000000018020002UL, 0x0000000018020840UL, 0x0000000018020040UL, 0x0000000018021802UL,
+                0x0000000018020842UL, 0x0000000018021042UL, 0x0000000018021000UL, 0x0000000018020802UL,
+                0x0000000018021002UL, 0x0000000018021800UL, 0x0000000018021842UL, 0x0000000018021040UL,
+                0x0000000008421840UL, 0x0000000008420000UL, 0x0000000008420800UL, 0x0000000008420042UL,
+                0x0000000008420002UL, 0x0000000008420840UL, 0x0000000008420040UL, 0x0000000008421802UL,
+                0x0000000008420842UL, 0x0000000008421042UL, 0x0000000008421000UL, 0x0000000008420802UL,
+                0x0000000008421002UL, 0x0000000008421800UL, 0x0000000008421842UL, 0x0000000008421040UL,
+                0x0000000010421840UL, 0x0000000010420000UL, 0x0000000010420800UL, 0x0000000010420042UL,
+                0x0000000010420002UL, 0x0000000010420840UL, 0x0000000010420040UL, 0x0000000010421802UL,
+                0x0000000010420842UL, 0x0000000010421042UL, 0x0000000010421000UL, 0x0000000010420802UL,
+                0x0000000010421002UL, 0x0000000010421800UL, 0x0000000010421842UL, 0x0000000010421040UL,
+                0x0000000010001840UL, 0x0000000010000000UL, 0x0000000010000800UL, 0x0000000010000042UL,
+                0x0000000010000002UL, 0x0000000010000840UL, 0x0000000010000040UL, 0x0000000010001802UL,
+                0x0000000010000842UL, 0x0000000010001042UL, 0x0000000010001000UL, 0x0000000010000802UL,
+                0x0000000010001002UL, 0x0000000010001800UL, 0x0000000010001842UL, 0x0000000010001040UL,
+                0x0000000008021840UL, 0x0000000008020000UL, 0x0000000008020800UL, 0x0000000008020042UL,
+                0x0000000008020002UL, 0x0000000008020840UL, 0x0000000008020040UL, 0x0000000008021802UL,
+                0x0000000008020842UL, 0x0000000008021042UL, 0x0000000008021000UL, 0x0000000008020802UL,
+                0x0000000008021002UL, 0x0000000008021800UL, 0x0000000008021842UL, 0x0000000008021040UL,
+                0x0000000010021840UL, 0x0000000010020000UL, 0x0000000010020800UL, 0x0000000010020042UL,
+                0x0000000010020002UL, 0x0000000010020840UL, 0x0000000010020040UL, 0x0000000010021802UL,
+                0x0000000010020842UL, 0x0000000010021042UL, 0x0000000010021000UL, 0x0000000010020802UL,
+                0x0000000010021002UL, 0x0000000010021800UL, 0x0000000010021842UL, 0x0000000010021040UL,
+                0x0000000018001840UL, 0x0000000018000000UL, 0x0000000018000800UL, 0x0000000018000042UL,
+                0x0000000018000002UL, 0x0000000018000840UL, 0x0000000018000040UL, 0x0000000018001802UL,
+                0x0000000018000842UL, 0x0000000018001042UL, 0x0000000018001000UL, 0x0000000018000802UL,
+                0x0000000018001002UL, 0x0000000018001800UL, 0x0000000018001842UL, 0x0000000018001040UL,
+                0x0000000018421840UL, 0x0000000018420000UL, 0x0000000018420800UL, 0x0000000018420042UL,
+                0x0000000018420002UL, 0x0000000018420840UL, 0x0000000018420040UL, 0x0000000018421802UL,
+                0x0000000018420842UL, 0x0000000018421042UL, 0x0000000018421000UL, 0x0000000018420802UL,
+                0x0000000018421002UL, 0x0000000018421800UL, 0x0000000018421842UL, 0x0000000018421040UL,
+                0x0000000010401840UL, 0x0000000010400000UL, 0x0000000010400800UL, 0x0000000010400042UL,
+                0x0000000010400002UL, 0x0000000010400840UL, 0x0000000010400040UL, 0x0000000010401802UL,
+                0x0000000010400842UL, 0x0000000010401042UL, 0x0000000010401000UL, 0x0000000010400802UL,
+                0x0000000010401002UL, 0x0000000010401800UL, 0x0000000010401842UL, 0x0000000010401040UL,
+        },
+        {
+                0x1840184000000000UL, 0x1840000000000000UL, 0x1840080000000000UL, 0x1840004200000000UL,
+                0x1840000200000000UL, 0x1840084000000000UL, 0x1840004000000000UL, 0x1840180200000000UL,
+                0x1840084200000000UL, 0x1840104200000000UL, 0x1840100000000000UL, 0x1840080200000000UL,
+                0x1840100200000000UL, 0x1840180000000000UL, 0x1840184200000000UL, 0x1840104000000000UL,
+                0x0000184000000000UL, 0x0000000000000000UL, 0x0000080000000000UL, 0x0000004200000000UL,
+                0x0000000200000000UL, 0x0000084000000000UL, 0x0000004000000000UL, 0x0000180200000000UL,
+                0x0000084200000000UL, 0x0000104200000000UL, 0x0000100000000000UL, 0x0000080200000000UL,
+                0x0000100200000000UL, 0x0000180000000000UL, 0x0000184200000000UL, 0x0000104000000000UL,
+                0x0800184000000000UL, 0x0800000000000000UL, 0x0800080000000000UL, 0x0800004200000000UL,
+                0x0800000200000000UL, 0x0800084000000000UL, 0x0800004000000000UL, 0x0800180200000000UL,
+                0x0800084200000000UL, 0x0800104200000000UL, 0x0800100000000000UL, 0x0800080200000000UL,
+                0x0800100200000000UL, 0x0800180000000000UL, 0x0800184200000000UL, 0x0800104000000000UL,
+                0x0042184000000000UL, 0x0042000000000000UL, 0x0042080000000000UL, 0x0042004200000000UL,
+                0x0042000200000000UL, 0x0042084000000000UL, 0x0042004000000000UL, 0x0042180200000000UL,
+                0x0042084200000000UL, 0x0042104200000000UL, 0x0042100000000000UL, 0x0042080200000000UL,
+                0x0042100200000000UL, 0x0042180000000000UL, 0x0042184200000000UL, 0x0042104000000000UL,
+                0x0002184000000000UL, 0x0002000000000000UL, 0x0002080000000000UL, 0x0002004200000000UL,
+                0x0002000200000000UL, 0x0002084000000000UL, 0x0002004000000000UL, 0x0002180200000000UL,
+                0x0002084200000000UL, 0x0002104200000000UL, 0x0002100000000000UL, 0x0002080200000000UL,
+                0x0002100200000000UL, 0x0002180000000000UL, 0x0002184200000000UL, 0x0002104000000000UL,
+                0x0840184000000000UL, 0x0840000000000000UL, 0x0840080000000000UL, 0x0840004200000000UL,
+                0x0840000200000000UL, 0x0840084000000000UL, 0x0840004000000000UL, 0x0840180200000000UL,
+                0x0840084200000000UL, 0x0840104200000000UL, 0x0840100000000000UL, 0x0840080200000000UL,
+                0x0840100200000000UL, 0x0840180000000000UL, 0x0840184200000000UL, 0x0840104000000000UL,
+                0x0040184000000000UL, 0x0040000000000000UL, 0x0040080000000000UL, 0x0040004200000000UL,
+                0x0040000200000000UL, 0x0040084000000000UL, 0x0040004000000000UL, 0x0040180200000000UL,
+                0x0040084200000000UL, 0x0040104200000000UL, 0x0040100000000000UL, 0x0040080200000000UL,
+                0x0040100200000000UL, 0x0040180000000000UL, 0x0040184200000000UL, 0x0040104000000000UL,
+                0x1802184000000000UL, 0x1802000000000000UL, 0x1802080000000000UL, 0x1802004200000000UL,
+                0x1802000200000000UL, 0x1802084000000000UL, 0x1802004000000000UL, 0x1802180200000000UL,
+                0x1802084200000000UL, 0x1802104200000000UL, 0x1802100000000000UL, 0x1802080200000000UL,
+                0x1802100200000000UL, 0x1802180000000000UL, 0x1802184200000000UL, 0x1802104000000000UL,
+                0x0842184000000000UL, 0x0842000000000000UL, 0x0842080000000000UL, 0x0842004200000000UL,
+                0x0842000200000000UL, 0x0842084000000000UL, 0x0842004000000000UL, 0x0842180200000000UL,
+                0x0842084200000000UL, 0x0842104200000000UL, 0x0842100000000000UL, 0x0842080200000000UL,
+                0x0842100200000000UL, 0x0842180000000000UL, 0x0842184200000000UL, 0x0842104000000000UL,
+                0x1042184000000000UL, 0x1042000000000000UL, 0x1042080000000000UL, 0x1042004200000000UL,
+                0x1042000200000000UL, 0x1042084000000000UL, 0x1042004000000000UL, 0x1042180200000000UL,
+                0x1042084200000000UL, 0x1042104200000000UL, 0x1042100000000000UL, 0x1042080200000000UL,
+                0x1042100200000000UL, 0x1042180000000000UL, 0x1042184200000000UL, 0x1042104000000000UL,
+                0x1000184000000000UL, 0x1000000000000000UL, 0x1000080000000000UL, 0x1000004200000000UL,
+                0x1000000200000000UL, 0x1000084000000000UL, 0x1000004000000000UL, 0x1000180200000000UL,
+                0x1000084200000000UL, 0x1000104200000000UL, 0x1000100000000000UL, 0x1000080200000000UL,
+                0x1000100200000000UL, 0x1000180000000000UL, 0x1000184200000000UL, 0x1000104000000000UL,
+                0x0802184000000000UL, 0x0802000000000000UL, 0x0802080000000000UL, 0x0802004200000000UL,
+                0x0802000200000000UL, 0x0802084000000000UL, 0x0802004000000000UL, 0x0802180200000000UL,
+                0x0802084200000000UL, 0x0802104200000000UL, 0x0802100000000000UL, 0x0802080200000000UL,
+                0x0802100200000000UL, 0x0802180000000000UL, 0x0802184200000000UL, 0x0802104000000000UL,
+                0x1002184000000000UL, 0x1002000000000000UL, 0x1002080000000000UL, 0x1002004200000000UL,
+                0x1002000200000000UL, 0x1002084000000000UL, 0x1002004000000000UL, 0x1002180200000000UL,
+                0x1002084200000000UL, 0x1002104200000000UL, 0x1002100000000000UL, 0x1002080200000000UL,
+                0x1002100200000000UL, 0x1002180000000000UL, 0x1002184200000000UL, 0x1002104000000000UL,
+                0x1800184000000000UL, 0x1800000000000000UL, 0x1800080000000000UL, 0x1800004200000000UL,
+                0x1800000200000000UL, 0x1800084000000000UL, 0x1800004000000000UL, 0x1800180200000000UL,
+                0x1800084200000000UL, 0x1800104200000000UL, 0x1800100000000000UL, 0x1800080200000000UL,
+                0x1800100200000000UL, 0x1800180000000000UL, 0x1800184200000000UL, 0x1800104000000000UL,
+                0x1842184000000000UL, 0x1842000000000000UL, 0x1842080000000000UL, 0x1842004200000000UL,
+                0x1842000200000000UL, 0x1842084000000000UL, 0x1842004000000000UL, 0x1842180200000000UL,
+                0x1842084200000000UL, 0x1842104200000000UL, 0x1842100000000000UL, 0x1842080200000000UL,
+                0x1842100200000000UL, 0x1842180000000000UL, 0x1842184200000000UL, 0x1842104000000000UL,
+                0x1040184000000000UL, 0x1040000000000000UL, 0x1040080000000000UL, 0x1040004200000000UL,
+                0x1040000200000000UL, 0x1040084000000000UL, 0x1040004000000000UL, 0x1040180200000000UL,
+                0x1040084200000000UL, 0x1040104200000000UL, 0x1040100000000000UL, 0x1040080200000000UL,
+                0x1040100200000000UL, 0x1040180000000000UL, 0x1040184200000000UL, 0x1040104000000000UL,
+        },
+        {
+                0x0000000001840184UL, 0x0000000001840000UL, 0x0000000001840080UL, 0x0000000001842004UL,
+                0x0000000001842000UL, 0x0000000001840084UL, 0x0000000001840004UL, 0x0000000001842180UL,
+                0x0000000001842084UL, 0x0000000001842104UL, 0x0000000001840100UL, 0x0000000001842080UL,
+                0x0000000001842100UL, 0x0000000001840180UL, 0x0000000001842184UL, 0x0000000001840104UL,
+                0x0000000000000184UL, 0x0000000000000000UL, 0x0000000000000080UL, 0x0000000000002004UL,
+                0x0000000000002000UL, 0x0000000000000084UL, 0x0000000000000004UL, 0x0000000000002180UL,
+                0x0000000000002084UL, 0x0000000000002104UL, 0x0000000000000100UL, 0x0000000000002080UL,
+                0x0000000000002100UL, 0x0000000000000180UL, 0x0000000000002184UL, 0x0000000000000104UL,
+                0x0000000000800184UL, 0x0000000000800000UL, 0x0000000000800080UL, 0x0000000000802004UL,
+                0x0000000000802000UL, 0x0000000000800084UL, 0x0000000000800004UL, 0x0000000000802180UL,
+                0x0000000000802084UL, 0x0000000000802104UL, 0x0000000000800100UL, 0x0000000000802080UL,
+                0x0000000000802100UL, 0x0000000000800180UL, 0x0000000000802184UL, 0x0000000000800104UL,
+                0x0000000020040184UL, 0x0000000020040000UL, 0x0000000020040080UL, 0x0000000020042004UL,
+                0x0000000020042000UL, 0x0000000020040084UL, 0x0000000020040004UL, 0x0000000020042180UL,
+                0x0000000020042084UL, 0x0000000020042104UL, 0x0000000020040100UL, 0x0000000020042080UL,
+                0x0000000020042100UL, 0x0000000020040180UL, 0x0000000020042184UL, 0x0000000020040104UL,
+                0x0000000020000184UL, 0x0000000020000000UL, 0x0000000020000080UL, 0x0000000020002004UL,
+                0x0000000020002000UL, 0x0000000020000084UL, 0x0000000020000004UL, 0x0000000020002180UL,
+                0x0000000020002084UL, 0x0000000020002104UL, 0x0000000020000100UL, 0x0000000020002080UL,
+                0x0000000020002100UL, 0x0000000020000180UL, 0x0000000020002184UL, 0x0000000020000104UL,
+                0x0000000000840184UL, 0x0000000000840000UL, 0x0000000000840080UL, 0x0000000000842004UL,
+                0x0000000000842000UL, 0x0000000000840084UL, 0x0000000000840004UL, 0x0000000000842180UL,
+                0x0000000000842084UL, 0x0000000000842104UL, 0x0000000000840100UL, 0x0000000000842080UL,
+                0x0000000000842100UL, 0x0000000000840180UL, 0x0000000000842184UL, 0x0000000000840104UL,
+                0x0000000000040184UL, 0x0000000000040000UL, 0x0000000000040080UL, 0x0000000000042004UL,
+                0x0000000000042000UL, 0x0000000000040084UL, 0x0000000000040004UL, 0x0000000000042180UL,
+                0x0000000000042084UL, 0x0000000000042104UL, 0x0000000000040100UL, 0x0000000000042080UL,
+                0x0000000000042100UL, 0x0000000000040180UL, 0x0000000000042184UL, 0x0000000000040104UL,
+                0x0000000021800184UL, 0x0000000021800000UL, 0x0000000021800080UL, 0x0000000021802004UL,
+                0x0000000021802000UL, 0x0000000021800084UL, 0x0000000021800004UL, 0x0000000021802180UL,
+                0x0000000021802084UL, 0x0000000021802104UL, 0x0000000021800100UL, 0x0000000021802080UL,
+                0x0000000021802100UL, 0x0000000021800180UL, 0x0000000021802184UL, 0x0000000021800104UL,
+                0x0000000020840184UL, 0x0000000020840000UL, 0x0000000020840080UL, 0x0000000020842004UL,
+                0x0000000020842000UL, 0x0000000020840084UL, 0x0000000020840004UL, 0x0000000020842180UL,
+                0x0000000020842084UL, 0x0000000020842104UL, 0x0000000020840100UL, 0x0000000020842080UL,
+                0x0000000020842100UL, 0x0000000020840180UL, 0x0000000020842184UL, 0x0000000020840104UL,
+                0x0000000021040184UL, 0x0000000021040000UL, 0x0000000021040080UL, 0x0000000021042004UL,
+                0x0000000021042000UL, 0x0000000021040084UL, 0x0000000021040004UL, 0x0000000021042180UL,
+                0x0000000021042084UL, 0x0000000021042104UL, 0x0000000021040100UL, 0x0000000021042080UL,
+                0x0000000021042100UL, 0x0000000021040180UL, 0x0000000021042184UL, 0x0000000021040104UL,
+                0x0000000001000184UL, 0x0000000001000000UL, 0x0000000001000080UL, 0x0000000001002004UL,
+                0x0000000001002000UL, 0x0000000001000084UL, 0x0000000001000004UL, 0x0000000001002180UL,
+                0x0000000001002084UL, 0x0000000001002104UL, 0x0000000001000100UL, 0x0000000001002080UL,
+                0x0000000001002100UL, 0x0000000001000180UL, 0x0000000001002184UL, 0x0000000001000104UL,
+                0x0000000020800184UL, 0x0000000020800000UL, 0x0000000020800080UL, 0x0000000020802004UL,
+                0x0000000020802000UL, 0x0000000020800084UL, 0x0000000020800004UL, 0x0000000020802180UL,
+                0x0000000020802084UL, 0x0000000020802104UL, 0x0000000020800100UL, 0x0000000020802080UL,
+                0x0000000020802100UL, 0x0000000020800180UL, 0x0000000020802184UL, 0x0000000020800104UL,
+                0x0000000021000184UL, 0x0000000021000000UL, 0x0000000021000080UL, 0x0000000021002004UL,
+                0x0000000021002000UL, 0x0000000021000084UL, 0x0000000021000004UL, 0x0000000021002180UL,
+                0x0000000021002084UL, 0x0000000021002104UL, 0x0000000021000100UL, 0x0000000021002080UL,
+                0x0000000021002100UL, 0x0000000021000180UL, 0x0000000021002184UL, 0x0000000021000104UL,
+                0x0000000001800184UL, 0x0000000001800000UL, 0x0000000001800080UL, 0x0000000001802004UL,
+                0x0000000001802000UL, 0x0000000001800084UL, 0x0000000001800004UL, 0x0000000001802180UL,
+                0x0000000001802084UL, 0x0000000001802104UL, 0x0000000001800100UL, 0x0000000001802080UL,
+                0x0000000001802100UL, 0x0000000001800180UL, 0x0000000001802184UL, 0x0000000001800104UL,
+                0x0000000021840184UL, 0x0000000021840000UL, 0x0000000021840080UL, 0x0000000021842004UL,
+                0x0000000021842000UL, 0x0000000021840084UL, 0x0000000021840004UL, 0x0000000021842180UL,
+                0x0000000021842084UL, 0x0000000021842104UL, 0x0000000021840100UL, 0x0000000021842080UL,
+                0x0000000021842100UL, 0x0000000021840180UL, 0x0000000021842184UL, 0x0000000021840104UL,
+                0x0000000001040184UL, 0x0000000001040000UL, 0x0000000001040080UL, 0x0000000001042004UL,
+                0x0000000001042000UL, 0x0000000001040084UL, 0x0000000001040004UL, 0x0000000001042180UL,
+                0x0000000001042084UL, 0x0000000001042104UL, 0x0000000001040100UL, 0x0000000001042080UL,
+                0x0000000001042100UL, 0x0000000001040180UL, 0x0000000001042184UL, 0x0000000001040104UL,
+        },
+        {
+                0x0184018400000000UL, 0x0184000000000000UL, 0x0184008000000000UL, 0x0184200400000000UL,
+                0x0184200000000000UL, 0x0184008400000000UL, 0x0184000400000000UL, 0x0184218000000000UL,
+                0x0184208400000000UL, 0x0184210400000000UL, 0x0184010000000000UL, 0x0184208000000000UL,
+                0x0184210000000000UL, 0x0184018000000000UL, 0x0184218400000000UL, 0x0184010400000000UL,
+                0x0000018400000000UL, 0x0000000000000000UL, 0x0000008000000000UL, 0x0000200400000000UL,
+                0x0000200000000000UL, 0x0000008400000000UL, 0x0000000400000000UL, 0x0000218000000000UL,
+                0x0000208400000000UL, 0x0000210400000000UL, 0x0000010000000000UL, 0x0000208000000000UL,
+                0x0000210000000000UL, 0x0000018000000000UL, 0x0000218400000000UL, 0x0000010400000000UL,
+                0x0080018400000000UL, 0x0080000000000000UL, 0x0080008000000000UL, 0x0080200400000000UL,
+                0x0080200000000000UL, 0x0080008400000000UL, 0x0080000400000000UL, 0x0080218000000000UL,
+                0x0080208400000000UL, 0x0080210400000000UL, 0x0080010000000000UL, 0x0080208000000000UL,
+                0x0080210000000000UL, 0x0080018000000000UL, 0x0080218400000000UL, 0x0080010400000000UL,
+                0x2004018400000000UL, 0x2004000000000000UL, 0x2004008000000000UL, 0x2004200400000000UL,
+                0x2004200000000000UL, 0x2004008400000000UL, 0x2004000400000000UL, 0x2004218000000000UL,
+                0x2004208400000000UL, 0x2004210400000000UL, 0x2004010000000000UL, 0x2004208000000000UL,
+                0x2004210000000000UL, 0x2004018000000000UL, 0x2004218400000000UL, 0x2004010400000000UL,
+                0x2000018400000000UL, 0x2000000000000000UL, 0x2000008000000000UL, 0x2000200400000000UL,
+                0x2000200000000000UL, 0x2000008400000000UL, 0x2000000400000000UL, 0x2000218000000000UL,
+                0x2000208400000000UL, 0x2000210400000000UL, 0x2000010000000000UL, 0x2000208000000000UL,
+                0x2000210000000000UL, 0x2000018000000000UL, 0x2000218400000000UL, 0x2000010400000000UL,
+                0x0084018400000000UL, 0x0084000000000000UL, 0x0084008000000000UL, 0x0084200400000000UL,
+                0x0084200000000000UL, 0x0084008400000000UL, 0x0084000400000000UL, 0x0084218000000000UL,
+                0x0084208400000000UL, 0x0084210400000000UL, 0x0084010000000000UL, 0x0084208000000000UL,
+                0x0084210000000000UL, 0x0084018000000000UL, 0x0084218400000000UL, 0x0084010400000000UL,
+                0x0004018400000000UL, 0x0004000000000000UL, 0x0004008000000000UL, 0x0004200400000000UL,
+                0x0004200000000000UL, 0x0004008400000000UL, 0x0004000400000000UL, 0x0004218000000000UL,
+                0x0004208400000000UL, 0x0004210400000000UL, 0x0004010000000000UL, 0x0004208000000000UL,
+                0x0004210000000000UL, 0x0004018000000000UL, 0x0004218400000000UL, 0x0004010400000000UL,
+                0x2180018400000000UL, 0x2180000000000000UL, 0x2180008000000000UL, 0x2180200400000000UL,
+                0x2180200000000000UL, 0x2180008400000000UL, 0x2180000400000000UL, 0x2180218000000000UL,
+                0x2180208400000000UL, 0x2180210400000000UL, 0x2180010000000000UL, 0x2180208000000000UL,
+                0x2180210000000000UL, 0x2180018000000000UL, 0x2180218400000000UL, 0x2180010400000000UL,
+                0x2084018400000000UL, 0x2084000000000000UL, 0x2084008000000000UL, 0x2084200400000000UL,
+                0x2084200000000000UL, 0x2084008400000000UL, 0x2084000400000000UL, 0x2084218000000000UL,
+                0x2084208400000000UL, 0x2084210400000000UL, 0x2084010000000000UL, 0x2084208000000000UL,
+                0x2084210000000000UL, 0x2084018000000000UL, 0x2084218400000000UL, 0x2084010400000000UL,
+                0x2104018400000000UL, 0x2104000000000000UL, 0x2104008000000000UL, 0x2104200400000000UL,
+                0x2104200000000000UL, 0x2104008400000000UL, 0x2104000400000000UL, 0x2104218000000000UL,
+                0x2104208400000000UL, 0x2104210400000000UL, 0x2104010000000000UL, 0x2104208000000000UL,
+                0x2104210000000000UL, 0x2104018000000000UL, 0x2104218400000000UL, 0x2104010400000000UL,
+                0x0100018400000000UL, 0x0100000000000000UL, 0x0100008000000000UL, 0x0100200400000000UL,
+                0x0100200000000000UL, 0x0100008400000000UL, 0x0100000400000000UL, 0x0100218000000000UL,
+                0x0100208400000000UL, 0x0100210400000000UL, 0x0100010000000000UL, 0x0100208000000000UL,
+                0x0100210000000000UL, 0x0100018000000000UL, 0x0100218400000000UL, 0x0100010400000000UL,
+                0x2080018400000000UL, 0x2080000000000000UL, 0x2080008000000000UL, 0x2080200400000000UL,
+                0x2080200000000000UL, 0x2080008400000000UL, 0x2080000400000000UL, 0x2080218000000000UL,
+                0x2080208400000000UL, 0x2080210400000000UL, 0x2080010000000000UL, 0x2080208000000000UL,
+                0x2080210000000000UL, 0x2080018000000000UL, 0x2080218400000000UL, 0x2080010400000000UL,
+                0x2100018400000000UL, 0x2100000000000000UL, 0x2100008000000000UL, 0x2100200400000000UL,
+                0x2100200000000000UL, 0x2100008400000000UL, 0x2100000400000000UL, 0x2100218000000000UL,
+                0x2100208400000000UL, 0x2100210400000000UL, 0x2100010000000000UL, 0x2100208000000000UL,
+                0x2100210000000000UL, 0x2100018000000000UL, 0x2100218400000000UL, 0x2100010400000000UL,
+                0x0180018400000000UL, 0x0180000000000000UL, 0x0180008000000000UL, 0x0180200400000000UL,
+                0x0180200000000000UL, 0x0180008400000000UL, 0x0180000400000000UL, 0x0180218000000000UL,
+                0x0180208400000000UL, 0x0180210400000000UL, 0x0180010000000000UL, 0x0180208000000000UL,
+                0x0180210000000000UL, 0x0180018000000000UL, 0x0180218400000000UL, 0x0180010400000000UL,
+                0x2184018400000000UL, 0x2184000000000000UL, 0x2184008000000000UL, 0x2184200400000000UL,
+                0x2184200000000000UL, 0x2184008400000000UL, 0x2184000400000000UL, 0x2184218000000000UL,
+                0x2184208400000000UL, 0x2184210400000000UL, 0x2184010000000000UL, 0x2184208000000000UL,
+                0x2184210000000000UL, 0x2184018000000000UL, 0x2184218400000000UL, 0x2184010400000000UL,
+                0x0104018400000000UL, 0x0104000000000000UL, 0x0104008000000000UL, 0x0104200400000000UL,
+                0x0104200000000000UL, 0x0104008400000000UL, 0x0104000400000000UL, 0x0104218000000000UL,
+                0x0104208400000000UL, 0x0104210400000000UL, 0x0104010000000000UL, 0x0104208000000000UL,
+                0x0104210000000000UL, 0x0104018000000000UL, 0x0104218400000000UL, 0x0104010400000000UL,
+        },
+        {
+                0x0000000040184018UL, 0x0000000040180000UL, 0x0000000040180008UL, 0x0000000040184200UL,
+                0x0000000040180200UL, 0x0000000040184008UL, 0x0000000040184000UL, 0x0000000040180218UL,
+                0x0000000040184208UL, 0x0000000040184210UL, 0x0000000040180010UL, 0x0000000040180208UL,
+                0x0000000040180210UL, 0x0000000040180018UL, 0x0000000040184218UL, 0x0000000040184010UL,
+                0x0000000000004018UL, 0x0000000000000000UL, 0x0000000000000008UL, 0x0000000000004200UL,
+                0x0000000000000200UL, 0x0000000000004008UL, 0x0000000000004000UL, 0x0000000000000218UL,
+                0x0000000000004208UL, 0x0000000000004210UL, 0x0000000000000010UL, 0x0000000000000208UL,
+                0x0000000000000210UL, 0x0000000000000018UL, 0x0000000000004218UL, 0x0000000000004010UL,
+                0x0000000000084018UL, 0x0000000000080000UL, 0x0000000000080008UL, 0x0000000000084200UL,
+                0x0000000000080200UL, 0x0000000000084008UL, 0x0000000000084000UL, 0x0000000000080218UL,
+                0x0000000000084208UL, 0x0000000000084210UL, 0x0000000000080010UL, 0x0000000000080208UL,
+                0x0000000000080210UL, 0x0000000000080018UL, 0x0000000000084218UL, 0x0000000000084010UL,
+                0x0000000042004018UL, 0x0000000042000000UL, 0x0000000042000008UL, 0x0000000042004200UL,
+                0x0000000042000200UL, 0x0000000042004008UL, 0x0000000042004000UL, 0x0000000042000218UL,
+                0x0000000042004208UL, 0x0000000042004210UL, 0x0000000042000010UL, 0x0000000042000208UL,
+                0x0000000042000210UL, 0x0000000042000018UL, 0x0000000042004218UL, 0x0000000042004010UL,
+                0x0000000002004018UL, 0x0000000002000000UL, 0x0000000002000008UL, 0x0000000002004200UL,
+                0x0000000002000200UL, 0x0000000002004008UL, 0x0000000002004000UL, 0x0000000002000218UL,
+                0x0000000002004208UL, 0x0000000002004210UL, 0x0000000002000010UL, 0x0000000002000208UL,
+                0x0000000002000210UL, 0x0000000002000018UL, 0x0000000002004218UL, 0x0000000002004010UL,
+                0x0000000040084018UL, 0x0000000040080000UL, 0x0000000040080008UL, 0x0000000040084200UL,
+                0x0000000040080200UL, 0x0000000040084008UL, 0x0000000040084000UL, 0x0000000040080218UL,
+                0x0000000040084208UL, 0x0000000040084210UL, 0x0000000040080010UL, 0x0000000040080208UL,
+                0x0000000040080210UL, 0x0000000040080018UL, 0x0000000040084218UL, 0x0000000040084010UL,
+                0x0000000040004018UL, 0x0000000040000000UL, 0x0000000040000008UL, 0x0000000040004200UL,
+                0x0000000040000200UL, 0x0000000040004008UL, 0x0000000040004000UL, 0x0000000040000218UL,
+                0x0000000040004208UL, 0x0000000040004210UL, 0x0000000040000010UL, 0x0000000040000208UL,
+                0x0000000040000210UL, 0x0000000040000018UL, 0x0000000040004218UL, 0x0000000040004010UL,
+                0x0000000002184018UL, 0x0000000002180000UL, 0x0000000002180008UL, 0x0000000002184200UL,
+                0x0000000002180200UL, 0x0000000002184008UL, 0x0000000002184000UL, 0x0000000002180218UL,
+                0x0000000002184208UL, 0x0000000002184210UL, 0x0000000002180010UL, 0x0000000002180208UL,
+                0x0000000002180210UL, 0x0000000002180018UL, 0x0000000002184218UL, 0x0000000002184010UL,
+                0x0000000042084018UL, 0x0000000042080000UL, 0x0000000042080008UL, 0x0000000042084200UL,
+                0x0000000042080200UL, 0x0000000042084008UL, 0x0000000042084000UL, 0x0000000042080218UL,
+                0x0000000042084208UL, 0x0000000042084210UL, 0x0000000042080010UL, 0x0000000042080208UL,
+                0x0000000042080210UL, 0x0000000042080018UL, 0x0000000042084218UL, 0x0000000042084010UL,
+                0x0000000042104018UL, 0x0000000042100000UL, 0x0000000042100008UL, 0x0000000042104200UL,
+                0x0000000042100200UL, 0x0000000042104008UL, 0x0000000042104000UL, 0x0000000042100218UL,
+                0x0000000042104208UL, 0x0000000042104210UL, 0x0000000042100010UL, 0x0000000042100208UL,
+                0x0000000042100210UL, 0x0000000042100018UL, 0x0000000042104218UL, 0x0000000042104010UL,
+                0x0000000000104018UL, 0x0000000000100000UL, 0x0000000000100008UL, 0x0000000000104200UL,
+                0x0000000000100200UL, 0x0000000000104008UL, 0x0000000000104000UL, 0x0000000000100218UL,
+                0x0000000000104208UL, 0x0000000000104210UL, 0x0000000000100010UL, 0x0000000000100208UL,
+                0x0000000000100210UL, 0x0000000000100018UL, 0x0000000000104218UL, 0x0000000000104010UL,
+                0x0000000002084018UL, 0x0000000002080000UL, 0x0000000002080008UL, 0x0000000002084200UL,
+                0x0000000002080200UL, 0x0000000002084008UL, 0x0000000002084000UL, 0x0000000002080218UL,
+                0x0000000002084208UL, 0x0000000002084210UL, 0x0000000002080010UL, 0x0000000002080208UL,
+                0x0000000002080210UL, 0x0000000002080018UL, 0x0000000002084218UL, 0x0000000002084010UL,
+                0x0000000002104018UL, 0x0000000002100000UL, 0x0000000002100008UL, 0x0000000002104200UL,
+                0x0000000002100200UL, 0x0000000002104008UL, 0x0000000002104000UL, 0x0000000002100218UL,
+                0x0000000002104208UL, 0x0000000002104210UL, 0x0000000002100010UL, 0x0000000002100208UL,
+                0x0000000002100210UL, 0x0000000002100018UL, 0x0000000002104218UL, 0x0000000002104010UL,
+                0x0000000000184018UL, 0x0000000000180000UL, 0x0000000000180008UL, 0x0000000000184200UL,
+                0x0000000000180200UL, 0x0000000000184008UL, 0x0000000000184000UL, 0x0000000000180218UL,
+                0x0000000000184208UL, 0x0000000000184210UL, 0x0000000000180010UL, 0x0000000000180208UL,
+                0x0000000000180210UL, 0x0000000000180018UL, 0x0000000000184218UL, 0x0000000000184010UL,
+                0x0000000042184018UL, 0x0000000042180000UL, 0x0000000042180008UL, 0x0000000042184200UL,
+                0x0000000042180200UL, 0x0000000042184008UL, 0x0000000042184000UL, 0x0000000042180218UL,
+                0x0000000042184208UL, 0x0000000042184210UL, 0x0000000042180010UL, 0x0000000042180208UL,
+                0x0000000042180210UL, 0x0000000042180018UL, 0x0000000042184218UL, 0x0000000042184010UL,
+                0x0000000040104018UL, 0x0000000040100000UL, 0x0000000040100008UL, 0x0000000040104200UL,
+                0x0000000040100200UL, 0x0000000040104008UL, 0x0000000040104000UL, 0x0000000040100218UL,
+                0x0000000040104208UL, 0x0000000040104210UL, 0x0000000040100010UL, 0x0000000040100208UL,
+                0x0000000040100210UL, 0x0000000040100018UL, 0x0000000040104218UL, 0x0000000040104010UL,
+        },
+        {
+                0x4018401800000000UL, 0x4018000000000000UL, 0x4018000800000000UL, 0x4018420000000000UL,
+                0x4018020000000000UL, 0x4018400800000000UL, 0x4018400000000000UL, 0x4018021800000000UL,
+                0x4018420800000000UL, 0x4018421000000000UL, 0x4018001000000000UL, 0x4018020800000000UL,
+                0x4018021000000000UL, 0x4018001800000000UL, 0x4018421800000000UL, 0x4018401000000000UL,
+                0x0000401800000000UL, 0x0000000000000000UL, 0x0000000800000000UL, 0x0000420000000000UL,
+                0x0000020000000000UL, 0x0000400800000000UL, 0x0000400000000000UL, 0x0000021800000000UL,
+                0x0000420800000000UL, 0x0000421000000000UL, 0x0000001000000000UL, 0x0000020800000000UL,
+                0x0000021000000000UL, 0x0000001800000000UL, 0x0000421800000000UL, 0x0000401000000000UL,
+                0x0008401800000000UL, 0x0008000000000000UL, 0x0008000800000000UL, 0x0008420000000000UL,
+                0x0008020000000000UL, 0x0008400800000000UL, 0x0008400000000000UL, 0x0008021800000000UL,
+                0x0008420800000000UL, 0x0008421000000000UL, 0x0008001000000000UL, 0x0008020800000000UL,
+                0x0008021000000000UL, 0x0008001800000000UL, 0x0008421800000000UL, 0x0008401000000000UL,
+                0x4200401800000000UL, 0x4200000000000000UL, 0x4200000800000000UL, 0x4200420000000000UL,
+                0x4200020000000000UL, 0x4200400800000000UL, 0x4200400000000000UL, 0x4200021800000000UL,
+                0x4200420800000000UL, 0x4200421000000000UL, 0x4200001000000000UL, 0x4200020800000000UL,
+                0x4200021000000000UL, 0x4200001800000000UL, 0x4200421800000000UL, 0x4200401000000000UL,
+                0x0200401800000000UL, 0x0200000000000000UL, 0x0200000800000000UL, 0x0200420000000000UL,
+                0x0200020000000000UL, 0x0200400800000000UL, 0x0200400000000000UL, 0x0200021800000000UL,
+                0x0200420800000000UL, 0x0200421000000000UL, 0x0200001000000000UL, 0x0200020800000000UL,
+                0x0200021000000000UL, 0x0200001800000000UL, 0x0200421800000000UL, 0x0200401000000000UL,
+                0x4008401800000000UL, 0x4008000000000000UL, 0x4008000800000000UL, 0x4008420000000000UL,
+                0x4008020000000000UL, 0x4008400800000000UL, 0x4008400000000000UL, 0x4008021800000000UL,
+                0x4008420800000000UL, 0x4008421000000000UL, 0x4008001000000000UL, 0x4008020800000000UL,
+                0x4008021000000000UL, 0x4008001800000000UL, 0x4008421800000000UL, 0x4008401000000000UL,
+                0x4000401800000000UL, 0x4000000000000000UL, 0x4000000800000000UL, 0x4000420000000000UL,
+                0x4000020000000000UL, 0x4000400800000000UL, 0x4000400000000000UL, 0x4000021800000000UL,
+                0x4000420800000000UL, 0x4000421000000000UL, 0x4000001000000000UL, 0x4000020800000000UL,
+                0x4000021000000000UL, 0x4000001800000000UL, 0x4000421800000000UL, 0x4000401000000000UL,
+                0x0218401800000000UL, 0x0218000000000000UL, 0x0218000800000000UL, 0x0218420000000000UL,
+                0x0218020000000000UL, 0x0218400800000000UL, 0x0218400000000000UL, 0x0218021800000000UL,
+                0x0218420800000000UL, 0x0218421000000000UL, 0x0218001000000000UL, 0x0218020800000000UL,
+                0x0218021000000000UL, 0x0218001800000000UL, 0x0218421800000000UL, 0x0218401000000000UL,
+                0x4208401800000000UL, 0x4208000000000000UL, 0x4208000800000000UL, 0x4208420000000000UL,
+                0x4208020000000000UL, 0x4208400800000000UL, 0x4208400000000000UL, 0x4208021800000000UL,
+                0x4208420800000000UL, 0x4208421000000000UL, 0x4208001000000000UL, 0x4208020800000000UL,
+                0x4208021000000000UL, 0x4208001800000000UL, 0x4208421800000000UL, 0x4208401000000000UL,
+                0x4210401800000000UL, 0x4210000000000000UL, 0x4210000800000000UL, 0x4210420000000000UL,
+                0x4210020000000000UL, 0x4210400800000000UL, 0x4210400000000000UL, 0x4210021800000000UL,
+                0x4210420800000000UL, 0x4210421000000000UL, 0x4210001000000000UL, 0x4210020800000000UL,
+                0x4210021000000000UL, 0x4210001800000000UL, 0x4210421800000000UL, 0x4210401000000000UL,
+                0x0010401800000000UL, 0x0010000000000000UL, 0x0010000800000000UL, 0x0010420000000000UL,
+                0x0010020000000000UL, 0x0010400800000000UL, 0x0010400000000000UL, 0x0010021800000000UL,
+                0x0010420800000000UL, 0x0010421000000000UL, 0x0010001000000000UL, 0x0010020800000000UL,
+                0x0010021000000000UL, 0x0010001800000000UL, 0x0010421800000000UL, 0x0010401000000000UL,
+                0x0208401800000000UL, 0x0208000000000000UL, 0x0208000800000000UL, 0x0208420000000000UL,
+                0x0208020000000000UL, 0x0208400800000000UL, 0x0208400000000000UL, 0x0208021800000000UL,
+                0x0208420800000000UL, 0x0208421000000000UL, 0x0208001000000000UL, 0x0208020800000000UL,
+                0x0208021000000000UL, 0x0208001800000000UL, 0x0208421800000000UL, 0x0208401000000000UL,
+                0x0210401800000000UL, 0x0210000000000000UL, 0x0210000800000000UL, 0x0210420000000000UL,
+                0x0210020000000000UL, 0x0210400800000000UL, 0x0210400000000000UL, 0x0210021800000000UL,
+                0x0210420800000000UL, 0x0210421000000000UL, 0x0210001000000000UL, 0x0210020800000000UL,
+                0x0210021000000000UL, 0x0210001800000000UL, 0x0210421800000000UL, 0x0210401000000000UL,
+                0x0018401800000000UL, 0x0018000000000000UL, 0x0018000800000000UL, 0x0018420000000000UL,
+                0x0018020000000000UL, 0x0018400800000000UL, 0x0018400000000000UL, 0x0018021800000000UL,
+                0x0018420800000000UL, 0x0018421000000000UL, 0x0018001000000000UL, 0x0018020800000000UL,
+                0x0018021000000000UL, 0x0018001800000000UL, 0x0018421800000000UL, 0x0018401000000000UL,
+                0x4218401800000000UL, 0x4218000000000000UL, 0x4218000800000000UL, 0x4218420000000000UL,
+                0x4218020000000000UL, 0x4218400800000000UL, 0x4218400000000000UL, 0x4218021800000000UL,
+                0x4218420800000000UL, 0x4218421000000000UL, 0x4218001000000000UL, 0x4218020800000000UL,
+                0x4218021000000000UL, 0x4218001800000000UL, 0x4218421800000000UL, 0x4218401000000000UL,
+                0x4010401800000000UL, 0x4010000000000000UL, 0x4010000800000000UL, 0x4010420000000000UL,
+                0x4010020000000000UL, 0x4010400800000000UL, 0x4010400000000000UL, 0x4010021800000000UL,
+                0x4010420800000000UL, 0x4010421000000000UL, 0x4010001000000000UL, 0x4010020800000000UL,
+                0x4010021000000000UL, 0x4010001800000000UL, 0x4010421800000000UL, 0x4010401000000000UL,
+        },
+};
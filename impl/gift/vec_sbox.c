@@ -1,4 +1,4 @@
-#include <arm_neon.h>
+#include "../simd.h"
 #include <stdint.h>
 #include <stddef.h>
 
@@ -230,3 +230,123 @@ uint64_t gift_64_vec_sbox_decrypt(const uint64_t c,
         // unpack
         return gift_64_vec_sbox_bits_unpack(m);
 }
+
+// the permutation never moves a bit within its nibble, so bit j of output
+// nibble t is bit j of input nibble perm_64_tbl[j][t]
+static const uint8_t perm_64_tbl[4][16] = {
+        {  0,  4,  8, 12,  3,  7, 11, 15,  2,  6, 10, 14,  1,  5,  9, 13 },
+        {  1,  5,  9, 13,  0,  4,  8, 12,  3,  7, 11, 15,  2,  6, 10, 14 },
+        {  2,  6, 10, 14,  1,  5,  9, 13,  0,  4,  8, 12,  3,  7, 11, 15 },
+        {  3,  7, 11, 15,  2,  6, 10, 14,  1,  5,  9, 13,  0,  4,  8, 12 },
+};
+
+static const uint8_t perm_64_inv_tbl[4][16] = {
+        {  0, 12,  8,  4,  1, 13,  9,  5,  2, 14, 10,  6,  3, 15, 11,  7 },
+        {  4,  0, 12,  8,  5,  1, 13,  9,  6,  2, 14, 10,  7,  3, 15, 11 },
+        {  8,  4,  0, 12,  9,  5,  1, 13, 10,  6,  2, 14, 11,  7,  3, 15 },
+        { 12,  8,  4,  0, 13,  9,  5,  1, 14, 10,  6,  2, 15, 11,  7,  3 },
+};
+
+// same as gift_64_vec_sbox_permute(_inv) on n blocks, without leaving the
+// vector registers: one tbl per bit position, masked to that bit
+static inline void permute_xn(uint8x16_t s[restrict], const uint8_t tbl[restrict 4][16],
+                              const int n)
+{
+        uint8x16_t idx[4], mask[4];
+        for (int j = 0; j < 4; j++) {
+                idx[j] = vld1q_u8(tbl[j]);
+                mask[j] = vdupq_n_u8(1 << j);
+        }
+
+        for (int i = 0; i < n; i++) {
+                uint8x16_t t = vandq_u8(vqtbl1q_u8(s[i], idx[0]), mask[0]);
+                for (int j = 1; j < 4; j++) {
+                        t = vorrq_u8(t, vandq_u8(vqtbl1q_u8(s[i], idx[j]), mask[j]));
+                }
+                s[i] = t;
+        }
+}
+
+// n independent blocks go through the rounds together, so the dependency
+// chains of the single-block version overlap (n is constant per caller)
+static inline void encrypt_xn(uint64_t c[restrict], const uint64_t m[restrict],
+                              const uint8x16_t rks[restrict ROUNDS_GIFT_64], const int n)
+{
+        uint8x16_t s[8];
+        for (int i = 0; i < n; i++) {
+                s[i] = gift_64_vec_sbox_bits_pack(m[i]);
+        }
+
+        for (int round = 0; round < ROUNDS_GIFT_64; round++) {
+                for (int i = 0; i < n; i++) {
+                        s[i] = gift_64_vec_sbox_subcells(s[i]);
+                }
+                permute_xn(s, perm_64_tbl, n);
+                for (int i = 0; i < n; i++) {
+                        s[i] = veorq_u8(s[i], rks[round]);
+                }
+        }
+
+        for (int i = 0; i < n; i++) {
+                c[i] = gift_64_vec_sbox_bits_unpack(s[i]);
+        }
+}
+
+static inline void decrypt_xn(uint64_t m[restrict], const uint64_t c[restrict],
+                              const uint8x16_t rks[restrict ROUNDS_GIFT_64], const int n)
+{
+        uint8x16_t s[8];
+        for (int i = 0; i < n; i++) {
+                s[i] = gift_64_vec_sbox_bits_pack(c[i]);
+        }
+
+        for (int round = ROUNDS_GIFT_64 - 1; round >= 0; round--) {
+                for (int i = 0; i < n; i++) {
+                        s[i] = veorq_u8(s[i], rks[round]);
+                }
+                permute_xn(s, perm_64_inv_tbl, n);
+                for (int i = 0; i < n; i++) {
+                        s[i] = gift_64_vec_sbox_subcells_inv(s[i]);
+                }
+        }
+
+        for (int i = 0; i < n; i++) {
+                m[i] = gift_64_vec_sbox_bits_unpack(s[i]);
+        }
+}
+
+void gift_64_vec_sbox_encrypt_x2(uint64_t c[restrict 2], const uint64_t m[restrict 2],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64])
+{
+        encrypt_xn(c, m, rks, 2);
+}
+
+void gift_64_vec_sbox_encrypt_x4(uint64_t c[restrict 4], const uint64_t m[restrict 4],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64])
+{
+        encrypt_xn(c, m, rks, 4);
+}
+
+void gift_64_vec_sbox_encrypt_x8(uint64_t c[restrict 8], const uint64_t m[restrict 8],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64])
+{
+        encrypt_xn(c, m, rks, 8);
+}
+
+void gift_64_vec_sbox_decrypt_x2(uint64_t m[restrict 2], const uint64_t c[restrict 2],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64])
+{
+        decrypt_xn(m, c, rks, 2);
+}
+
+void gift_64_vec_sbox_decrypt_x4(uint64_t m[restrict 4], const uint64_t c[restrict 4],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64])
+{
+        decrypt_xn(m, c, rks, 4);
+}
+
+void gift_64_vec_sbox_decrypt_x8(uint64_t m[restrict 8], const uint64_t c[restrict 8],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64])
+{
+        decrypt_xn(m, c, rks, 8);
+}
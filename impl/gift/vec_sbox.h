@@ -1,6 +1,6 @@
 #pragma once
 
-#include <arm_neon.h>
+#include "../simd.h"
 #include <stdint.h>
 
 #define ROUNDS_GIFT_64 28
@@ -22,3 +22,17 @@ uint64_t gift_64_vec_sbox_encrypt(const uint64_t m,
                                   const uint8x16_t rks[restrict ROUNDS_GIFT_64]);
 uint64_t gift_64_vec_sbox_decrypt(const uint64_t c,
                                   const uint8x16_t rks[restrict ROUNDS_GIFT_64]);
+
+// 2, 4 and 8 independent blocks interleaved, for batches too small for vec_sliced
+void gift_64_vec_sbox_encrypt_x2(uint64_t c[restrict 2], const uint64_t m[restrict 2],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64]);
+void gift_64_vec_sbox_encrypt_x4(uint64_t c[restrict 4], const uint64_t m[restrict 4],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64]);
+void gift_64_vec_sbox_encrypt_x8(uint64_t c[restrict 8], const uint64_t m[restrict 8],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64]);
+void gift_64_vec_sbox_decrypt_x2(uint64_t m[restrict 2], const uint64_t c[restrict 2],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64]);
+void gift_64_vec_sbox_decrypt_x4(uint64_t m[restrict 4], const uint64_t c[restrict 4],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64]);
+void gift_64_vec_sbox_decrypt_x8(uint64_t m[restrict 8], const uint64_t c[restrict 8],
+                                 const uint8x16_t rks[restrict ROUNDS_GIFT_64]);
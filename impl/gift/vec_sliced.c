@@ -1,8 +1,10 @@
-#include <arm_neon.h>
+#include "../simd.h"
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "vec_sliced.h"
+#include "naive.h"
 
 static uint64_t pack_shf_u64[] = {
         0x1303120211011000UL, 0x1707160615051404UL, // S0/S1/S2/S3
@@ -38,6 +40,9 @@ static uint8x16_t pack_mask_0;
 static uint8x16_t pack_mask_1;
 static uint8x16_t pack_mask_2;
 
+// slice 3 of the round keys (single bit and round constants), key independent
+static uint8x16_t round_const_sliced[ROUNDS_GIFT_64];
+
 static const int round_const[] = {
         // rounds 0-15
         0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3E, 0x3D, 0x3B, 0x37, 0x2F, 0x1E, 0x3C, 0x39, 0x33, 0x27, 0x0E,
@@ -290,6 +295,55 @@ void gift_64_vec_sliced_generate_round_keys(uint8x16x4_t rks[restrict ROUNDS_GIF
         }
 }
 
+void gift_64_vec_sliced_pack_round_keys_multi(uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2],
+                                              const uint64_t *const round_keys[restrict 16])
+{
+        // the packing is a bit permutation, so packing the round keys of all
+        // blocks like a plaintext puts every key bit next to its state bit.
+        // key bits only use slices 0 and 1, the next round goes into slices 2
+        // and 3 so one packing covers two rounds
+        for (int round = 0; round < ROUNDS_GIFT_64; round += 2) {
+                uint64_t rk[16];
+                for (size_t block = 0; block < 16; block++) {
+                        rk[block]  = (round_keys[block][round] & 0x3333333333333333UL);
+                        rk[block] |= (round_keys[block][round + 1] & 0x3333333333333333UL) << 2;
+                }
+
+                uint8x16x4_t packed[2] = {
+                        vld1q_u8_x4((uint8_t*)&rk[0]), vld1q_u8_x4((uint8_t*)&rk[8])
+                };
+                gift_64_vec_sliced_bits_pack(packed);
+
+                for (int h = 0; h < 2; h++) {
+                        rks[round][h].val[0]     = packed[h].val[0];
+                        rks[round][h].val[1]     = packed[h].val[1];
+                        rks[round][h].val[2]     = vdupq_n_u8(0);
+                        rks[round + 1][h].val[0] = packed[h].val[2];
+                        rks[round + 1][h].val[1] = packed[h].val[3];
+                        rks[round + 1][h].val[2] = vdupq_n_u8(0);
+                }
+
+                // single bit and round constants are the same for every block
+                rks[round][0].val[3]     = round_const_sliced[round];
+                rks[round][1].val[3]     = round_const_sliced[round];
+                rks[round + 1][0].val[3] = round_const_sliced[round + 1];
+                rks[round + 1][1].val[3] = round_const_sliced[round + 1];
+        }
+}
+
+void gift_64_vec_sliced_generate_round_keys_multi(uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2],
+                                                  const uint64_t keys[restrict 16][2])
+{
+        uint64_t round_keys[16][ROUNDS_GIFT_64];
+        const uint64_t *round_keys_ptr[16];
+        for (size_t block = 0; block < 16; block++) {
+                gift_64_generate_round_keys(round_keys[block], keys[block]);
+                round_keys_ptr[block] = round_keys[block];
+        }
+
+        gift_64_vec_sliced_pack_round_keys_multi(rks, round_keys_ptr);
+}
+
 void gift_64_vec_sliced_init(void)
 {
         // bit packing shuffle
@@ -308,18 +362,23 @@ void gift_64_vec_sliced_init(void)
         pack_mask_0 = vdupq_n_u8(0x55);
         pack_mask_1 = vdupq_n_u8(0x33);
         pack_mask_2 = vdupq_n_u8(0x0f);
+
+        // sliced round constants for the multi-key schedule
+        for (int round = 0; round < ROUNDS_GIFT_64; round++) {
+                uint8_t rc_bytes[16] = { 0 };
+                for (size_t i = 0; i < 6; i++) {
+                        rc_bytes[i] = ((round_const[round] >> i) & 0x1) ? 0xff : 0x00;
+                }
+                rc_bytes[15] = 0xff;
+                round_const_sliced[round] = vld1q_u8(rc_bytes);
+        }
 }
 
-void gift_64_vec_sliced_encrypt(uint64_t c[restrict 16],
-                                const uint64_t m[restrict 16],
-                                const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+static inline void rounds(uint8x16x4_t s[restrict 2],
+                          const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2],
+                          const int start, const int end)
 {
-        uint8x16x4_t s[2];
-        s[0] = vld1q_u8_x4((uint8_t*)&m[0]);
-        s[1] = vld1q_u8_x4((uint8_t*)&m[8]);
-        gift_64_vec_sliced_bits_pack(s);
-
-        for (int round = 0; round < ROUNDS_GIFT_64; round++) {
+        for (int round = start; round < end; round++) {
                 gift_64_vec_sliced_subcells(s);
                 gift_64_vec_sliced_permute(s);
 
@@ -333,21 +392,24 @@ void gift_64_vec_sliced_encrypt(uint64_t c[restrict 16],
                 s[1].val[2] = veorq_u8(s[1].val[2], rks[round][1].val[2]);
                 s[1].val[3] = veorq_u8(s[1].val[3], rks[round][1].val[3]);
         }
+}
 
-        gift_64_vec_sliced_bits_unpack(s);
-        vst1q_u8_x4((uint8_t*)&c[0], s[0]);
-        vst1q_u8_x4((uint8_t*)&c[8], s[1]);
+void gift_64_vec_sliced_rounds(uint8x16x4_t s[restrict 2],
+                               const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
+        rounds(s, rks, 0, ROUNDS_GIFT_64);
 }
 
-void gift_64_vec_sliced_decrypt(uint64_t m[restrict 16],
-                                const uint64_t c[restrict 16],
-                                const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+void gift_64_vec_sliced_rounds_range(uint8x16x4_t s[restrict 2],
+                                     const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2],
+                                     const int start, const int end)
 {
-        uint8x16x4_t s[2];
-        s[0] = vld1q_u8_x4((uint8_t*)&c[0]);
-        s[1] = vld1q_u8_x4((uint8_t*)&c[8]);
-        gift_64_vec_sliced_bits_pack(s);
+        rounds(s, rks, start, end);
+}
 
+void gift_64_vec_sliced_rounds_inv(uint8x16x4_t s[restrict 2],
+                                   const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
         for (int round = ROUNDS_GIFT_64 - 1; round >= 0; round--) {
                 // round key addition
                 s[0].val[0] = veorq_u8(s[0].val[0], rks[round][0].val[0]);
@@ -362,8 +424,100 @@ void gift_64_vec_sliced_decrypt(uint64_t m[restrict 16],
                 gift_64_vec_sliced_permute_inv(s);
                 gift_64_vec_sliced_subcells_inv(s);
         }
+}
+
+void gift_64_vec_sliced_encrypt(uint64_t c[16],
+                                const uint64_t m[16],
+                                const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
+        uint8x16x4_t s[2];
+        s[0] = vld1q_u8_x4((uint8_t*)&m[0]);
+        s[1] = vld1q_u8_x4((uint8_t*)&m[8]);
+        gift_64_vec_sliced_bits_pack(s);
+
+        gift_64_vec_sliced_rounds(s, rks);
+
+        gift_64_vec_sliced_bits_unpack(s);
+        vst1q_u8_x4((uint8_t*)&c[0], s[0]);
+        vst1q_u8_x4((uint8_t*)&c[8], s[1]);
+}
+
+void gift_64_vec_sliced_encrypt_rounds(uint64_t c[16],
+                                       const uint64_t m[16],
+                                       const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2],
+                                       const int start, const int end)
+{
+        uint8x16x4_t s[2];
+        s[0] = vld1q_u8_x4((uint8_t*)&m[0]);
+        s[1] = vld1q_u8_x4((uint8_t*)&m[8]);
+        gift_64_vec_sliced_bits_pack(s);
+
+        rounds(s, rks, start, end);
+
+        gift_64_vec_sliced_bits_unpack(s);
+        vst1q_u8_x4((uint8_t*)&c[0], s[0]);
+        vst1q_u8_x4((uint8_t*)&c[8], s[1]);
+}
+
+void gift_64_vec_sliced_decrypt(uint64_t m[16],
+                                const uint64_t c[16],
+                                const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
+        uint8x16x4_t s[2];
+        s[0] = vld1q_u8_x4((uint8_t*)&c[0]);
+        s[1] = vld1q_u8_x4((uint8_t*)&c[8]);
+        gift_64_vec_sliced_bits_pack(s);
+
+        gift_64_vec_sliced_rounds_inv(s, rks);
 
         gift_64_vec_sliced_bits_unpack(s);
         vst1q_u8_x4((uint8_t*)&m[0], s[0]);
         vst1q_u8_x4((uint8_t*)&m[8], s[1]);
 }
+
+// blocks 2i and 2i+1 go into the low and high half of register i
+static inline void load_strided(uint8x16x4_t s[restrict 2], const uint8_t *m, const size_t stride)
+{
+        for (size_t i = 0; i < 8; i++) {
+                uint64_t lo, hi;
+                memcpy(&lo, m + (2 * i + 0) * stride, 8);
+                memcpy(&hi, m + (2 * i + 1) * stride, 8);
+                s[i / 4].val[i % 4] = vsetq_lane_u64(hi, vdupq_n_u64(lo), 1);
+        }
+}
+
+static inline void store_strided(uint8_t *c, const size_t stride, const uint8x16x4_t s[restrict 2])
+{
+        for (size_t i = 0; i < 8; i++) {
+                const uint64_t lo = vgetq_lane_u64(s[i / 4].val[i % 4], 0);
+                const uint64_t hi = vgetq_lane_u64(s[i / 4].val[i % 4], 1);
+                memcpy(c + (2 * i + 0) * stride, &lo, 8);
+                memcpy(c + (2 * i + 1) * stride, &hi, 8);
+        }
+}
+
+void gift_64_vec_sliced_encrypt_strided(uint8_t *c, const uint8_t *m, const size_t stride,
+                                        const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
+        uint8x16x4_t s[2];
+        load_strided(s, m, stride);
+        gift_64_vec_sliced_bits_pack(s);
+
+        gift_64_vec_sliced_rounds(s, rks);
+
+        gift_64_vec_sliced_bits_unpack(s);
+        store_strided(c, stride, s);
+}
+
+void gift_64_vec_sliced_decrypt_strided(uint8_t *m, const uint8_t *c, const size_t stride,
+                                        const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
+        uint8x16x4_t s[2];
+        load_strided(s, c, stride);
+        gift_64_vec_sliced_bits_pack(s);
+
+        gift_64_vec_sliced_rounds_inv(s, rks);
+
+        gift_64_vec_sliced_bits_unpack(s);
+        store_strided(m, stride, s);
+}
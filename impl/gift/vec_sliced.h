@@ -1,7 +1,8 @@
 #pragma once
 
 #include <stdint.h>
-#include <arm_neon.h>
+#include <stddef.h>
+#include "../simd.h"
 
 #define ROUNDS_GIFT_64 28
 
@@ -19,12 +20,43 @@ void gift_64_vec_sliced_permute(uint8x16x4_t cipher_state[restrict 2]);
 void gift_64_vec_sliced_permute_inv(uint8x16x4_t cipher_state[2]);
 void gift_64_vec_sliced_generate_round_keys(uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2],
                                             const uint64_t key[restrict 2]);
+// keys[i] is used for block i of gift_64_vec_sliced_encrypt/decrypt, the pack
+// variant takes schedules from gift_64_generate_round_keys that the caller
+// keeps around (e.g. one per session) and only transposes them
+void gift_64_vec_sliced_pack_round_keys_multi(uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2],
+                                              const uint64_t *const round_keys[restrict 16]);
+void gift_64_vec_sliced_generate_round_keys_multi(uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2],
+                                                  const uint64_t keys[restrict 16][2]);
 
 void gift_64_vec_sliced_init(void);
 
-void gift_64_vec_sliced_encrypt(uint64_t c[restrict 16],
-                                const uint64_t m[restrict 16],
+// round loop on an already packed state (used by the modes of operation)
+void gift_64_vec_sliced_rounds(uint8x16x4_t s[restrict 2],
+                               const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
+void gift_64_vec_sliced_rounds_inv(uint8x16x4_t s[restrict 2],
+                                   const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
+// rounds start to end - 1 only (with rks[start] to rks[end - 1] of the full
+// schedule), for reduced-round analysis; [a, b) followed by [b, c) is [a, c)
+void gift_64_vec_sliced_rounds_range(uint8x16x4_t s[restrict 2],
+                                     const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2],
+                                     int start, int end);
+
+// c may equal m, all blocks are loaded before the first one is stored
+void gift_64_vec_sliced_encrypt(uint64_t c[16],
+                                const uint64_t m[16],
                                 const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
-void gift_64_vec_sliced_decrypt(uint64_t m[restrict 16],
-                                const uint64_t c[restrict 16],
+// rounds start to end - 1, see gift_64_vec_sliced_rounds_range
+void gift_64_vec_sliced_encrypt_rounds(uint64_t c[16],
+                                       const uint64_t m[16],
+                                       const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2],
+                                       int start, int end);
+void gift_64_vec_sliced_decrypt(uint64_t m[16],
+                                const uint64_t c[16],
                                 const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
+
+// block i at m + i * stride (c + i * stride) with no alignment needed, so
+// blocks can be encrypted inside larger records; c may equal m as well
+void gift_64_vec_sliced_encrypt_strided(uint8_t *c, const uint8_t *m, size_t stride,
+                                        const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
+void gift_64_vec_sliced_decrypt_strided(uint8_t *m, const uint8_t *c, size_t stride,
+                                        const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
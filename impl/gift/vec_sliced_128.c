@@ -0,0 +1,268 @@
+#include "../simd.h"
+#include <stdint.h>
+#include <stddef.h>
+
+#include "vec_sliced_128.h"
+#include "vec_sliced.h" // packing and S-box circuit are shared with GIFT-64
+#include "naive.h"      // need the naive key schedule
+
+// generated by scripts/gen_permute_128_sliced.py, one pair of vqtbl2q_u8
+// indices (nibbles 0-15, nibbles 16-31) per S-box bit
+static uint64_t perm_u64[] = {
+        0x1c1814100c080400UL, 0x1f1b17130f0b0703UL, // bit 0
+        0x1e1a16120e0a0602UL, 0x1d1915110d090501UL,
+        0x1d1915110d090501UL, 0x1c1814100c080400UL, // bit 1
+        0x1f1b17130f0b0703UL, 0x1e1a16120e0a0602UL,
+        0x1e1a16120e0a0602UL, 0x1d1915110d090501UL, // bit 2
+        0x1c1814100c080400UL, 0x1f1b17130f0b0703UL,
+        0x1f1b17130f0b0703UL, 0x1e1a16120e0a0602UL, // bit 3
+        0x1d1915110d090501UL, 0x1c1814100c080400UL,
+};
+
+static uint64_t perm_inv_u64[] = {
+        0x0911190108101800UL, 0x0b131b030a121a02UL, // bit 0
+        0x0d151d050c141c04UL, 0x0f171f070e161e06UL,
+        0x1119010910180008UL, 0x131b030b121a020aUL, // bit 1
+        0x151d050d141c040cUL, 0x171f070f161e060eUL,
+        0x1901091118000810UL, 0x1b030b131a020a12UL, // bit 2
+        0x1d050d151c040c14UL, 0x1f070f171e060e16UL,
+        0x0109111900081018UL, 0x030b131b020a121aUL, // bit 3
+        0x050d151d040c141cUL, 0x070f171f060e161eUL,
+};
+
+static uint8x16x2_t perm[4];
+static uint8x16x2_t perm_inv[4];
+
+// state layout:
+// s[0]: nibbles 0-15 of blocks 0, 2, ..., 14
+// s[1]: nibbles 0-15 of blocks 1, 3, ..., 15
+// s[2]: nibbles 16-31 of blocks 0, 2, ..., 14
+// s[3]: nibbles 16-31 of blocks 1, 3, ..., 15
+// b[q].val[k] holds block 4q + k on entry
+static inline void pack_blocks(uint8x16x4_t s[restrict 4], const uint8x16x4_t b[restrict 4])
+{
+        // split blocks into their lower and upper 64-bit halves
+        for (size_t i = 0; i < 2; i++) {
+                const uint8x16x4_t b0 = b[2 * i + 0];
+                const uint8x16x4_t b1 = b[2 * i + 1];
+
+                s[i + 0].val[0] = vzip1q_u64(b0.val[0], b0.val[1]);
+                s[i + 0].val[1] = vzip1q_u64(b0.val[2], b0.val[3]);
+                s[i + 0].val[2] = vzip1q_u64(b1.val[0], b1.val[1]);
+                s[i + 0].val[3] = vzip1q_u64(b1.val[2], b1.val[3]);
+
+                s[i + 2].val[0] = vzip2q_u64(b0.val[0], b0.val[1]);
+                s[i + 2].val[1] = vzip2q_u64(b0.val[2], b0.val[3]);
+                s[i + 2].val[2] = vzip2q_u64(b1.val[0], b1.val[1]);
+                s[i + 2].val[3] = vzip2q_u64(b1.val[2], b1.val[3]);
+        }
+
+        // each half is packed exactly like a GIFT-64 block
+        gift_64_vec_sliced_bits_pack(&s[0]);
+        gift_64_vec_sliced_bits_pack(&s[2]);
+}
+
+// b[q].val[k] holds block 4q + k on return
+static inline void unpack_blocks(uint8x16x4_t b[restrict 4], uint8x16x4_t s[restrict 4])
+{
+        gift_64_vec_sliced_bits_unpack(&s[0]);
+        gift_64_vec_sliced_bits_unpack(&s[2]);
+
+        for (size_t i = 0; i < 2; i++) {
+                uint8x16x4_t *b0 = &b[2 * i + 0], *b1 = &b[2 * i + 1];
+
+                b0->val[0] = vzip1q_u64(s[i].val[0], s[i + 2].val[0]);
+                b0->val[1] = vzip2q_u64(s[i].val[0], s[i + 2].val[0]);
+                b0->val[2] = vzip1q_u64(s[i].val[1], s[i + 2].val[1]);
+                b0->val[3] = vzip2q_u64(s[i].val[1], s[i + 2].val[1]);
+                b1->val[0] = vzip1q_u64(s[i].val[2], s[i + 2].val[2]);
+                b1->val[1] = vzip2q_u64(s[i].val[2], s[i + 2].val[2]);
+                b1->val[2] = vzip1q_u64(s[i].val[3], s[i + 2].val[3]);
+                b1->val[3] = vzip2q_u64(s[i].val[3], s[i + 2].val[3]);
+        }
+}
+
+void gift_128_vec_sliced_bits_pack(uint8x16x4_t s[restrict 4],
+                                   const uint8_t m[restrict 16][16])
+{
+        uint8x16x4_t b[4];
+        for (size_t q = 0; q < 4; q++) {
+                b[q] = vld1q_u8_x4(&m[4 * q][0]);
+        }
+        pack_blocks(s, b);
+}
+
+void gift_128_vec_sliced_bits_unpack(uint8_t m[restrict 16][16],
+                                     uint8x16x4_t s[restrict 4])
+{
+        uint8x16x4_t b[4];
+        unpack_blocks(b, s);
+        for (size_t q = 0; q < 4; q++) {
+                vst1q_u8_x4(&m[4 * q][0], b[q]);
+        }
+}
+
+void gift_128_vec_sliced_subcells(uint8x16x4_t cs[restrict 4])
+{
+        gift_64_vec_sliced_subcells(&cs[0]);
+        gift_64_vec_sliced_subcells(&cs[2]);
+}
+
+void gift_128_vec_sliced_subcells_inv(uint8x16x4_t cs[restrict 4])
+{
+        gift_64_vec_sliced_subcells_inv(&cs[0]);
+        gift_64_vec_sliced_subcells_inv(&cs[2]);
+}
+
+void gift_128_vec_sliced_permute(uint8x16x4_t cs[restrict 4])
+{
+        for (size_t i = 0; i < 2; i++) {
+                for (size_t j = 0; j < 4; j++) {
+                        const uint8x16x2_t nibbles = {
+                                .val = { cs[i].val[j], cs[i + 2].val[j] }
+                        };
+
+                        cs[i + 0].val[j] = vqtbl2q_u8(nibbles, perm[j].val[0]);
+                        cs[i + 2].val[j] = vqtbl2q_u8(nibbles, perm[j].val[1]);
+                }
+        }
+}
+
+void gift_128_vec_sliced_permute_inv(uint8x16x4_t cs[restrict 4])
+{
+        for (size_t i = 0; i < 2; i++) {
+                for (size_t j = 0; j < 4; j++) {
+                        const uint8x16x2_t nibbles = {
+                                .val = { cs[i].val[j], cs[i + 2].val[j] }
+                        };
+
+                        cs[i + 0].val[j] = vqtbl2q_u8(nibbles, perm_inv[j].val[0]);
+                        cs[i + 2].val[j] = vqtbl2q_u8(nibbles, perm_inv[j].val[1]);
+                }
+        }
+}
+
+void gift_128_vec_sliced_generate_round_keys(uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2],
+                                             const uint64_t key[restrict 2])
+{
+        // use standard key derivation (one round key bit per nibble bit)
+        uint8_t rks_naive[ROUNDS_GIFT_128][32];
+        gift_128_generate_round_keys(rks_naive, key);
+
+        // extend bits to bytes (bit 0 stays unused)
+        for (int round = 0; round < ROUNDS_GIFT_128; round++) {
+                for (size_t half = 0; half < 2; half++) {
+                        for (size_t j = 0; j < 4; j++) {
+                                uint8_t bytes[16];
+                                for (size_t n = 0; n < 16; n++) {
+                                        const int bit = (rks_naive[round][half * 16 + n] >> j) & 0x1;
+                                        bytes[n] = -bit;
+                                }
+
+                                rks[round][half].val[j] = vld1q_u8(bytes);
+                        }
+                }
+        }
+}
+
+void gift_128_vec_sliced_init(void)
+{
+        // packing masks and shuffles
+        gift_64_vec_sliced_init();
+
+        // permutations
+        for (size_t j = 0; j < 4; j++) {
+                perm[j] = vld1q_u8_x2((uint8_t*)&perm_u64[j * 4]);
+                perm_inv[j] = vld1q_u8_x2((uint8_t*)&perm_inv_u64[j * 4]);
+        }
+}
+
+static inline void rounds(uint8x16x4_t s[restrict 4],
+                          const uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2])
+{
+        for (int round = 0; round < ROUNDS_GIFT_128; round++) {
+                gift_128_vec_sliced_subcells(s);
+                gift_128_vec_sliced_permute(s);
+
+                // round key addition (bit 0 has no key bits)
+                for (size_t j = 1; j < 4; j++) {
+                        s[0].val[j] = veorq_u8(s[0].val[j], rks[round][0].val[j]);
+                        s[1].val[j] = veorq_u8(s[1].val[j], rks[round][0].val[j]);
+                        s[2].val[j] = veorq_u8(s[2].val[j], rks[round][1].val[j]);
+                        s[3].val[j] = veorq_u8(s[3].val[j], rks[round][1].val[j]);
+                }
+        }
+}
+
+static inline void rounds_inv(uint8x16x4_t s[restrict 4],
+                              const uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2])
+{
+        for (int round = ROUNDS_GIFT_128 - 1; round >= 0; round--) {
+                // round key addition (bit 0 has no key bits)
+                for (size_t j = 1; j < 4; j++) {
+                        s[0].val[j] = veorq_u8(s[0].val[j], rks[round][0].val[j]);
+                        s[1].val[j] = veorq_u8(s[1].val[j], rks[round][0].val[j]);
+                        s[2].val[j] = veorq_u8(s[2].val[j], rks[round][1].val[j]);
+                        s[3].val[j] = veorq_u8(s[3].val[j], rks[round][1].val[j]);
+                }
+
+                gift_128_vec_sliced_permute_inv(s);
+                gift_128_vec_sliced_subcells_inv(s);
+        }
+}
+
+void gift_128_vec_sliced_encrypt(uint8_t c[16][16],
+                                 const uint8_t m[16][16],
+                                 const uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2])
+{
+        uint8x16x4_t s[4];
+        gift_128_vec_sliced_bits_pack(s, m);
+        rounds(s, rks);
+        gift_128_vec_sliced_bits_unpack(c, s);
+}
+
+void gift_128_vec_sliced_decrypt(uint8_t m[16][16],
+                                 const uint8_t c[16][16],
+                                 const uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2])
+{
+        uint8x16x4_t s[4];
+        gift_128_vec_sliced_bits_pack(s, c);
+        rounds_inv(s, rks);
+        gift_128_vec_sliced_bits_unpack(m, s);
+}
+
+static inline void load_strided(uint8x16x4_t s[restrict 4], const uint8_t *m, const size_t stride)
+{
+        uint8x16x4_t b[4];
+        for (size_t i = 0; i < 16; i++) {
+                b[i / 4].val[i % 4] = vld1q_u8(m + i * stride);
+        }
+        pack_blocks(s, b);
+}
+
+static inline void store_strided(uint8_t *c, const size_t stride, uint8x16x4_t s[restrict 4])
+{
+        uint8x16x4_t b[4];
+        unpack_blocks(b, s);
+        for (size_t i = 0; i < 16; i++) {
+                vst1q_u8(c + i * stride, b[i / 4].val[i % 4]);
+        }
+}
+
+void gift_128_vec_sliced_encrypt_strided(uint8_t *c, const uint8_t *m, const size_t stride,
+                                         const uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2])
+{
+        uint8x16x4_t s[4];
+        load_strided(s, m, stride);
+        rounds(s, rks);
+        store_strided(c, stride, s);
+}
+
+void gift_128_vec_sliced_decrypt_strided(uint8_t *m, const uint8_t *c, const size_t stride,
+                                         const uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2])
+{
+        uint8x16x4_t s[4];
+        load_strided(s, c, stride);
+        rounds_inv(s, rks);
+        store_strided(m, stride, s);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+// 128-bit bitsliced GIFT with 16 blocks encrypted in parallel; the layout is
+// that of vec_sliced.h, once for nibbles 0-15 and once for nibbles 16-31
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../simd.h"
+
+#define ROUNDS_GIFT_128 40
+
+// expose for benchmarking
+void gift_128_vec_sliced_bits_pack(uint8x16x4_t s[restrict 4],
+                                   const uint8_t m[restrict 16][16]);
+void gift_128_vec_sliced_bits_unpack(uint8_t m[restrict 16][16],
+                                     uint8x16x4_t s[restrict 4]);
+
+void gift_128_vec_sliced_subcells(uint8x16x4_t cipher_state[restrict 4]);
+void gift_128_vec_sliced_subcells_inv(uint8x16x4_t cipher_state[restrict 4]);
+void gift_128_vec_sliced_permute(uint8x16x4_t cipher_state[restrict 4]);
+void gift_128_vec_sliced_permute_inv(uint8x16x4_t cipher_state[restrict 4]);
+void gift_128_vec_sliced_generate_round_keys(uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2],
+                                             const uint64_t key[restrict 2]);
+
+void gift_128_vec_sliced_init(void);
+
+// c may equal m, all blocks are loaded before the first one is stored
+void gift_128_vec_sliced_encrypt(uint8_t c[16][16],
+                                 const uint8_t m[16][16],
+                                 const uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2]);
+void gift_128_vec_sliced_decrypt(uint8_t m[16][16],
+                                 const uint8_t c[16][16],
+                                 const uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2]);
+
+// block i at m + i * stride (c + i * stride) with no alignment needed, so
+// blocks can be encrypted inside larger records; c may equal m as well
+void gift_128_vec_sliced_encrypt_strided(uint8_t *c, const uint8_t *m, size_t stride,
+                                         const uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2]);
+void gift_128_vec_sliced_decrypt_strided(uint8_t *m, const uint8_t *c, size_t stride,
+                                         const uint8x16x4_t rks[restrict ROUNDS_GIFT_128][2]);
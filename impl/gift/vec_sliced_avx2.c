@@ -0,0 +1,216 @@
+#include <stdint.h>
+#include <stddef.h>
+
+#include "vec_sliced_avx2.h"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+// same tables as vec_sliced.c
+static const uint64_t pack_shf_u64[] = {
+        0x1303120211011000UL, 0x1707160615051404UL, // S0/S1/S2/S3
+        0x1b0b1a0a19091808UL, 0x1f0f1e0e1d0d1c0cUL, // S4/S5/S6/S7
+};
+
+static const uint64_t pack_shf_inv_u64[] = {
+        0x0e0c0a0806040200UL, 0x1e1c1a1816141210UL, // S0/S1/S2/S3
+        0x0f0d0b0907050301UL, 0x1f1d1b1917151311UL, // S4/S5/S6/S7
+};
+
+static const uint64_t perm_u64[] = {
+        0x0f0b07030c080400UL, 0x0d0905010e0a0602UL, // S0/S4
+        0x0c0804000d090501UL, 0x0e0a06020f0b0703UL, // S1/S5
+        0x0d0905010e0a0602UL, 0x0f0b07030c080400UL, // S2/S6
+        0x0e0a06020f0b0703UL, 0x0c0804000d090501UL  // S3/S7
+};
+
+static const uint64_t perm_inv_u64[] = {
+        0x05090d0104080c00UL, 0x070b0f03060a0e02UL, // S0/S4
+        0x090d0105080c0004UL, 0x0b0f03070a0e0206UL, // S1/S5
+        0x0d0105090c000408UL, 0x0f03070b0e02060aUL, // S2/S6
+        0x0105090d0004080cUL, 0x03070b0f02060a0eUL  // S3/S7
+};
+
+// a two-register tbl becomes two pshufb, one per source register
+// ([k][0] picks from the first, [k][1] from the second register)
+static __m256i pack_shf[2][2];
+static __m256i pack_shf_inv[2][2];
+static __m256i perm[4];
+static __m256i perm_inv[4];
+
+static __m256i pack_mask_0;
+static __m256i pack_mask_1;
+static __m256i pack_mask_2;
+
+// the masks clear every bit that would cross a byte boundary, so the
+// shifts need not carry between the 64-bit lanes as in vec_sliced.c
+#define swapmove(a, b, m, n)                                                \
+{                                                                           \
+        const __m256i _t = _mm256_and_si256(                                \
+                _mm256_xor_si256(_mm256_srli_epi64(a, n), b), m);           \
+        b = _mm256_xor_si256(b, _t);                                        \
+        a = _mm256_xor_si256(a, _mm256_slli_epi64(_t, n));                  \
+}
+
+static inline __m256i tbl2(const __m256i a, const __m256i b, const __m256i idx[2])
+{
+        return _mm256_or_si256(_mm256_shuffle_epi8(a, idx[0]),
+                               _mm256_shuffle_epi8(b, idx[1]));
+}
+
+static void bits_swapmove(__m256i s[restrict 2][4])
+{
+        swapmove(s[0][0], s[0][1], pack_mask_0, 1);
+        swapmove(s[0][2], s[0][3], pack_mask_0, 1);
+        swapmove(s[1][0], s[1][1], pack_mask_0, 1);
+        swapmove(s[1][2], s[1][3], pack_mask_0, 1);
+
+        swapmove(s[0][0], s[0][2], pack_mask_1, 2);
+        swapmove(s[0][1], s[0][3], pack_mask_1, 2);
+        swapmove(s[1][0], s[1][2], pack_mask_1, 2);
+        swapmove(s[1][1], s[1][3], pack_mask_1, 2);
+
+        swapmove(s[0][0], s[1][0], pack_mask_2, 4);
+        swapmove(s[0][2], s[1][2], pack_mask_2, 4);
+        swapmove(s[0][1], s[1][1], pack_mask_2, 4);
+        swapmove(s[0][3], s[1][3], pack_mask_2, 4);
+}
+
+static void bits_pack(__m256i s[restrict 2][4], const uint64_t m[restrict 32])
+{
+        for (size_t i = 0; i < 2; i++) {
+                for (size_t j = 0; j < 4; j++) {
+                        s[i][j] = _mm256_loadu_si256((const __m256i*)&m[(i * 4 + j) * 4]);
+                }
+        }
+
+        bits_swapmove(s);
+
+        for (size_t j = 0; j < 4; j++) {
+                const __m256i a = s[0][j];
+                const __m256i b = s[1][j];
+                s[0][j] = tbl2(a, b, pack_shf[0]);
+                s[1][j] = tbl2(a, b, pack_shf[1]);
+        }
+}
+
+static void bits_unpack(uint64_t m[restrict 32], __m256i s[restrict 2][4])
+{
+        for (size_t j = 0; j < 4; j++) {
+                const __m256i a = s[0][j];
+                const __m256i b = s[1][j];
+                s[0][j] = tbl2(a, b, pack_shf_inv[0]);
+                s[1][j] = tbl2(a, b, pack_shf_inv[1]);
+        }
+
+        bits_swapmove(s);
+
+        for (size_t i = 0; i < 2; i++) {
+                for (size_t j = 0; j < 4; j++) {
+                        _mm256_storeu_si256((__m256i*)&m[(i * 4 + j) * 4], s[i][j]);
+                }
+        }
+}
+
+static void subcells(__m256i s[restrict 4])
+{
+        s[1] = _mm256_xor_si256(s[1], _mm256_and_si256(s[0], s[2]));
+        const __m256i t = _mm256_xor_si256(s[0], _mm256_and_si256(s[1], s[3]));
+        s[2] = _mm256_xor_si256(s[2], _mm256_or_si256(t, s[1]));
+        s[0] = _mm256_xor_si256(s[3], s[2]);
+        s[1] = _mm256_xor_si256(s[1], s[0]);
+        s[0] = _mm256_xor_si256(s[0], _mm256_set1_epi8(-1));
+        s[2] = _mm256_xor_si256(s[2], _mm256_and_si256(t, s[1]));
+        s[3] = t;
+}
+
+static void subcells_inv(__m256i s[restrict 4])
+{
+        const __m256i t = s[3];
+        s[2] = _mm256_xor_si256(s[2], _mm256_and_si256(t, s[1]));
+        s[0] = _mm256_xor_si256(s[0], _mm256_set1_epi8(-1));
+        s[1] = _mm256_xor_si256(s[1], s[0]);
+        s[3] = _mm256_xor_si256(s[0], s[2]);
+        s[2] = _mm256_xor_si256(s[2], _mm256_or_si256(t, s[1]));
+        s[0] = _mm256_xor_si256(t, _mm256_and_si256(s[1], s[3]));
+        s[1] = _mm256_xor_si256(s[1], _mm256_and_si256(s[0], s[2]));
+}
+
+static inline __m256i round_key(const uint8x16_t rk)
+{
+        return _mm256_broadcastsi128_si256(rk);
+}
+
+void gift_64_vec_sliced_avx2_init(void)
+{
+        for (size_t k = 0; k < 2; k++) {
+                const __m256i shf = _mm256_broadcastsi128_si256(
+                        _mm_loadu_si128((const __m128i*)&pack_shf_u64[2 * k]));
+                const __m256i shf_inv = _mm256_broadcastsi128_si256(
+                        _mm_loadu_si128((const __m128i*)&pack_shf_inv_u64[2 * k]));
+
+                // out of range indices have bit 7 set, pshufb clears those
+                const __m256i lo = _mm256_set1_epi8(0x70);
+                const __m256i hi = _mm256_set1_epi8(16);
+                pack_shf[k][0] = _mm256_adds_epu8(shf, lo);
+                pack_shf[k][1] = _mm256_adds_epu8(_mm256_sub_epi8(shf, hi), lo);
+                pack_shf_inv[k][0] = _mm256_adds_epu8(shf_inv, lo);
+                pack_shf_inv[k][1] = _mm256_adds_epu8(_mm256_sub_epi8(shf_inv, hi), lo);
+        }
+
+        for (size_t j = 0; j < 4; j++) {
+                perm[j] = _mm256_broadcastsi128_si256(
+                        _mm_loadu_si128((const __m128i*)&perm_u64[2 * j]));
+                perm_inv[j] = _mm256_broadcastsi128_si256(
+                        _mm_loadu_si128((const __m128i*)&perm_inv_u64[2 * j]));
+        }
+
+        pack_mask_0 = _mm256_set1_epi8(0x55);
+        pack_mask_1 = _mm256_set1_epi8(0x33);
+        pack_mask_2 = _mm256_set1_epi8(0x0f);
+}
+
+void gift_64_vec_sliced_avx2_encrypt(uint64_t c[32],
+                                     const uint64_t m[32],
+                                     const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
+        __m256i s[2][4];
+        bits_pack(s, m);
+
+        for (int round = 0; round < ROUNDS_GIFT_64; round++) {
+                for (size_t i = 0; i < 2; i++) {
+                        subcells(s[i]);
+
+                        for (size_t j = 0; j < 4; j++) {
+                                s[i][j] = _mm256_shuffle_epi8(s[i][j], perm[j]);
+                                s[i][j] = _mm256_xor_si256(s[i][j], round_key(rks[round][i].val[j]));
+                        }
+                }
+        }
+
+        bits_unpack(c, s);
+}
+
+void gift_64_vec_sliced_avx2_decrypt(uint64_t m[32],
+                                     const uint64_t c[32],
+                                     const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
+        __m256i s[2][4];
+        bits_pack(s, c);
+
+        for (int round = ROUNDS_GIFT_64 - 1; round >= 0; round--) {
+                for (size_t i = 0; i < 2; i++) {
+                        for (size_t j = 0; j < 4; j++) {
+                                s[i][j] = _mm256_xor_si256(s[i][j], round_key(rks[round][i].val[j]));
+                                s[i][j] = _mm256_shuffle_epi8(s[i][j], perm_inv[j]);
+                        }
+
+                        subcells_inv(s[i]);
+                }
+        }
+
+        bits_unpack(m, s);
+}
+
+#endif
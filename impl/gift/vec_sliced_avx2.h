@@ -0,0 +1,23 @@
+#pragma once
+
+// 64-bit bitsliced GIFT with 32 blocks encrypted in parallel on AVX2; each
+// 128-bit lane runs the vec_sliced.c algorithm on 16 blocks of its own, so
+// the round keys of gift_64_vec_sliced_generate_round_keys are reused
+
+#include <stdint.h>
+
+#include "vec_sliced.h"
+
+#ifdef __AVX2__
+
+void gift_64_vec_sliced_avx2_init(void);
+
+// c may equal m, all blocks are loaded before the first one is stored
+void gift_64_vec_sliced_avx2_encrypt(uint64_t c[32],
+                                     const uint64_t m[32],
+                                     const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
+void gift_64_vec_sliced_avx2_decrypt(uint64_t m[32],
+                                     const uint64_t c[32],
+                                     const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
+
+#endif
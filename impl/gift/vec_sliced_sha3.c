@@ -0,0 +1,155 @@
+#include <stdint.h>
+#include <stddef.h>
+
+#include "vec_sliced_sha3.h"
+
+#ifdef __ARM_FEATURE_SHA3
+
+// same tables as vec_sliced.c
+static const uint64_t perm_u64[] = {
+        0x0f0b07030c080400UL, 0x0d0905010e0a0602UL, // S0/S4
+        0x0c0804000d090501UL, 0x0e0a06020f0b0703UL, // S1/S5
+        0x0d0905010e0a0602UL, 0x0f0b07030c080400UL, // S2/S6
+        0x0e0a06020f0b0703UL, 0x0c0804000d090501UL  // S3/S7
+};
+
+static const uint64_t perm_inv_u64[] = {
+        0x05090d0104080c00UL, 0x070b0f03060a0e02UL, // S0/S4
+        0x090d0105080c0004UL, 0x0b0f03070a0e0206UL, // S1/S5
+        0x0d0105090c000408UL, 0x0f03070b0e02060aUL, // S2/S6
+        0x0105090d0004080cUL, 0x03070b0f02060a0eUL  // S3/S7
+};
+
+static uint8x16x4_t perm;
+static uint8x16x4_t perm_inv;
+
+void gift_64_vec_sliced_sha3_init(void)
+{
+        perm = vld1q_u8_x4((const uint8_t*)perm_u64);
+        perm_inv = vld1q_u8_x4((const uint8_t*)perm_inv_u64);
+}
+
+// gift_64_vec_sliced_subcells with x2 and x3 passed in complemented and x1
+// returned complemented (vbcaxq_u8(a, b, c) = a ^ (b & ~c)):
+//   x1 ^= x0 & x2          x1 = bcax(x1, x0, ~x2)
+//   t   = x0 ^ (x1 & x3)   t  = bcax(x0, x1, ~x3)
+//   x2 ^= t | x1           x2 = eor3(~x2, t | x1, ones)
+//   x0  = ~(x3 ^ x2)       x0 = ~x3 ^ x2
+//   x1 ^= x3 ^ x2          ~x1 = x1 ^ x0
+//   x2 ^= t & x1           x2 = bcax(x2, t, ~x1)
+static inline void subcells(uint8x16x4_t *restrict x, const uint8x16_t ones)
+{
+        const uint8x16_t x1 = vbcaxq_u8(x->val[1], x->val[0], x->val[2]);
+        const uint8x16_t t  = vbcaxq_u8(x->val[0], x1, x->val[3]);
+        const uint8x16_t x2 = veor3q_u8(x->val[2], vorrq_u8(t, x1), ones);
+        x->val[0] = veorq_u8(x->val[3], x2);
+        x->val[1] = veorq_u8(x1, x->val[0]);
+        x->val[2] = vbcaxq_u8(x2, t, x->val[1]);
+        x->val[3] = t;
+}
+
+// gift_64_vec_sliced_subcells_inv with x3 passed in complemented and all
+// four slices returned complemented:
+//   x2 ^= t & x1           x2  = bcax(x2, x1, ~t)     (t = x3)
+//   x1 ^= ~x0              x1  = eor3(x1, x0, ones)
+//   x3  = ~x0 ^ x2         ~x3 = x0 ^ x2
+//   x2 ^= t | x1           ~x2 = bcax(x2, ~t, x1)
+//   x0  = t ^ (x1 & x3)    ~x0 = bcax(~t, x1, ~x3)
+//   x1 ^= x0 & x2          ~x1 = x1 ^ (~x0 | ~x2)
+static inline void subcells_inv(uint8x16x4_t *restrict x, const uint8x16_t ones)
+{
+        const uint8x16_t nt = x->val[3]; // ~t = ~x3
+        const uint8x16_t x2 = vbcaxq_u8(x->val[2], x->val[1], nt);
+        const uint8x16_t x1 = veor3q_u8(x->val[1], x->val[0], ones);
+        x->val[3] = veorq_u8(x->val[0], x2);
+        x->val[2] = vbcaxq_u8(x2, nt, x1);
+        x->val[0] = vbcaxq_u8(nt, x1, x->val[3]);
+        x->val[1] = veorq_u8(x1, vorrq_u8(x->val[0], x->val[2]));
+}
+
+static inline void permute(uint8x16x4_t s[restrict 2], const uint8x16x4_t p)
+{
+        for (size_t i = 0; i < 8; i++) {
+                s[i / 4].val[i % 4] = vqtbl1q_u8(s[i / 4].val[i % 4], p.val[i % 4]);
+        }
+}
+
+// slice j is complemented by the key addition where flip[j] is set
+static inline void add_round_key(uint8x16x4_t s[restrict 2],
+                                 const uint8x16x4_t rk[restrict 2],
+                                 const int flip[4], const uint8x16_t ones)
+{
+        for (size_t i = 0; i < 8; i++) {
+                uint8x16_t *reg = &s[i / 4].val[i % 4];
+                const uint8x16_t k = rk[i / 4].val[i % 4];
+
+                *reg = flip[i % 4] ? veor3q_u8(*reg, k, ones) : veorq_u8(*reg, k);
+        }
+}
+
+static inline void complement(uint8x16x4_t s[restrict 2], const int flip[4])
+{
+        for (size_t i = 0; i < 8; i++) {
+                if (flip[i % 4]) {
+                        s[i / 4].val[i % 4] = vmvnq_u8(s[i / 4].val[i % 4]);
+                }
+        }
+}
+
+void gift_64_vec_sliced_sha3_encrypt(uint64_t c[16],
+                                     const uint64_t m[16],
+                                     const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
+        // subcells takes (x0, x1, ~x2, ~x3) and returns (x0, ~x1, x2, x3)
+        static const int in[4]   = { 0, 0, 1, 1 };
+        static const int flip[4] = { 0, 1, 1, 1 };
+        const uint8x16_t ones = vdupq_n_u8(0xff);
+
+        uint8x16x4_t s[2];
+        s[0] = vld1q_u8_x4((const uint8_t*)&m[0]);
+        s[1] = vld1q_u8_x4((const uint8_t*)&m[8]);
+        gift_64_vec_sliced_bits_pack(s);
+        complement(s, in);
+
+        for (int round = 0; round < ROUNDS_GIFT_64; round++) {
+                subcells(&s[0], ones);
+                subcells(&s[1], ones);
+                permute(s, perm);
+                add_round_key(s, rks[round], flip, ones);
+        }
+
+        complement(s, in);
+        gift_64_vec_sliced_bits_unpack(s);
+        vst1q_u8_x4((uint8_t*)&c[0], s[0]);
+        vst1q_u8_x4((uint8_t*)&c[8], s[1]);
+}
+
+void gift_64_vec_sliced_sha3_decrypt(uint64_t m[16],
+                                     const uint64_t c[16],
+                                     const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
+        // subcells_inv takes (x0, x1, x2, ~x3) and returns all complemented
+        static const int out[4]  = { 1, 1, 1, 1 };
+        static const int flip[4] = { 1, 1, 1, 0 };
+        const uint8x16_t ones = vdupq_n_u8(0xff);
+
+        uint8x16x4_t s[2];
+        s[0] = vld1q_u8_x4((const uint8_t*)&c[0]);
+        s[1] = vld1q_u8_x4((const uint8_t*)&c[8]);
+        gift_64_vec_sliced_bits_pack(s);
+        complement(s, out);
+
+        for (int round = ROUNDS_GIFT_64 - 1; round >= 0; round--) {
+                add_round_key(s, rks[round], flip, ones);
+                permute(s, perm_inv);
+                subcells_inv(&s[0], ones);
+                subcells_inv(&s[1], ones);
+        }
+
+        complement(s, out);
+        gift_64_vec_sliced_bits_unpack(s);
+        vst1q_u8_x4((uint8_t*)&m[0], s[0]);
+        vst1q_u8_x4((uint8_t*)&m[8], s[1]);
+}
+
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+
+// 64-bit bitsliced GIFT on 16 blocks like vec_sliced.c, with the S-box
+// circuit rewritten for the ARMv8.2 SHA3 instructions (EOR3, BCAX); same
+// round keys as gift_64_vec_sliced_generate_round_keys
+//
+// instructions per round (both directions, round key loads not counted):
+//
+//                 vec_sliced.c    vec_sliced_sha3.c
+//   subcells          22                14
+//   permute            8                 8
+//   key addition       8                 8
+//   total             38                30
+//
+// subcells goes from 11 to 7 per half because some slices are kept
+// complemented between rounds: the complement is undone (or applied) by the
+// EOR3 that adds the round key, which costs the same as the plain EOR
+
+#include <stdint.h>
+
+#include "vec_sliced.h"
+
+#ifdef __ARM_FEATURE_SHA3
+
+// after gift_64_vec_sliced_init (bit packing tables)
+void gift_64_vec_sliced_sha3_init(void);
+
+// c may equal m, all blocks are loaded before the first one is stored
+void gift_64_vec_sliced_sha3_encrypt(uint64_t c[16],
+                                     const uint64_t m[16],
+                                     const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
+void gift_64_vec_sliced_sha3_decrypt(uint64_t m[16],
+                                     const uint64_t c[16],
+                                     const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
+
+#endif
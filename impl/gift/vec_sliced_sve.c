@@ -0,0 +1,270 @@
+#include <stdint.h>
+#include <stddef.h>
+
+#include "vec_sliced_sve.h"
+
+#ifdef __ARM_FEATURE_SVE
+
+#include <arm_sve.h>
+
+// same tables as vec_sliced.c
+static const uint64_t pack_shf_u64[2][2] = {
+        { 0x1303120211011000UL, 0x1707160615051404UL }, // S0/S1/S2/S3
+        { 0x1b0b1a0a19091808UL, 0x1f0f1e0e1d0d1c0cUL }, // S4/S5/S6/S7
+};
+
+static const uint64_t pack_shf_inv_u64[2][2] = {
+        { 0x0e0c0a0806040200UL, 0x1e1c1a1816141210UL }, // S0/S1/S2/S3
+        { 0x0f0d0b0907050301UL, 0x1f1d1b1917151311UL }, // S4/S5/S6/S7
+};
+
+static const uint64_t perm_u64[4][2] = {
+        { 0x0f0b07030c080400UL, 0x0d0905010e0a0602UL }, // S0/S4
+        { 0x0c0804000d090501UL, 0x0e0a06020f0b0703UL }, // S1/S5
+        { 0x0d0905010e0a0602UL, 0x0f0b07030c080400UL }, // S2/S6
+        { 0x0e0a06020f0b0703UL, 0x0c0804000d090501UL }  // S3/S7
+};
+
+static const uint64_t perm_inv_u64[4][2] = {
+        { 0x05090d0104080c00UL, 0x070b0f03060a0e02UL }, // S0/S4
+        { 0x090d0105080c0004UL, 0x0b0f03070a0e0206UL }, // S1/S5
+        { 0x0d0105090c000408UL, 0x0f03070b0e02060aUL }, // S2/S6
+        { 0x0105090d0004080cUL, 0x03070b0f02060a0eUL }  // S3/S7
+};
+
+// sizeless SVE types cannot live in arrays, structs or globals, so the state
+// is eight named registers (s0-s3 and s4-s7 are s[0] and s[1] of
+// vec_sliced.c) and every constant is built from the tables above
+
+// tbl indices of vec_sliced.c address one 128-bit register, across a whole
+// vector they need the offset of their segment
+static inline svuint8_t segment_idx(const svuint8_t idx)
+{
+        const svbool_t pg = svptrue_b8();
+        return svadd_u8_x(pg, idx, svand_n_u8_x(pg, svindex_u8(0, 1), 0xf0));
+}
+
+static inline svuint8_t tbl(const svuint8_t a, const uint64_t table[2])
+{
+        const svbool_t pg = svptrue_b8();
+        return svtbl_u8(a, segment_idx(svld1rq_u8(pg, (const uint8_t*)table)));
+}
+
+// indices 16-31 pick from the second register
+static inline svuint8_t tbl2(const svuint8_t a, const svuint8_t b, const uint64_t table[2])
+{
+        const svbool_t pg = svptrue_b8();
+        const svuint8_t raw = svld1rq_u8(pg, (const uint8_t*)table);
+        const svuint8_t idx = segment_idx(svand_n_u8_x(pg, raw, 0x0f));
+
+        return svsel_u8(svcmplt_n_u8(pg, raw, 16), svtbl_u8(a, idx), svtbl_u8(b, idx));
+}
+
+// the masks clear every bit that would cross a byte boundary, so the
+// shifts need not carry between bytes as in vec_sliced.c
+#define swapmove(a, b, m, n)                                                \
+{                                                                           \
+        const svuint8_t _t = svand_n_u8_x(pg, sveor_u8_x(pg, svlsr_n_u8_x(pg, a, n), b), m); \
+        b = sveor_u8_x(pg, b, _t);                                          \
+        a = sveor_u8_x(pg, a, svlsl_n_u8_x(pg, _t, n));                     \
+}
+
+static inline void swapmoves(svuint8_t *restrict s0, svuint8_t *restrict s1,
+                             svuint8_t *restrict s2, svuint8_t *restrict s3,
+                             svuint8_t *restrict s4, svuint8_t *restrict s5,
+                             svuint8_t *restrict s6, svuint8_t *restrict s7)
+{
+        const svbool_t pg = svptrue_b8();
+
+        swapmove(*s0, *s1, 0x55, 1);
+        swapmove(*s2, *s3, 0x55, 1);
+        swapmove(*s4, *s5, 0x55, 1);
+        swapmove(*s6, *s7, 0x55, 1);
+
+        swapmove(*s0, *s2, 0x33, 2);
+        swapmove(*s1, *s3, 0x33, 2);
+        swapmove(*s4, *s6, 0x33, 2);
+        swapmove(*s5, *s7, 0x33, 2);
+
+        // make bytes (a0 b0 c0 d0 a4 b4 c4 d4 -> a0 b0 c0 d0 e0 f0 g0 h0)
+        swapmove(*s0, *s4, 0x0f, 4);
+        swapmove(*s2, *s6, 0x0f, 4);
+        swapmove(*s1, *s5, 0x0f, 4);
+        swapmove(*s3, *s7, 0x0f, 4);
+}
+
+// registers k and k + 4 form a pair
+static inline void shuffle_pair(svuint8_t *restrict a, svuint8_t *restrict b,
+                                const uint64_t table[2][2])
+{
+        const svuint8_t a_0 = *a;
+        *a = tbl2(a_0, *b, table[0]);
+        *b = tbl2(a_0, *b, table[1]);
+}
+
+static inline void subcells(svuint8_t *restrict x0, svuint8_t *restrict x1,
+                            svuint8_t *restrict x2, svuint8_t *restrict x3)
+{
+        const svbool_t pg = svptrue_b8();
+
+        *x1 = sveor_u8_x(pg, *x1, svand_u8_x(pg, *x0, *x2));
+        const svuint8_t t = sveor_u8_x(pg, *x0, svand_u8_x(pg, *x1, *x3));
+        *x2 = sveor_u8_x(pg, *x2, svorr_u8_x(pg, t, *x1));
+        *x0 = sveor_u8_x(pg, *x3, *x2);
+        *x1 = sveor_u8_x(pg, *x1, *x0);
+        *x0 = svnot_u8_x(pg, *x0);
+        *x2 = sveor_u8_x(pg, *x2, svand_u8_x(pg, t, *x1));
+        *x3 = t;
+}
+
+static inline void subcells_inv(svuint8_t *restrict x0, svuint8_t *restrict x1,
+                                svuint8_t *restrict x2, svuint8_t *restrict x3)
+{
+        const svbool_t pg = svptrue_b8();
+
+        const svuint8_t t = *x3;
+        *x2 = sveor_u8_x(pg, *x2, svand_u8_x(pg, t, *x1));
+        *x0 = svnot_u8_x(pg, *x0);
+        *x1 = sveor_u8_x(pg, *x1, *x0);
+        *x3 = sveor_u8_x(pg, *x0, *x2);
+        *x2 = sveor_u8_x(pg, *x2, svorr_u8_x(pg, t, *x1));
+        *x0 = sveor_u8_x(pg, t, svand_u8_x(pg, *x1, *x3));
+        *x1 = sveor_u8_x(pg, *x1, svand_u8_x(pg, *x0, *x2));
+}
+
+// every segment gets the same 128-bit round key
+static inline svuint8_t round_key(const uint8x16_t *k)
+{
+        return svld1rq_u8(svptrue_b8(), (const uint8_t*)k);
+}
+
+size_t gift_64_vec_sliced_sve_blocks(void)
+{
+        return svcntb();
+}
+
+// register r holds blocks 2 * (r * segments + q) and the one after in segment
+// q; any assignment works as long as unpacking mirrors it, and this one makes
+// every load and store contiguous
+static inline void pack(svuint8_t *restrict s0, svuint8_t *restrict s1,
+                        svuint8_t *restrict s2, svuint8_t *restrict s3,
+                        svuint8_t *restrict s4, svuint8_t *restrict s5,
+                        svuint8_t *restrict s6, svuint8_t *restrict s7,
+                        const uint8_t *m)
+{
+        const svbool_t pg = svptrue_b8();
+        const size_t vl = svcntb();
+
+        *s0 = svld1_u8(pg, m + 0 * vl);
+        *s1 = svld1_u8(pg, m + 1 * vl);
+        *s2 = svld1_u8(pg, m + 2 * vl);
+        *s3 = svld1_u8(pg, m + 3 * vl);
+        *s4 = svld1_u8(pg, m + 4 * vl);
+        *s5 = svld1_u8(pg, m + 5 * vl);
+        *s6 = svld1_u8(pg, m + 6 * vl);
+        *s7 = svld1_u8(pg, m + 7 * vl);
+
+        swapmoves(s0, s1, s2, s3, s4, s5, s6, s7);
+
+        // same plaintext slice bits into same register
+        shuffle_pair(s0, s4, pack_shf_u64);
+        shuffle_pair(s1, s5, pack_shf_u64);
+        shuffle_pair(s2, s6, pack_shf_u64);
+        shuffle_pair(s3, s7, pack_shf_u64);
+}
+
+static inline void unpack(uint8_t *c,
+                          svuint8_t s0, svuint8_t s1, svuint8_t s2, svuint8_t s3,
+                          svuint8_t s4, svuint8_t s5, svuint8_t s6, svuint8_t s7)
+{
+        const svbool_t pg = svptrue_b8();
+        const size_t vl = svcntb();
+
+        shuffle_pair(&s0, &s4, pack_shf_inv_u64);
+        shuffle_pair(&s1, &s5, pack_shf_inv_u64);
+        shuffle_pair(&s2, &s6, pack_shf_inv_u64);
+        shuffle_pair(&s3, &s7, pack_shf_inv_u64);
+
+        swapmoves(&s0, &s1, &s2, &s3, &s4, &s5, &s6, &s7);
+
+        svst1_u8(pg, c + 0 * vl, s0);
+        svst1_u8(pg, c + 1 * vl, s1);
+        svst1_u8(pg, c + 2 * vl, s2);
+        svst1_u8(pg, c + 3 * vl, s3);
+        svst1_u8(pg, c + 4 * vl, s4);
+        svst1_u8(pg, c + 5 * vl, s5);
+        svst1_u8(pg, c + 6 * vl, s6);
+        svst1_u8(pg, c + 7 * vl, s7);
+}
+
+void gift_64_vec_sliced_sve_encrypt(uint64_t *c,
+                                    const uint64_t *m,
+                                    const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
+        const svbool_t pg = svptrue_b8();
+        svuint8_t s0, s1, s2, s3, s4, s5, s6, s7;
+        pack(&s0, &s1, &s2, &s3, &s4, &s5, &s6, &s7, (const uint8_t*)m);
+
+        for (int round = 0; round < ROUNDS_GIFT_64; round++) {
+                subcells(&s0, &s1, &s2, &s3);
+                subcells(&s4, &s5, &s6, &s7);
+
+                s0 = tbl(s0, perm_u64[0]);
+                s1 = tbl(s1, perm_u64[1]);
+                s2 = tbl(s2, perm_u64[2]);
+                s3 = tbl(s3, perm_u64[3]);
+                s4 = tbl(s4, perm_u64[0]);
+                s5 = tbl(s5, perm_u64[1]);
+                s6 = tbl(s6, perm_u64[2]);
+                s7 = tbl(s7, perm_u64[3]);
+
+                // round key addition
+                s0 = sveor_u8_x(pg, s0, round_key(&rks[round][0].val[0]));
+                s1 = sveor_u8_x(pg, s1, round_key(&rks[round][0].val[1]));
+                s2 = sveor_u8_x(pg, s2, round_key(&rks[round][0].val[2]));
+                s3 = sveor_u8_x(pg, s3, round_key(&rks[round][0].val[3]));
+                s4 = sveor_u8_x(pg, s4, round_key(&rks[round][1].val[0]));
+                s5 = sveor_u8_x(pg, s5, round_key(&rks[round][1].val[1]));
+                s6 = sveor_u8_x(pg, s6, round_key(&rks[round][1].val[2]));
+                s7 = sveor_u8_x(pg, s7, round_key(&rks[round][1].val[3]));
+        }
+
+        unpack((uint8_t*)c, s0, s1, s2, s3, s4, s5, s6, s7);
+}
+
+void gift_64_vec_sliced_sve_decrypt(uint64_t *m,
+                                    const uint64_t *c,
+                                    const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2])
+{
+        const svbool_t pg = svptrue_b8();
+        svuint8_t s0, s1, s2, s3, s4, s5, s6, s7;
+        pack(&s0, &s1, &s2, &s3, &s4, &s5, &s6, &s7, (const uint8_t*)c);
+
+        for (int round = ROUNDS_GIFT_64 - 1; round >= 0; round--) {
+                // round key addition
+                s0 = sveor_u8_x(pg, s0, round_key(&rks[round][0].val[0]));
+                s1 = sveor_u8_x(pg, s1, round_key(&rks[round][0].val[1]));
+                s2 = sveor_u8_x(pg, s2, round_key(&rks[round][0].val[2]));
+                s3 = sveor_u8_x(pg, s3, round_key(&rks[round][0].val[3]));
+                s4 = sveor_u8_x(pg, s4, round_key(&rks[round][1].val[0]));
+                s5 = sveor_u8_x(pg, s5, round_key(&rks[round][1].val[1]));
+                s6 = sveor_u8_x(pg, s6, round_key(&rks[round][1].val[2]));
+                s7 = sveor_u8_x(pg, s7, round_key(&rks[round][1].val[3]));
+
+                s0 = tbl(s0, perm_inv_u64[0]);
+                s1 = tbl(s1, perm_inv_u64[1]);
+                s2 = tbl(s2, perm_inv_u64[2]);
+                s3 = tbl(s3, perm_inv_u64[3]);
+                s4 = tbl(s4, perm_inv_u64[0]);
+                s5 = tbl(s5, perm_inv_u64[1]);
+                s6 = tbl(s6, perm_inv_u64[2]);
+                s7 = tbl(s7, perm_inv_u64[3]);
+
+                subcells_inv(&s0, &s1, &s2, &s3);
+                subcells_inv(&s4, &s5, &s6, &s7);
+        }
+
+        unpack((uint8_t*)m, s0, s1, s2, s3, s4, s5, s6, s7);
+}
+
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+// 64-bit bitsliced GIFT on SVE with the batch scaled to the vector length;
+// each 128-bit segment runs the vec_sliced.c algorithm on 16 blocks of its
+// own, so the round keys of gift_64_vec_sliced_generate_round_keys are reused
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "vec_sliced.h"
+
+#ifdef __ARM_FEATURE_SVE
+
+// blocks per call on this core (svcntb(), 16 per 128 bits of vector)
+size_t gift_64_vec_sliced_sve_blocks(void);
+
+// c and m hold gift_64_vec_sliced_sve_blocks() blocks, c may equal m
+void gift_64_vec_sliced_sve_encrypt(uint64_t *c,
+                                    const uint64_t *m,
+                                    const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
+void gift_64_vec_sliced_sve_decrypt(uint64_t *m,
+                                    const uint64_t *c,
+                                    const uint8x16x4_t rks[restrict ROUNDS_GIFT_64][2]);
+
+#endif
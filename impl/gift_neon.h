@@ -0,0 +1,17 @@
+#pragma once
+
+// hand-scheduled AArch64 version of gift_64_vec_sliced_encrypt/_decrypt
+// (gift_neon.S), encrypts two batches of 16 blocks (c[0..15], c[16..31])
+// per call, c and m may be the same buffer
+
+#include <stdint.h>
+#include "gift/vec_sliced.h"
+
+#if defined(__aarch64__)
+void gift_64_neon_encrypt(uint64_t c[32],
+                          const uint64_t m[32],
+                          const uint8x16x4_t rks[ROUNDS_GIFT_64][2]);
+void gift_64_neon_decrypt(uint64_t m[32],
+                          const uint64_t c[32],
+                          const uint8x16x4_t rks[ROUNDS_GIFT_64][2]);
+#endif
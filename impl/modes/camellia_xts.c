@@ -0,0 +1,203 @@
+#include "../simd.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "camellia_xts.h"
+#include "../camellia/spec_opt.h"
+#include "../camellia/bytesliced.h"
+
+// the kernels take a block as two native 64-bit words, the standard as 16
+// bytes with the high word first
+static const uint8_t bswap_64_idx[16] = {
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8
+};
+
+// multiplication by alpha folds the bit shifted out of lane 1 back in as
+// 0x87 and carries the one out of lane 0 into lane 1, both through one tbl
+static const uint8_t fold_idx[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0 };
+static const uint8_t fold_tbl[16] = { 0x00, 0x87, 0x00, 0x01 };
+
+static const uint64_t lane_0_mask[2] = { 0xffffffffffffffffUL, 0x0UL };
+
+static uint64_t load_be64(const uint8_t b[8])
+{
+        uint64_t x = 0;
+        for (size_t i = 0; i < 8; i++) {
+                x = (x << 8) | b[i];
+        }
+        return x;
+}
+
+static void store_be64(uint8_t b[8], uint64_t x)
+{
+        for (size_t i = 0; i < 8; i++) {
+                b[i] = x >> (56 - 8 * i);
+        }
+}
+
+// t * alpha in GF(2^128), t as the little-endian 128-bit integer of IEEE 1619
+static inline uint8x16_t mul_alpha(const uint8x16_t t)
+{
+        const uint64x2_t carry = vshrq_n_u64(t, 63);
+        const uint8x16_t idx = vorrq_u8(vextq_u64(carry, carry, 1), vld1q_u8(fold_idx));
+        return veorq_u8(vshlq_n_u64(t, 1), vqtbl1q_u8(vld1q_u8(fold_tbl), idx));
+}
+
+// t * alpha^16: the 16 bits shifted out of lane 1 are multiplied by 0x87
+// (carryless, at most 23 bits) into lane 0, the ones out of lane 0 move on
+// to lane 1; unlike 16 doublings there is no dependency between the tweaks
+// of a batch
+static inline uint8x16_t mul_alpha_16(const uint8x16_t t)
+{
+        const uint64x2_t top = vshrq_n_u64(t, 48);
+        const uint64x2_t h = vextq_u64(top, top, 1);
+        const uint64x2_t h_0 = vandq_u8(h, vld1q_u64(lane_0_mask));
+
+        uint64x2_t r = veorq_u8(vshlq_n_u64(t, 16), h);
+        r = veorq_u8(r, vshlq_n_u64(h_0, 1));
+        r = veorq_u8(r, vshlq_n_u64(h_0, 2));
+        return veorq_u8(r, vshlq_n_u64(h_0, 7));
+}
+
+// one block through spec_opt, out may equal in
+static void block_xcrypt(const struct camellia_rks_128 *restrict rks,
+                         uint8_t out[16], const uint8_t in[16], const int decrypt)
+{
+        const uint64_t m[2] = { load_be64(&in[0]), load_be64(&in[8]) };
+        uint64_t c[2];
+        if (decrypt) {
+                camellia_spec_opt_decrypt_128(c, m, rks);
+        } else {
+                camellia_spec_opt_encrypt_128(c, m, rks);
+        }
+        store_be64(&out[0], c[0]);
+        store_be64(&out[8], c[1]);
+}
+
+static void block_xts(const struct camellia_rks_128 *restrict rks,
+                      uint8_t out[restrict 16], const uint8_t in[restrict 16],
+                      const uint8x16_t t, const int decrypt)
+{
+        uint8_t x[16];
+        vst1q_u8(x, veorq_u8(vld1q_u8(in), t));
+        block_xcrypt(rks, x, x, decrypt);
+        vst1q_u8(out, veorq_u8(vld1q_u8(x), t));
+}
+
+// nblocks <= 16 blocks with tweaks t[0..nblocks-1] through one sliced call
+static void batch_xts(const struct camellia_xts_ctx_128 *restrict ctx,
+                      uint8_t *out, const uint8_t *in, const uint8x16_t t[restrict 16],
+                      const size_t nblocks, const int decrypt)
+{
+        const struct camellia_rks_sliced_128 *rks = &ctx->rks_sliced;
+        const uint8x16_t bswap_64 = vld1q_u8(bswap_64_idx);
+
+        uint8_t batch[16][16];
+        if (nblocks < 16) {
+                memset(batch, 0, sizeof(batch));
+        }
+
+        for (size_t i = 0; i < nblocks; i++) {
+                const uint8x16_t x = veorq_u8(vld1q_u8(in + 16 * i), t[i]);
+                vst1q_u8(batch[i], vqtbl1q_u8(x, bswap_64));
+        }
+
+        if (decrypt) {
+                camellia_sliced_decrypt_128_strided(batch[0], batch[0], 16, rks);
+        } else {
+                camellia_sliced_encrypt_128_strided(batch[0], batch[0], 16, rks);
+        }
+
+        for (size_t i = 0; i < nblocks; i++) {
+                const uint8x16_t x = vqtbl1q_u8(vld1q_u8(batch[i]), bswap_64);
+                vst1q_u8(out + 16 * i, veorq_u8(x, t[i]));
+        }
+}
+
+static int camellia_xts_xcrypt_128(const struct camellia_xts_ctx_128 *restrict ctx,
+                                   uint8_t *out, const uint8_t *in, size_t len,
+                                   const uint64_t sector, const int decrypt)
+{
+        // no block to steal from
+        if (len < 16) {
+                return -1;
+        }
+
+        // t[i] is the tweak of block i of the current batch
+        uint8x16_t t[16];
+        uint8_t t_0[16] = { 0 };
+        for (size_t i = 0; i < 8; i++) {
+                t_0[i] = sector >> (8 * i);
+        }
+        block_xcrypt(&ctx->rks_tweak, t_0, t_0, 0);
+
+        t[0] = vld1q_u8(t_0);
+        for (size_t i = 1; i < 16; i++) {
+                t[i] = mul_alpha(t[i - 1]);
+        }
+
+        // with a partial last block, the last full one is left for ciphertext
+        // stealing
+        const size_t tail = len % 16;
+        size_t nblocks = len / 16 - (tail ? 1 : 0);
+
+        for (; nblocks >= 16; nblocks -= 16, in += 256, out += 256) {
+                batch_xts(ctx, out, in, t, 16, decrypt);
+                for (size_t i = 0; i < 16; i++) {
+                        t[i] = mul_alpha_16(t[i]);
+                }
+        }
+
+        if (nblocks > 0) {
+                batch_xts(ctx, out, in, t, nblocks, decrypt);
+                in += 16 * nblocks;
+                out += 16 * nblocks;
+        }
+
+        if (tail == 0) {
+                return 0;
+        }
+
+        // the last full block (tweak t_a) and the partial one (tweak t_b);
+        // decryption undoes the second block encryption first
+        const uint8x16_t t_a = t[nblocks];
+        const uint8x16_t t_b = mul_alpha(t_a);
+
+        uint8_t x[16], partial[16];
+        memcpy(partial, in + 16, tail);
+        block_xts(&ctx->rks, x, in, decrypt ? t_b : t_a, decrypt);
+
+        // the partial block is padded with the tail of x, which in turn
+        // becomes the partial output block
+        memcpy(out + 16, x, tail);
+        memcpy(partial + tail, x + tail, 16 - tail);
+        block_xts(&ctx->rks, out, partial, decrypt ? t_a : t_b, decrypt);
+        return 0;
+}
+
+void camellia_xts_init_128(struct camellia_xts_ctx_128 *restrict ctx,
+                           const uint8_t key[restrict 32])
+{
+        const uint64_t key_1[2] = { load_be64(&key[0]), load_be64(&key[8]) };
+        const uint64_t key_2[2] = { load_be64(&key[16]), load_be64(&key[24]) };
+
+        camellia_sliced_init();
+        camellia_spec_opt_generate_round_keys_128(&ctx->rks, key_1);
+        camellia_spec_opt_generate_round_keys_128(&ctx->rks_tweak, key_2);
+        camellia_sliced_generate_round_keys_128(&ctx->rks_sliced, key_1);
+}
+
+int camellia_xts_encrypt_128(const struct camellia_xts_ctx_128 *restrict ctx,
+                             uint8_t *out, const uint8_t *in, size_t len,
+                             uint64_t sector)
+{
+        return camellia_xts_xcrypt_128(ctx, out, in, len, sector, 0);
+}
+
+int camellia_xts_decrypt_128(const struct camellia_xts_ctx_128 *restrict ctx,
+                             uint8_t *out, const uint8_t *in, size_t len,
+                             uint64_t sector)
+{
+        return camellia_xts_xcrypt_128(ctx, out, in, len, sector, 1);
+}
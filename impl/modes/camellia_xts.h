@@ -0,0 +1,32 @@
+#pragma once
+
+// 128-bit Camellia in XTS mode (IEEE 1619) for sector encryption: the blocks
+// of a sector go through the 16-block bytesliced kernel, the tweaks of a
+// batch are derived from those of the previous one with vector shifts, and
+// byte strings follow the standard (so blocks are big-endian for Camellia)
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../simd.h"
+
+#include "../camellia/camellia_keys.h"
+
+struct camellia_xts_ctx_128 {
+        struct camellia_rks_128 rks;       // ciphertext stealing (spec_opt)
+        struct camellia_rks_128 rks_tweak; // one block per sector (spec_opt)
+        struct camellia_rks_sliced_128 rks_sliced;
+};
+
+// key is Key1 (data) followed by Key2 (tweak), 16 bytes each
+void camellia_xts_init_128(struct camellia_xts_ctx_128 *restrict ctx,
+                           const uint8_t key[restrict 32]);
+
+// sector is the data unit sequence number, len is at least 16 (the last
+// partial block, if any, uses ciphertext stealing) and in == out is allowed;
+// returns 0, or -1 without touching out if len is below 16
+int camellia_xts_encrypt_128(const struct camellia_xts_ctx_128 *restrict ctx,
+                             uint8_t *out, const uint8_t *in, size_t len,
+                             uint64_t sector);
+int camellia_xts_decrypt_128(const struct camellia_xts_ctx_128 *restrict ctx,
+                             uint8_t *out, const uint8_t *in, size_t len,
+                             uint64_t sector);
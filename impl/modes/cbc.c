@@ -0,0 +1,192 @@
+#include "../simd.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "cbc.h"
+#include "../gift/table.h"
+#include "../gift/vec_sliced.h"
+#include "../camellia/spec_opt.h"
+#include "../camellia/bytesliced.h"
+
+void gift_64_cbc_init(struct gift_64_cbc_ctx *restrict ctx,
+                      const uint64_t key[restrict 2])
+{
+        gift_64_vec_sliced_init();
+        gift_64_table_generate_round_keys(ctx->rks_table, key);
+        gift_64_vec_sliced_generate_round_keys(ctx->rks, key);
+}
+
+void camellia_cbc_init_128(struct camellia_cbc_ctx_128 *restrict ctx,
+                           const uint64_t key[restrict 2])
+{
+        camellia_sliced_init();
+        camellia_spec_opt_generate_round_keys_128(&ctx->rks, key);
+        camellia_sliced_generate_round_keys_128(&ctx->rks_sliced, key);
+}
+
+void gift_64_cbc_encrypt(const struct gift_64_cbc_ctx *restrict ctx,
+                         uint8_t *out, const uint8_t *in, size_t len,
+                         uint8_t iv[restrict 8])
+{
+        uint64_t c;
+        memcpy(&c, iv, 8);
+
+        for (; len >= 8; len -= 8, in += 8, out += 8) {
+                uint64_t m;
+                memcpy(&m, in, 8);
+                c = gift_64_table_encrypt(m ^ c, ctx->rks_table);
+                memcpy(out, &c, 8);
+        }
+
+        memcpy(iv, &c, 8);
+}
+
+void gift_64_cbc_decrypt(const struct gift_64_cbc_ctx *restrict ctx,
+                         uint8_t *out, const uint8_t *in, size_t len,
+                         uint8_t iv[restrict 8])
+{
+        // prev[i] is the block chained into block i of a batch, taken before
+        // the batch is decrypted since out may be in
+        uint64_t prev[17];
+        memcpy(&prev[0], iv, 8);
+
+        for (; len >= 128; len -= 128, in += 128, out += 128) {
+                memcpy(&prev[1], in, 128);
+                gift_64_vec_sliced_decrypt_strided(out, in, 8, ctx->rks);
+
+                for (size_t i = 0; i < 16; i++) {
+                        uint64_t m;
+                        memcpy(&m, out + 8 * i, 8);
+                        m ^= prev[i];
+                        memcpy(out + 8 * i, &m, 8);
+                }
+                prev[0] = prev[16];
+        }
+
+        // tail: one more (padded) batch is still cheaper than up to 15
+        // blocks through the scalar kernels
+        if (len >= 8) {
+                uint64_t batch[16] = { 0 };
+                const size_t nblocks = len / 8;
+                memcpy(batch, in, nblocks * 8);
+                memcpy(&prev[1], in, nblocks * 8);
+                gift_64_vec_sliced_decrypt(batch, batch, ctx->rks);
+
+                for (size_t i = 0; i < nblocks; i++) {
+                        batch[i] ^= prev[i];
+                }
+                memcpy(out, batch, nblocks * 8);
+                prev[0] = prev[nblocks];
+        }
+
+        memcpy(iv, &prev[0], 8);
+}
+
+void gift_64_cbc_encrypt_x16(const struct gift_64_cbc_ctx *restrict ctx,
+                             uint8_t *const out[16], const uint8_t *const in[16], size_t len,
+                             uint8_t iv[restrict 16][8])
+{
+        // lane i chains stream i, so the batch always holds the previous
+        // ciphertext block of every stream
+        uint64_t batch[16];
+        memcpy(batch, iv, sizeof(batch));
+
+        for (size_t off = 0; off + 8 <= len; off += 8) {
+                for (size_t i = 0; i < 16; i++) {
+                        uint64_t m;
+                        memcpy(&m, in[i] + off, 8);
+                        batch[i] ^= m;
+                }
+
+                gift_64_vec_sliced_encrypt(batch, batch, ctx->rks);
+
+                for (size_t i = 0; i < 16; i++) {
+                        memcpy(out[i] + off, &batch[i], 8);
+                }
+        }
+
+        memcpy(iv, batch, sizeof(batch));
+}
+
+void camellia_cbc_encrypt_128(const struct camellia_cbc_ctx_128 *restrict ctx,
+                              uint8_t *out, const uint8_t *in, size_t len,
+                              uint8_t iv[restrict 16])
+{
+        uint64_t c[2];
+        memcpy(c, iv, 16);
+
+        for (; len >= 16; len -= 16, in += 16, out += 16) {
+                uint64_t m[2];
+                memcpy(m, in, 16);
+                m[0] ^= c[0];
+                m[1] ^= c[1];
+                camellia_spec_opt_encrypt_128(c, m, &ctx->rks);
+                memcpy(out, c, 16);
+        }
+
+        memcpy(iv, c, 16);
+}
+
+void camellia_cbc_decrypt_128(const struct camellia_cbc_ctx_128 *restrict ctx,
+                              uint8_t *out, const uint8_t *in, size_t len,
+                              uint8_t iv[restrict 16])
+{
+        const struct camellia_rks_sliced_128 *rks = &ctx->rks_sliced;
+
+        uint8x16_t prev[17];
+        prev[0] = vld1q_u8(iv);
+
+        for (; len >= 256; len -= 256, in += 256, out += 256) {
+                for (size_t i = 0; i < 16; i++) {
+                        prev[i + 1] = vld1q_u8(in + 16 * i);
+                }
+                camellia_sliced_decrypt_128_strided(out, in, 16, rks);
+
+                for (size_t i = 0; i < 16; i++) {
+                        vst1q_u8(out + 16 * i, veorq_u8(vld1q_u8(out + 16 * i), prev[i]));
+                }
+                prev[0] = prev[16];
+        }
+
+        if (len >= 16) {
+                uint8_t batch[16][16] = { { 0 } };
+                const size_t nblocks = len / 16;
+                memcpy(batch, in, nblocks * 16);
+                for (size_t i = 0; i < nblocks; i++) {
+                        prev[i + 1] = vld1q_u8(batch[i]);
+                }
+                camellia_sliced_decrypt_128_strided(batch[0], batch[0], 16, rks);
+
+                for (size_t i = 0; i < nblocks; i++) {
+                        vst1q_u8(out + 16 * i, veorq_u8(vld1q_u8(batch[i]), prev[i]));
+                }
+                prev[0] = prev[nblocks];
+        }
+
+        vst1q_u8(iv, prev[0]);
+}
+
+void camellia_cbc_encrypt_128_x16(const struct camellia_cbc_ctx_128 *restrict ctx,
+                                  uint8_t *const out[16], const uint8_t *const in[16],
+                                  size_t len, uint8_t iv[restrict 16][16])
+{
+        const struct camellia_rks_sliced_128 *rks = &ctx->rks_sliced;
+
+        uint8_t batch[16][16];
+        memcpy(batch, iv, sizeof(batch));
+
+        for (size_t off = 0; off + 16 <= len; off += 16) {
+                for (size_t i = 0; i < 16; i++) {
+                        vst1q_u8(batch[i], veorq_u8(vld1q_u8(batch[i]), vld1q_u8(in[i] + off)));
+                }
+
+                camellia_sliced_encrypt_128_strided(batch[0], batch[0], 16, rks);
+
+                for (size_t i = 0; i < 16; i++) {
+                        memcpy(out[i] + off, batch[i], 16);
+                }
+        }
+
+        memcpy(iv, batch, sizeof(batch));
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+// CBC for GIFT-64 and 128-bit Camellia: decryption is parallel and goes
+// through the 16-block sliced kernels, encryption of a single stream is
+// serial and stays on the scalar kernels, and 16 independent streams can be
+// encrypted together through one sliced call per block
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../simd.h"
+
+#include "../gift/vec_sliced.h"
+#include "../camellia/camellia_keys.h"
+
+struct gift_64_cbc_ctx {
+        uint64_t rks_table[ROUNDS_GIFT_64]; // single stream encryption
+        uint8x16x4_t rks[ROUNDS_GIFT_64][2];
+};
+
+struct camellia_cbc_ctx_128 {
+        struct camellia_rks_128 rks; // single stream encryption (spec_opt)
+        struct camellia_rks_sliced_128 rks_sliced;
+};
+
+// expands the key once (also constructs the kernel tables)
+void gift_64_cbc_init(struct gift_64_cbc_ctx *restrict ctx,
+                      const uint64_t key[restrict 2]);
+void camellia_cbc_init_128(struct camellia_cbc_ctx_128 *restrict ctx,
+                           const uint64_t key[restrict 2]);
+
+// len is a multiple of the block size (padding is up to the caller), in == out
+// is allowed and iv is replaced by the last ciphertext block, so a stream can
+// be continued with another call
+void gift_64_cbc_encrypt(const struct gift_64_cbc_ctx *restrict ctx,
+                         uint8_t *out, const uint8_t *in, size_t len,
+                         uint8_t iv[restrict 8]);
+void gift_64_cbc_decrypt(const struct gift_64_cbc_ctx *restrict ctx,
+                         uint8_t *out, const uint8_t *in, size_t len,
+                         uint8_t iv[restrict 8]);
+void camellia_cbc_encrypt_128(const struct camellia_cbc_ctx_128 *restrict ctx,
+                              uint8_t *out, const uint8_t *in, size_t len,
+                              uint8_t iv[restrict 16]);
+void camellia_cbc_decrypt_128(const struct camellia_cbc_ctx_128 *restrict ctx,
+                              uint8_t *out, const uint8_t *in, size_t len,
+                              uint8_t iv[restrict 16]);
+
+// stream i goes from in[i] to out[i] with iv[i], as if each one went through
+// its own *_cbc_encrypt call; all 16 streams are len bytes long
+void gift_64_cbc_encrypt_x16(const struct gift_64_cbc_ctx *restrict ctx,
+                             uint8_t *const out[16], const uint8_t *const in[16], size_t len,
+                             uint8_t iv[restrict 16][8]);
+void camellia_cbc_encrypt_128_x16(const struct camellia_cbc_ctx_128 *restrict ctx,
+                                  uint8_t *const out[16], const uint8_t *const in[16],
+                                  size_t len, uint8_t iv[restrict 16][16]);
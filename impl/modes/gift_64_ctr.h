@@ -0,0 +1,24 @@
+#pragma once
+
+// GIFT-64 in counter mode on top of the 16-block bitsliced kernel
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../simd.h"
+
+#include "../gift/vec_sliced.h"
+
+struct gift_64_ctr_ctx {
+        uint8x16x4_t rks[ROUNDS_GIFT_64][2];
+};
+
+// expands the key once (also constructs the vec_sliced tables)
+void gift_64_ctr_init(struct gift_64_ctr_ctx *restrict ctx,
+                      const uint64_t key[restrict 2]);
+
+// keystream block i is E(nonce + i) (mod 2^64), so keep the nonce in the
+// upper bits; encryption and decryption are the same operation, in == out
+// is allowed and only the last call of a stream may end on a partial block
+void gift_64_ctr_xcrypt(const struct gift_64_ctr_ctx *restrict ctx,
+                        uint8_t *out, const uint8_t *in, size_t len,
+                        uint64_t nonce);
@@ -0,0 +1,397 @@
+#include "../simd.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "parallel.h"
+#include "../camellia/bytesliced.h"
+
+// tiles taken by the owner at once; stealing splits whatever is left
+#define GRAIN 4
+
+struct parallel_job {
+        void (*tile)(const struct parallel_job *job, size_t tile);
+        void (*fn)(void *arg, int worker, size_t tile); // parallel_for
+        void *arg;
+        const void *rks;
+        uint8_t *out;
+        const uint8_t *in;
+        size_t len; // in blocks for ECB, in bytes for CTR
+        uint64_t nonce[2];
+};
+
+struct parallel_worker {
+        struct parallel_pool *pool;
+        pthread_t thread;
+        pthread_mutex_t lock;
+        size_t begin, end; // remaining tiles
+        int id;
+};
+
+struct parallel_pool {
+        int nthreads;
+        struct parallel_worker *workers;
+
+        pthread_mutex_t lock;
+        pthread_cond_t start, done;
+        uint64_t generation;
+        int busy;
+        int shutdown;
+        const struct parallel_job *job;
+};
+
+// take up to n tiles from the front of our own range
+static int take(struct parallel_worker *w, size_t *first, size_t *count, size_t n)
+{
+        pthread_mutex_lock(&w->lock);
+        *first = w->begin;
+        *count = w->end - w->begin < n ? w->end - w->begin : n;
+        w->begin += *count;
+        pthread_mutex_unlock(&w->lock);
+
+        return *count > 0;
+}
+
+// move the back half of a victim's range into our own (empty) range
+static int steal(struct parallel_worker *w)
+{
+        struct parallel_pool *pool = w->pool;
+
+        for (int i = 1; i < pool->nthreads; i++) {
+                struct parallel_worker *v = &pool->workers[(w->id + i) % pool->nthreads];
+
+                pthread_mutex_lock(&v->lock);
+                const size_t left = v->end - v->begin;
+                const size_t mid = v->begin + left / 2;
+                const size_t end = v->end;
+                if (left > 0) {
+                        // a single tile left is taken whole
+                        v->end = left == 1 ? v->begin : mid;
+                }
+                pthread_mutex_unlock(&v->lock);
+
+                if (left > 0) {
+                        pthread_mutex_lock(&w->lock);
+                        w->begin = left == 1 ? end - 1 : mid;
+                        w->end = end;
+                        pthread_mutex_unlock(&w->lock);
+                        return 1;
+                }
+        }
+
+        return 0;
+}
+
+static void work(struct parallel_worker *w, const struct parallel_job *job)
+{
+        size_t first, count;
+
+        do {
+                while (take(w, &first, &count, GRAIN)) {
+                        for (size_t t = first; t < first + count; t++) {
+                                if (job->fn != NULL) {
+                                        job->fn(job->arg, w->id, t);
+                                } else {
+                                        job->tile(job, t);
+                                }
+                        }
+                }
+        } while (steal(w));
+}
+
+static void *worker_main(void *arg)
+{
+        struct parallel_worker *w = arg;
+        struct parallel_pool *pool = w->pool;
+        uint64_t seen = 0;
+
+        for (;;) {
+                pthread_mutex_lock(&pool->lock);
+                while (pool->generation == seen && !pool->shutdown) {
+                        pthread_cond_wait(&pool->start, &pool->lock);
+                }
+                if (pool->shutdown) {
+                        pthread_mutex_unlock(&pool->lock);
+                        return NULL;
+                }
+                seen = pool->generation;
+                const struct parallel_job *job = pool->job;
+                pthread_mutex_unlock(&pool->lock);
+
+                work(w, job);
+
+                pthread_mutex_lock(&pool->lock);
+                if (--pool->busy == 0) {
+                        pthread_cond_signal(&pool->done);
+                }
+                pthread_mutex_unlock(&pool->lock);
+        }
+}
+
+// stop and join workers 1..started - 1, then release everything
+static void pool_free(struct parallel_pool *pool, int started)
+{
+        pthread_mutex_lock(&pool->lock);
+        pool->shutdown = 1;
+        pthread_cond_broadcast(&pool->start);
+        pthread_mutex_unlock(&pool->lock);
+
+        for (int i = 0; i < started; i++) {
+                if (i > 0) {
+                        pthread_join(pool->workers[i].thread, NULL);
+                }
+                pthread_mutex_destroy(&pool->workers[i].lock);
+        }
+
+        pthread_cond_destroy(&pool->done);
+        pthread_cond_destroy(&pool->start);
+        pthread_mutex_destroy(&pool->lock);
+        free(pool->workers);
+        free(pool);
+}
+
+struct parallel_pool *parallel_pool_create(int nthreads)
+{
+        struct parallel_pool *pool = calloc(1, sizeof(*pool));
+        if (pool == NULL) {
+                return NULL;
+        }
+        pool->nthreads = nthreads < 1 ? 1 : nthreads;
+        pool->workers = calloc(pool->nthreads, sizeof(*pool->workers));
+        if (pool->workers == NULL) {
+                free(pool);
+                return NULL;
+        }
+
+        pthread_mutex_init(&pool->lock, NULL);
+        pthread_cond_init(&pool->start, NULL);
+        pthread_cond_init(&pool->done, NULL);
+
+        for (int i = 0; i < pool->nthreads; i++) {
+                struct parallel_worker *w = &pool->workers[i];
+                w->pool = pool;
+                w->id = i;
+                pthread_mutex_init(&w->lock, NULL);
+                if (i > 0 && pthread_create(&w->thread, NULL, worker_main, w) != 0) {
+                        pthread_mutex_destroy(&w->lock);
+                        pool_free(pool, i);
+                        return NULL;
+                }
+        }
+
+        return pool;
+}
+
+void parallel_pool_destroy(struct parallel_pool *pool)
+{
+        pool_free(pool, pool->nthreads);
+}
+
+int parallel_pool_threads(const struct parallel_pool *pool)
+{
+        return pool->nthreads;
+}
+
+static void run(struct parallel_pool *pool, const struct parallel_job *job, size_t ntiles)
+{
+        if (ntiles == 0) {
+                return;
+        }
+
+        // equal initial shares, stealing corrects for unequal cores
+        for (int i = 0; i < pool->nthreads; i++) {
+                struct parallel_worker *w = &pool->workers[i];
+                pthread_mutex_lock(&w->lock);
+                w->begin = ntiles * i / pool->nthreads;
+                w->end = ntiles * (i + 1) / pool->nthreads;
+                pthread_mutex_unlock(&w->lock);
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        pool->job = job;
+        pool->busy = pool->nthreads - 1;
+        pool->generation++;
+        pthread_cond_broadcast(&pool->start);
+        pthread_mutex_unlock(&pool->lock);
+
+        work(&pool->workers[0], job);
+
+        pthread_mutex_lock(&pool->lock);
+        while (pool->busy > 0) {
+                pthread_cond_wait(&pool->done, &pool->lock);
+        }
+        pthread_mutex_unlock(&pool->lock);
+}
+
+void parallel_for(struct parallel_pool *pool, size_t ntiles,
+                  void (*fn)(void *arg, int worker, size_t tile), void *arg)
+{
+        const struct parallel_job job = { .fn = fn, .arg = arg };
+        run(pool, &job, ntiles);
+}
+
+static void gift_64_ecb_tile(const struct parallel_job *job, const int decrypt, size_t tile)
+{
+        const size_t n = job->len - tile * 16 < 16 ? job->len - tile * 16 : 16;
+        uint64_t *c = (uint64_t*)job->out + tile * 16;
+        const uint64_t *m = (const uint64_t*)job->in + tile * 16;
+        uint64_t m_tile[16] = { 0 }, c_tile[16];
+
+        // the last tile may be partial
+        if (n < 16) {
+                memcpy(m_tile, m, n * sizeof(uint64_t));
+                m = m_tile;
+        }
+
+        if (decrypt) {
+                gift_64_vec_sliced_decrypt(n < 16 ? c_tile : c, m, job->rks);
+        } else {
+                gift_64_vec_sliced_encrypt(n < 16 ? c_tile : c, m, job->rks);
+        }
+
+        if (n < 16) {
+                memcpy(c, c_tile, n * sizeof(uint64_t));
+        }
+}
+
+static void gift_64_ecb_encrypt_tile(const struct parallel_job *job, size_t tile)
+{
+        gift_64_ecb_tile(job, 0, tile);
+}
+
+static void gift_64_ecb_decrypt_tile(const struct parallel_job *job, size_t tile)
+{
+        gift_64_ecb_tile(job, 1, tile);
+}
+
+static void camellia_ecb_tile(const struct parallel_job *job, const int decrypt, size_t tile)
+{
+        const size_t n = job->len - tile * 16 < 16 ? job->len - tile * 16 : 16;
+        uint64_t (*c)[2] = (uint64_t(*)[2])job->out + tile * 16;
+        const uint64_t (*m)[2] = (const uint64_t(*)[2])job->in + tile * 16;
+        uint64_t m_tile[16][2] = { { 0 } }, c_tile[16][2];
+
+        const struct camellia_rks_sliced_128 *rks = job->rks;
+
+        if (n < 16) {
+                memcpy(m_tile, m, n * sizeof(m_tile[0]));
+                m = m_tile;
+        }
+
+        if (decrypt) {
+                camellia_sliced_decrypt_128(n < 16 ? c_tile : c, m, rks);
+        } else {
+                camellia_sliced_encrypt_128(n < 16 ? c_tile : c, m, rks);
+        }
+
+        if (n < 16) {
+                memcpy(c, c_tile, n * sizeof(c_tile[0]));
+        }
+}
+
+static void camellia_ecb_encrypt_tile(const struct parallel_job *job, size_t tile)
+{
+        camellia_ecb_tile(job, 0, tile);
+}
+
+static void camellia_ecb_decrypt_tile(const struct parallel_job *job, size_t tile)
+{
+        camellia_ecb_tile(job, 1, tile);
+}
+
+static void gift_64_ctr_tile(const struct parallel_job *job, size_t tile)
+{
+        const size_t off = tile * 128;
+        const size_t n = job->len - off < 128 ? job->len - off : 128;
+
+        gift_64_ctr_xcrypt(job->rks, job->out + off, job->in + off, n,
+                           job->nonce[0] + tile * 16);
+}
+
+static void camellia_ctr_tile(const struct parallel_job *job, size_t tile)
+{
+        const size_t off = tile * 256;
+        const size_t n = job->len - off < 256 ? job->len - off : 256;
+        const struct camellia_rks_sliced_128 *rks = job->rks;
+
+        uint64_t ctr[16][2], keystream[16][2];
+        for (size_t i = 0; i < 16; i++) {
+                ctr[i][0] = job->nonce[0];
+                ctr[i][1] = job->nonce[1] + tile * 16 + i;
+        }
+        camellia_sliced_encrypt_128(keystream, ctr, rks);
+
+        const uint8_t *ks = (const uint8_t*)keystream;
+        for (size_t i = 0; i < n; i++) {
+                job->out[off + i] = job->in[off + i] ^ ks[i];
+        }
+}
+
+void parallel_gift_64_ecb_encrypt(struct parallel_pool *pool,
+                                  uint64_t *c, const uint64_t *m, size_t nblocks,
+                                  const uint8x16x4_t rks[ROUNDS_GIFT_64][2])
+{
+        const struct parallel_job job = {
+                .tile = gift_64_ecb_encrypt_tile, .rks = rks,
+                .out = (uint8_t*)c, .in = (const uint8_t*)m, .len = nblocks,
+        };
+        run(pool, &job, (nblocks + 15) / 16);
+}
+
+void parallel_gift_64_ecb_decrypt(struct parallel_pool *pool,
+                                  uint64_t *m, const uint64_t *c, size_t nblocks,
+                                  const uint8x16x4_t rks[ROUNDS_GIFT_64][2])
+{
+        const struct parallel_job job = {
+                .tile = gift_64_ecb_decrypt_tile, .rks = rks,
+                .out = (uint8_t*)m, .in = (const uint8_t*)c, .len = nblocks,
+        };
+        run(pool, &job, (nblocks + 15) / 16);
+}
+
+void parallel_camellia_ecb_encrypt_128(struct parallel_pool *pool,
+                                       uint64_t (*c)[2], const uint64_t (*m)[2], size_t nblocks,
+                                       const struct camellia_rks_sliced_128 *rks)
+{
+        const struct parallel_job job = {
+                .tile = camellia_ecb_encrypt_tile, .rks = rks,
+                .out = (uint8_t*)c, .in = (const uint8_t*)m, .len = nblocks,
+        };
+        run(pool, &job, (nblocks + 15) / 16);
+}
+
+void parallel_camellia_ecb_decrypt_128(struct parallel_pool *pool,
+                                       uint64_t (*m)[2], const uint64_t (*c)[2], size_t nblocks,
+                                       const struct camellia_rks_sliced_128 *rks)
+{
+        const struct parallel_job job = {
+                .tile = camellia_ecb_decrypt_tile, .rks = rks,
+                .out = (uint8_t*)m, .in = (const uint8_t*)c, .len = nblocks,
+        };
+        run(pool, &job, (nblocks + 15) / 16);
+}
+
+void parallel_gift_64_ctr_xcrypt(struct parallel_pool *pool,
+                                 uint8_t *out, const uint8_t *in, size_t len,
+                                 uint64_t nonce, const struct gift_64_ctr_ctx *ctx)
+{
+        const struct parallel_job job = {
+                .tile = gift_64_ctr_tile, .rks = ctx,
+                .out = out, .in = in, .len = len, .nonce = { nonce, 0 },
+        };
+        run(pool, &job, (len + 127) / 128);
+}
+
+void parallel_camellia_ctr_xcrypt_128(struct parallel_pool *pool,
+                                      uint8_t *out, const uint8_t *in, size_t len,
+                                      const uint64_t nonce[2],
+                                      const struct camellia_rks_sliced_128 *rks)
+{
+        const struct parallel_job job = {
+                .tile = camellia_ctr_tile, .rks = rks,
+                .out = out, .in = in, .len = len, .nonce = { nonce[0], nonce[1] },
+        };
+        run(pool, &job, (len + 255) / 256);
+}
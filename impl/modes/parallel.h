@@ -0,0 +1,54 @@
+#pragma once
+
+// thread pool that spreads ECB/CTR over 16-block tiles; every worker starts
+// on an equal share and idle workers steal half of the remaining tiles of a
+// busy one, so fast and slow cores (big.LITTLE) finish at the same time
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../simd.h"
+
+#include "../gift/vec_sliced.h"
+#include "../camellia/camellia_keys.h"
+#include "gift_64_ctr.h"
+
+struct parallel_pool;
+
+// the calling thread takes part as worker 0, so nthreads - 1 are spawned;
+// returns NULL if memory or a thread cannot be had, after joining the
+// threads that did start
+struct parallel_pool *parallel_pool_create(int nthreads);
+void parallel_pool_destroy(struct parallel_pool *pool);
+int parallel_pool_threads(const struct parallel_pool *pool);
+
+// fn(arg, worker, tile) for every tile < ntiles with the same work stealing as
+// the kernels below; worker < parallel_pool_threads(pool) is the calling
+// thread, for per-thread state such as counters
+void parallel_for(struct parallel_pool *pool, size_t ntiles,
+                  void (*fn)(void *arg, int worker, size_t tile), void *arg);
+
+// blocks are laid out as for the single-threaded kernels, nblocks need not be
+// a multiple of 16
+void parallel_gift_64_ecb_encrypt(struct parallel_pool *pool,
+                                  uint64_t *c, const uint64_t *m, size_t nblocks,
+                                  const uint8x16x4_t rks[ROUNDS_GIFT_64][2]);
+void parallel_gift_64_ecb_decrypt(struct parallel_pool *pool,
+                                  uint64_t *m, const uint64_t *c, size_t nblocks,
+                                  const uint8x16x4_t rks[ROUNDS_GIFT_64][2]);
+void parallel_camellia_ecb_encrypt_128(struct parallel_pool *pool,
+                                       uint64_t (*c)[2], const uint64_t (*m)[2], size_t nblocks,
+                                       const struct camellia_rks_sliced_128 *rks);
+void parallel_camellia_ecb_decrypt_128(struct parallel_pool *pool,
+                                       uint64_t (*m)[2], const uint64_t (*c)[2], size_t nblocks,
+                                       const struct camellia_rks_sliced_128 *rks);
+
+// same keystream as gift_64_ctr_xcrypt
+void parallel_gift_64_ctr_xcrypt(struct parallel_pool *pool,
+                                 uint8_t *out, const uint8_t *in, size_t len,
+                                 uint64_t nonce, const struct gift_64_ctr_ctx *ctx);
+// keystream block i is E({ nonce[0], nonce[1] + i }) with the counter word
+// wrapping mod 2^64
+void parallel_camellia_ctr_xcrypt_128(struct parallel_pool *pool,
+                                      uint8_t *out, const uint8_t *in, size_t len,
+                                      const uint64_t nonce[2],
+                                      const struct camellia_rks_sliced_128 *rks);
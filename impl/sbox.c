@@ -0,0 +1,217 @@
+#include "analysis/sbox_tables.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <getopt.h>
+
+#include <stdint.h>
+
+// usage: ./sbox [options], see usage() below
+//
+// prints the differential/linear/boomerang properties (or full tables) of the
+// GIFT and Camellia S-boxes, or of S-boxes read from stdin, one per line as 16
+// or 256 hex entries, for search scripts that pipe candidates through
+
+enum table { TABLE_NONE, TABLE_DDT, TABLE_LAT, TABLE_BCT, TABLE_DLCT };
+
+static uint64_t now_ns(void)
+{
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000UL + ts.tv_nsec;
+}
+
+static int print_table(const struct sbox_vec *s, const enum table table)
+{
+        const int n = 1 << s->bits;
+        uint16_t *counts = malloc(n * n * sizeof(*counts));
+        int16_t *biases = malloc(n * n * sizeof(*biases));
+        if (counts == NULL || biases == NULL) {
+                free(counts);
+                free(biases);
+                return -1;
+        }
+
+        if (table == TABLE_DDT) {
+                sbox_ddt(counts, s);
+        } else if (table == TABLE_BCT && sbox_bct(counts, s) < 0) {
+                fprintf(stderr, "not a permutation, no BCT\n");
+        } else if (table == TABLE_LAT) {
+                sbox_lat(biases, s);
+        } else if (table == TABLE_DLCT) {
+                sbox_dlct(biases, s);
+        }
+
+        for (int a = 0; a < n && (table != TABLE_BCT || s->bijective); a++) {
+                for (int b = 0; b < n; b++) {
+                        const int v = table == TABLE_DDT || table == TABLE_BCT ?
+                                      counts[a * n + b] : biases[a * n + b];
+                        printf(b + 1 < n ? "%d " : "%d\n", v);
+                }
+        }
+
+        free(counts);
+        free(biases);
+        return 0;
+}
+
+static int print_properties(const char *name, const struct sbox_vec *s)
+{
+        struct sbox_props props;
+        if (sbox_properties(&props, s) < 0) {
+                return -1;
+        }
+        printf("%-10s du %d lin %d bu %d dlct %d\n", name, props.differential_uniformity,
+               props.linearity, props.boomerang_uniformity, props.dlct_max);
+        return 0;
+}
+
+// one S-box per line, entries separated by spaces or commas
+static int run_stdin(void)
+{
+        char line[4096];
+        size_t lines = 0, done = 0;
+        int status = 0;
+        const uint64_t t0 = now_ns();
+
+        while (fgets(line, sizeof(line), stdin) != NULL) {
+                lines++;
+                unsigned long v[256];
+                int n = 0, bad = 0;
+                for (char *p = strtok(line, " ,\t\n"); p != NULL; p = strtok(NULL, " ,\t\n")) {
+                        if (n == 256) {
+                                n++;
+                                break;
+                        }
+                        char *end;
+                        v[n++] = strtoul(p, &end, 16);
+                        bad |= *end != '\0';
+                }
+                if (n == 0) {
+                        continue;
+                }
+
+                // entries are checked here, uint8_t would wrap 0x123 to 0x23
+                uint8_t sbox[256];
+                for (int i = 0; i < n && i < 256 && !bad; i++) {
+                        bad = v[i] >= (n == 16 ? 16UL : 256UL);
+                        sbox[i] = v[i];
+                }
+
+                struct sbox_vec s;
+                if (bad || (n != 16 && n != 256) || sbox_vec_init(&s, sbox, n == 16 ? 4 : 8) < 0) {
+                        fprintf(stderr, "line %zu: expected 16 or 256 entries in range\n", lines);
+                        status = 1;
+                        continue;
+                }
+
+                char name[32];
+                snprintf(name, sizeof(name), "%zu", lines);
+                if (print_properties(name, &s) < 0) {
+                        fprintf(stderr, "out of memory for the tables\n");
+                        return 1;
+                }
+                done++;
+        }
+
+        const double seconds = (now_ns() - t0) / 1e9;
+        fprintf(stderr, "%zu S-boxes in %.3f s (%.0f/s)\n", done, seconds, done / seconds);
+        return status;
+}
+
+static void usage(const char *name)
+{
+        fprintf(stderr,
+                "usage: %s [options]\n"
+                "  -s, --sbox NAME     gift, camellia1 to camellia4 or all (default all)\n"
+                "  -t, --table NAME    print the ddt, lat, bct or dlct instead of the summary\n"
+                "  -i, --stdin         S-boxes from stdin, one per line (16 or 256 hex entries)\n",
+                name);
+}
+
+int main(int argc, char *argv[])
+{
+        static const struct option long_options[] = {
+                { "sbox",  required_argument, NULL, 's' },
+                { "table", required_argument, NULL, 't' },
+                { "stdin", no_argument,       NULL, 'i' },
+                { "help",  no_argument,       NULL, 'h' },
+                { NULL, 0, NULL, 0 }
+        };
+        static const char *names[] = { "gift", "camellia1", "camellia2", "camellia3", "camellia4" };
+
+        const char *only = "all";
+        enum table table = TABLE_NONE;
+        int from_stdin = 0;
+
+        int c;
+        while ((c = getopt_long(argc, argv, "s:t:ih", long_options, NULL)) != -1) {
+                switch (c) {
+                case 's':
+                        only = optarg;
+                        break;
+                case 't':
+                        if (strcmp(optarg, "ddt") == 0) {
+                                table = TABLE_DDT;
+                        } else if (strcmp(optarg, "lat") == 0) {
+                                table = TABLE_LAT;
+                        } else if (strcmp(optarg, "bct") == 0) {
+                                table = TABLE_BCT;
+                        } else if (strcmp(optarg, "dlct") == 0) {
+                                table = TABLE_DLCT;
+                        } else {
+                                fprintf(stderr, "unknown table '%s'\n", optarg);
+                                return 1;
+                        }
+                        break;
+                case 'i':
+                        from_stdin = 1;
+                        break;
+                default:
+                        usage(argv[0]);
+                        return c == 'h' ? 0 : 1;
+                }
+        }
+
+        if (from_stdin) {
+                return run_stdin();
+        }
+
+        int found = 0;
+        for (int i = 0; i < 5; i++) {
+                if (strcmp(only, "all") != 0 && strcmp(only, names[i]) != 0) {
+                        continue;
+                }
+                found = 1;
+
+                uint8_t sbox[256];
+                struct sbox_vec s;
+                if (i == 0) {
+                        sbox_gift(sbox);
+                        sbox_vec_init(&s, sbox, 4);
+                } else {
+                        sbox_camellia(sbox, i);
+                        sbox_vec_init(&s, sbox, 8);
+                }
+
+                int err;
+                if (table == TABLE_NONE) {
+                        err = print_properties(names[i], &s);
+                } else {
+                        printf("# %s\n", names[i]);
+                        err = print_table(&s, table);
+                }
+                if (err < 0) {
+                        fprintf(stderr, "out of memory for the tables\n");
+                        return 1;
+                }
+        }
+
+        if (!found) {
+                fprintf(stderr, "unknown S-box '%s'\n", only);
+                return 1;
+        }
+        return 0;
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+// the vector kernels are written against arm_neon.h; on x86 the subset of it
+// they use is mapped onto SSSE3 (pshufb for the table lookups) and AES-NI
+// (aesenclast for the AES S-box used by camellia), pmull maps onto pclmulqdq
+
+#if defined(__aarch64__)
+
+#include <arm_neon.h>
+
+#elif defined(__x86_64__)
+
+#if !defined(__SSSE3__) || !defined(__AES__) || !defined(__PCLMUL__)
+#error "the x86 backend needs SSSE3, AES-NI and PCLMULQDQ (-mssse3 -maes -mpclmul)"
+#endif
+
+#include <stdint.h>
+#include <immintrin.h>
+
+// NEON distinguishes element types, SSE does not (fine for C)
+typedef __m128i uint8x16_t;
+typedef __m128i uint64x2_t;
+typedef __m128i poly64x2_t;
+typedef __m128i poly128_t;
+typedef uint64_t poly64_t;
+
+typedef struct { uint8x16_t val[2]; } uint8x16x2_t;
+typedef struct { uint8x16_t val[4]; } uint8x16x4_t;
+
+static inline uint8x16_t veorq_u8(const uint8x16_t a, const uint8x16_t b)
+{
+        return _mm_xor_si128(a, b);
+}
+
+static inline uint8x16_t vandq_u8(const uint8x16_t a, const uint8x16_t b)
+{
+        return _mm_and_si128(a, b);
+}
+
+static inline uint8x16_t vorrq_u8(const uint8x16_t a, const uint8x16_t b)
+{
+        return _mm_or_si128(a, b);
+}
+
+static inline uint8x16_t vmvnq_u8(const uint8x16_t a)
+{
+        return _mm_xor_si128(a, _mm_set1_epi8(-1));
+}
+
+static inline uint8x16_t vdupq_n_u8(const uint8_t x)
+{
+        return _mm_set1_epi8(x);
+}
+
+static inline uint64x2_t vdupq_n_u64(const uint64_t x)
+{
+        return _mm_set1_epi64x(x);
+}
+
+static inline uint64x2_t vaddq_u64(const uint64x2_t a, const uint64x2_t b)
+{
+        return _mm_add_epi64(a, b);
+}
+
+static inline uint8x16_t vaddq_u8(const uint8x16_t a, const uint8x16_t b)
+{
+        return _mm_add_epi8(a, b);
+}
+
+static inline uint8x16_t vsubq_u8(const uint8x16_t a, const uint8x16_t b)
+{
+        return _mm_sub_epi8(a, b);
+}
+
+static inline uint8x16_t vceqq_u8(const uint8x16_t a, const uint8x16_t b)
+{
+        return _mm_cmpeq_epi8(a, b);
+}
+
+// psadbw against zero sums each half
+static inline uint16_t vaddlvq_u8(const uint8x16_t a)
+{
+        const __m128i s = _mm_sad_epu8(a, _mm_setzero_si128());
+        return _mm_cvtsi128_si32(s) + _mm_extract_epi16(s, 4);
+}
+
+// there are no byte shifts, so shift 16-bit lanes and mask
+static inline uint8x16_t vshrq_n_u8(const uint8x16_t a, const int n)
+{
+        return _mm_and_si128(_mm_srli_epi16(a, n), _mm_set1_epi8(0xff >> n));
+}
+
+static inline uint8x16_t vshlq_n_u8(const uint8x16_t a, const int n)
+{
+        return _mm_and_si128(_mm_slli_epi16(a, n), _mm_set1_epi8((0xff << n) & 0xff));
+}
+
+static inline uint64x2_t vshrq_n_u64(const uint64x2_t a, const int n)
+{
+        return _mm_srli_epi64(a, n);
+}
+
+static inline uint64x2_t vshlq_n_u64(const uint64x2_t a, const int n)
+{
+        return _mm_slli_epi64(a, n);
+}
+
+// palignr needs an immediate
+#define vextq_u64(a, b, n) _mm_alignr_epi8((b), (a), 8 * (n))
+
+static inline uint64x2_t vzip1q_u64(const uint64x2_t a, const uint64x2_t b)
+{
+        return _mm_unpacklo_epi64(a, b);
+}
+
+static inline uint64x2_t vzip2q_u64(const uint64x2_t a, const uint64x2_t b)
+{
+        return _mm_unpackhi_epi64(a, b);
+}
+
+static inline uint64_t vgetq_lane_u64(const uint64x2_t a, const int lane)
+{
+        return _mm_cvtsi128_si64(lane == 0 ? a : _mm_unpackhi_epi64(a, a));
+}
+
+static inline uint64x2_t vsetq_lane_u64(const uint64_t x, const uint64x2_t a, const int lane)
+{
+        const __m128i v = _mm_cvtsi64_si128(x);
+        return lane == 0 ? _mm_unpacklo_epi64(v, _mm_unpackhi_epi64(a, a))
+                         : _mm_unpacklo_epi64(a, v);
+}
+
+static inline poly64x2_t vreinterpretq_p64_u8(const uint8x16_t a)
+{
+        return a;
+}
+
+static inline uint8x16_t vreinterpretq_u8_p128(const poly128_t a)
+{
+        return a;
+}
+
+static inline poly128_t vmull_p64(const poly64_t a, const poly64_t b)
+{
+        return _mm_clmulepi64_si128(_mm_cvtsi64_si128(a), _mm_cvtsi64_si128(b), 0x00);
+}
+
+static inline poly128_t vmull_high_p64(const poly64x2_t a, const poly64x2_t b)
+{
+        return _mm_clmulepi64_si128(a, b, 0x11);
+}
+
+// tbl yields 0 for indices >= 16 while pshufb only clears on bit 7, the
+// saturating add keeps the low nibble of valid indices and sets bit 7 of
+// all others
+static inline uint8x16_t tbl_index(const uint8x16_t idx, const int table)
+{
+        return _mm_adds_epu8(_mm_sub_epi8(idx, _mm_set1_epi8(16 * table)),
+                             _mm_set1_epi8(0x70));
+}
+
+static inline uint8x16_t vqtbl1q_u8(const uint8x16_t t, const uint8x16_t idx)
+{
+        return _mm_shuffle_epi8(t, tbl_index(idx, 0));
+}
+
+static inline uint8x16_t vqtbl2q_u8(const uint8x16x2_t t, const uint8x16_t idx)
+{
+        return _mm_or_si128(_mm_shuffle_epi8(t.val[0], tbl_index(idx, 0)),
+                            _mm_shuffle_epi8(t.val[1], tbl_index(idx, 1)));
+}
+
+static inline uint8x16_t vqtbl4q_u8(const uint8x16x4_t t, const uint8x16_t idx)
+{
+        return _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(t.val[0], tbl_index(idx, 0)),
+                                         _mm_shuffle_epi8(t.val[1], tbl_index(idx, 1))),
+                            _mm_or_si128(_mm_shuffle_epi8(t.val[2], tbl_index(idx, 2)),
+                                         _mm_shuffle_epi8(t.val[3], tbl_index(idx, 3))));
+}
+
+// aese is AddRoundKey, ShiftRows, SubBytes while aesenclast is ShiftRows,
+// SubBytes, AddRoundKey
+static inline uint8x16_t vaeseq_u8(const uint8x16_t data, const uint8x16_t key)
+{
+        return _mm_aesenclast_si128(_mm_xor_si128(data, key), _mm_setzero_si128());
+}
+
+static inline uint8x16_t vld1q_u8(const uint8_t *p)
+{
+        return _mm_loadu_si128((const __m128i*)p);
+}
+
+static inline uint64x2_t vld1q_u64(const uint64_t *p)
+{
+        return _mm_loadu_si128((const __m128i*)p);
+}
+
+static inline uint8x16x2_t vld1q_u8_x2(const uint8_t *p)
+{
+        const uint8x16x2_t r = { .val = { vld1q_u8(p), vld1q_u8(p + 16) } };
+        return r;
+}
+
+static inline uint8x16x4_t vld1q_u8_x4(const uint8_t *p)
+{
+        const uint8x16x4_t r = {
+                .val = { vld1q_u8(p), vld1q_u8(p + 16), vld1q_u8(p + 32), vld1q_u8(p + 48) }
+        };
+        return r;
+}
+
+static inline void vst1q_u8(uint8_t *p, const uint8x16_t a)
+{
+        _mm_storeu_si128((__m128i*)p, a);
+}
+
+static inline void vst1q_u64(uint64_t *p, const uint64x2_t a)
+{
+        _mm_storeu_si128((__m128i*)p, a);
+}
+
+static inline void vst1q_u8_x4(uint8_t *p, const uint8x16x4_t a)
+{
+        for (int i = 0; i < 4; i++) {
+                vst1q_u8(p + 16 * i, a.val[i]);
+        }
+}
+
+#else
+#error "no vector backend for this architecture"
+#endif
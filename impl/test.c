@@ -1,14 +1,36 @@
 #pragma clang optimize off
 
 #include "gift/naive.h"
+#include "gift/fixsliced_128.h"
 #include "gift/sliced.h"
 #include "gift/table.h"
 #include "gift/vec_sbox.h"
 #include "gift/vec_sliced.h"
+#include "gift/vec_sliced_128.h"
+#include "gift/vec_sliced_avx2.h"
+#include "gift/vec_sliced_sve.h"
+#include "gift/vec_sliced_sha3.h"
 
 #include "camellia/naive.h"
 #include "camellia/spec_opt.h"
 #include "camellia/bytesliced.h"
+#include "camellia/bytesliced_avx2.h"
+#include "camellia/bytesliced_sve.h"
+#include "camellia/bytesliced_sha3.h"
+
+#include "modes/gift_64_ctr.h"
+#include "modes/cbc.h"
+#include "modes/camellia_xts.h"
+#include "modes/parallel.h"
+
+#include "aead/gift_cofb.h"
+#include "aead/camellia_gcm.h"
+
+#include "dispatch/dispatch.h"
+#include "analysis/gift_64_differential.h"
+#include "analysis/sbox_tables.h"
+
+#include "gift_neon.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -130,30 +152,75 @@ void test_gift_64_sliced(void)
                 gift_64_sliced_decrypt(m_actual, c, key);
                 ASSERT_TRUE(memcmp(m_actual, m, 8 * 8) == 0);
         }
+
+        // key context over several groups, in place
+        printf("testing GIFT_64_SLICED key context against single groups...\n");
+        struct gift_64_sliced_ctx ctx;
+        uint64_t m_groups[5][8], c_groups[5][8];
+        for (int i = 0; i < 20; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m_groups, sizeof(m_groups));
+                gift_64_sliced_ctx_init(&ctx, key);
+
+                memcpy(c_groups, m_groups, sizeof(c_groups));
+                gift_64_sliced_encrypt_groups(&ctx, &c_groups[0][0], &c_groups[0][0], 5);
+                for (size_t j = 0; j < 5; j++) {
+                        gift_64_sliced_encrypt(c, m_groups[j], key);
+                        ASSERT_TRUE(memcmp(c, c_groups[j], sizeof(c)) == 0);
+                }
+
+                gift_64_sliced_decrypt_groups(&ctx, &c_groups[0][0], &c_groups[0][0], 5);
+                ASSERT_TRUE(memcmp(c_groups, m_groups, sizeof(m_groups)) == 0);
+        }
 }
 
 void test_gift_64_table(void)
 {
-        return;
         // test encrypt to known value
         printf("testing GIFT_64_TABLE encrytion to known value...\n");
         uint64_t key[2] = { 0x5085772fe6916616UL, 0x3c9d8c18fdd20608UL };
         uint64_t m = 0x4dcfd3bdd61810f0UL;
         uint64_t c_expected = 0xb11d30b8d39763e1UL;
         uint64_t c;
-        c = gift_64_table_encrypt(m, key);
+        uint64_t rks[ROUNDS_GIFT_64];
+        uint64_t rks_inv[ROUNDS_GIFT_64];
+        gift_64_table_generate_round_keys(rks, key);
+        c = gift_64_table_encrypt(m, rks);
         ASSERT_EQUALS(c, c_expected);
 
+        printf("testing GIFT_64_TABLE decryption of known value...\n");
+        gift_64_table_generate_round_keys_inv(rks_inv, key);
+        ASSERT_EQUALS(gift_64_table_decrypt(c_expected, rks_inv), m);
+
         // test encrypt-decrypt
         printf("testing GIFT_64_TABLE encrypt-decrypt...\n");
+        uint64_t rks_naive[ROUNDS_GIFT_64];
         for (int i = 0; i < 100; i++) {
                 m_rand((uint8_t*)key, sizeof(key));
                 m_rand((uint8_t*)&m, sizeof(m));
 
-                c = gift_64_table_encrypt(m, key);
-                // only encryption for table approach
-                uint64_t m_actual = gift_64_decrypt(c, key);
-                ASSERT_EQUALS(m, m_actual);
+                gift_64_table_generate_round_keys(rks, key);
+                gift_64_table_generate_round_keys_inv(rks_inv, key);
+                gift_64_generate_round_keys(rks_naive, key);
+                c = gift_64_table_encrypt(m, rks);
+                ASSERT_EQUALS(c, gift_64_encrypt(m, rks_naive));
+                ASSERT_EQUALS(gift_64_table_decrypt(c, rks_inv), m);
+                ASSERT_EQUALS(gift_64_decrypt(c, rks_naive), m);
+        }
+
+        printf("testing GIFT_64_TABLE byte tables against nibble tables...\n");
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)&m, sizeof(m));
+
+                gift_64_table_generate_round_keys(rks, key);
+                gift_64_table_generate_round_keys_inv(rks_inv, key);
+                ASSERT_EQUALS(gift_64_table_subperm_bytes(m), gift_64_table_subperm(m));
+                ASSERT_EQUALS(gift_64_table_subperm_inv_bytes(m), gift_64_table_subperm_inv(m));
+                c = gift_64_table_encrypt_nibbles(m, rks);
+                ASSERT_EQUALS(gift_64_table_encrypt_bytes(m, rks), c);
+                ASSERT_EQUALS(gift_64_table_decrypt_bytes(c, rks_inv), m);
+                ASSERT_EQUALS(gift_64_table_decrypt_nibbles(c, rks_inv), m);
         }
 }
 
@@ -185,6 +252,35 @@ void test_gift_64_vec_sbox(void)
                 uint64_t m_actual = gift_64_vec_sbox_decrypt(c, rks);
                 ASSERT_EQUALS(m, m_actual);
         }
+
+        printf("testing GIFT_64_VEC_SBOX interleaved against single block...\n");
+        uint64_t ms[8], cs[8], ms_actual[8];
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)ms, sizeof(ms));
+                gift_64_vec_sbox_generate_round_keys(rks, key);
+
+                gift_64_vec_sbox_encrypt_x2(cs, ms, rks);
+                gift_64_vec_sbox_decrypt_x2(ms_actual, cs, rks);
+                for (size_t j = 0; j < 2; j++) {
+                        ASSERT_EQUALS(cs[j], gift_64_vec_sbox_encrypt(ms[j], rks));
+                        ASSERT_EQUALS(ms_actual[j], ms[j]);
+                }
+
+                gift_64_vec_sbox_encrypt_x4(cs, ms, rks);
+                gift_64_vec_sbox_decrypt_x4(ms_actual, cs, rks);
+                for (size_t j = 0; j < 4; j++) {
+                        ASSERT_EQUALS(cs[j], gift_64_vec_sbox_encrypt(ms[j], rks));
+                        ASSERT_EQUALS(ms_actual[j], ms[j]);
+                }
+
+                gift_64_vec_sbox_encrypt_x8(cs, ms, rks);
+                gift_64_vec_sbox_decrypt_x8(ms_actual, cs, rks);
+                for (size_t j = 0; j < 8; j++) {
+                        ASSERT_EQUALS(cs[j], gift_64_vec_sbox_encrypt(ms[j], rks));
+                        ASSERT_EQUALS(ms_actual[j], ms[j]);
+                }
+        }
 }
 
 void test_gift_64_vec_sliced(void)
@@ -264,6 +360,728 @@ void test_gift_64_vec_sliced(void)
                 gift_64_vec_sliced_decrypt(m_actual, c, rks);
                 ASSERT_TRUE(memcmp(m, m_actual, sizeof(m_actual)) == 0);
         }
+
+        printf("testing GIFT_64_VEC_SLICED one key per block...\n");
+        uint64_t keys[16][2];
+        uint64_t round_keys[ROUNDS_GIFT_64];
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)keys, sizeof(keys));
+                m_rand((uint8_t*)m, sizeof(m));
+
+                gift_64_vec_sliced_generate_round_keys_multi(rks, keys);
+                gift_64_vec_sliced_encrypt(c, m, rks);
+                for (size_t j = 0; j < 16; j++) {
+                        gift_64_generate_round_keys(round_keys, keys[j]);
+                        ASSERT_EQUALS(c[j], gift_64_encrypt(m[j], round_keys));
+                }
+
+                uint64_t m_actual[16];
+                gift_64_vec_sliced_decrypt(m_actual, c, rks);
+                ASSERT_TRUE(memcmp(m, m_actual, sizeof(m_actual)) == 0);
+        }
+
+        // the same key in every lane gives the broadcast schedule
+        uint8x16x4_t rks_single[ROUNDS_GIFT_64][2];
+        for (size_t j = 0; j < 16; j++) {
+                keys[j][0] = key[0];
+                keys[j][1] = key[1];
+        }
+        gift_64_vec_sliced_generate_round_keys(rks_single, key);
+        gift_64_vec_sliced_generate_round_keys_multi(rks, keys);
+        ASSERT_TRUE(memcmp(rks, rks_single, sizeof(rks)) == 0);
+
+        // blocks at offset 3 of 13-byte records, so none of them is aligned
+        printf("testing GIFT_64_VEC_SLICED strided in place...\n");
+        uint8_t records[16 * 13], records_orig[16 * 13];
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand(records, sizeof(records));
+                memcpy(records_orig, records, sizeof(records));
+                for (size_t j = 0; j < 16; j++) {
+                        memcpy(&m[j], records + 13 * j + 3, 8);
+                }
+
+                gift_64_vec_sliced_generate_round_keys(rks, key);
+                gift_64_vec_sliced_encrypt(c, m, rks);
+                gift_64_vec_sliced_encrypt_strided(records + 3, records + 3, 13, rks);
+                for (size_t j = 0; j < 16; j++) {
+                        ASSERT_TRUE(memcmp(&c[j], records + 13 * j + 3, 8) == 0);
+                }
+
+                gift_64_vec_sliced_decrypt_strided(records + 3, records + 3, 13, rks);
+                ASSERT_TRUE(memcmp(records, records_orig, sizeof(records)) == 0);
+        }
+}
+
+void test_gift_128_vec_sliced(void)
+{
+        gift_128_vec_sliced_init();
+
+        printf("testing GIFT_128_VEC_SLICED packing/unpacking...\n");
+        uint8_t m[16][16], c[16][16], m_actual[16][16];
+        uint8x16x4_t s[4];
+        m_rand((uint8_t*)m, sizeof(m));
+        gift_128_vec_sliced_bits_pack(s, m);
+        gift_128_vec_sliced_bits_unpack(m_actual, s);
+        ASSERT_TRUE(memcmp(m, m_actual, sizeof(m)) == 0);
+
+        // test encrypt to known value (16 times the same)
+        printf("testing GIFT_128_VEC_SLICED encryption to known value...\n");
+        uint64_t key[2] = { 0xe4cb97525e4e9ec7UL, 0xac22df007be1e75fUL };
+        const uint8_t m_known[16] = {
+                0x52, 0xfa, 0x11, 0x56, 0xd7, 0x27, 0x67, 0xb5,
+                0x33, 0x80, 0xce, 0xd7, 0x25, 0x85, 0x2d, 0xf2
+        };
+        const uint8_t c_expected[16] = {
+                0x87, 0x04, 0x63, 0xb0, 0x99, 0x08, 0x1e, 0x78,
+                0x06, 0x7b, 0xc0, 0x97, 0xa6, 0x38, 0x1f, 0xe8
+        };
+        uint8x16x4_t rks[ROUNDS_GIFT_128][2];
+        for (int i = 0; i < 16; i++) {
+                memcpy(m[i], m_known, 16);
+        }
+        gift_128_vec_sliced_generate_round_keys(rks, key);
+        gift_128_vec_sliced_encrypt(c, m, rks);
+        for (int i = 0; i < 16; i++) {
+                ASSERT_TRUE(memcmp(c[i], c_expected, 16) == 0);
+        }
+
+        // test against naive implementation (distinct blocks)
+        printf("testing GIFT_128_VEC_SLICED against GIFT_128...\n");
+        uint8_t rks_naive[ROUNDS_GIFT_128][32];
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m, sizeof(m));
+
+                gift_128_generate_round_keys(rks_naive, key);
+                gift_128_vec_sliced_generate_round_keys(rks, key);
+                gift_128_vec_sliced_encrypt(c, m, rks);
+                for (int j = 0; j < 16; j++) {
+                        uint8_t c_naive[16];
+                        gift_128_encrypt(c_naive, m[j], rks_naive);
+                        ASSERT_TRUE(memcmp(c[j], c_naive, 16) == 0);
+                }
+
+                gift_128_vec_sliced_decrypt(m_actual, c, rks);
+                ASSERT_TRUE(memcmp(m, m_actual, sizeof(m)) == 0);
+
+                // in place
+                gift_128_vec_sliced_encrypt(m_actual, m_actual, rks);
+                ASSERT_TRUE(memcmp(c, m_actual, sizeof(c)) == 0);
+        }
+
+        // blocks at offset 3 of 19-byte records, so none of them is aligned
+        printf("testing GIFT_128_VEC_SLICED strided in place...\n");
+        uint8_t records[16 * 19], records_orig[16 * 19];
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand(records, sizeof(records));
+                memcpy(records_orig, records, sizeof(records));
+                for (size_t j = 0; j < 16; j++) {
+                        memcpy(m[j], records + 19 * j + 3, 16);
+                }
+
+                gift_128_vec_sliced_generate_round_keys(rks, key);
+                gift_128_vec_sliced_encrypt(c, m, rks);
+                gift_128_vec_sliced_encrypt_strided(records + 3, records + 3, 19, rks);
+                for (size_t j = 0; j < 16; j++) {
+                        ASSERT_TRUE(memcmp(c[j], records + 19 * j + 3, 16) == 0);
+                }
+
+                gift_128_vec_sliced_decrypt_strided(records + 3, records + 3, 19, rks);
+                ASSERT_TRUE(memcmp(records, records_orig, sizeof(records)) == 0);
+        }
+}
+
+void test_gift_128_fixsliced(void)
+{
+        printf("testing GIFT_128_FIXSLICED packing/unpacking...\n");
+        uint8_t m[16], c[16], m_actual[16];
+        uint32_t s[4];
+        m_rand(m, 16);
+        gift_128_fixsliced_bits_pack(s, m);
+        gift_128_fixsliced_bits_unpack(m_actual, s);
+        ASSERT_TRUE(memcmp(m, m_actual, 16) == 0);
+
+        // test encrypt to known values (the second from the reference cipher)
+        printf("testing GIFT_128_FIXSLICED encryption to known value...\n");
+        uint64_t key[2] = { 0xe4cb97525e4e9ec7UL, 0xac22df007be1e75fUL };
+        const uint8_t m_known[16] = {
+                0x52, 0xfa, 0x11, 0x56, 0xd7, 0x27, 0x67, 0xb5,
+                0x33, 0x80, 0xce, 0xd7, 0x25, 0x85, 0x2d, 0xf2
+        };
+        const uint8_t c_expected[16] = {
+                0x87, 0x04, 0x63, 0xb0, 0x99, 0x08, 0x1e, 0x78,
+                0x06, 0x7b, 0xc0, 0x97, 0xa6, 0x38, 0x1f, 0xe8
+        };
+        uint32_t rks[ROUNDS_GIFT_128][3];
+        gift_128_fixsliced_generate_round_keys(rks, key);
+        gift_128_fixsliced_encrypt(c, m_known, rks);
+        ASSERT_TRUE(memcmp(c, c_expected, 16) == 0);
+
+        uint64_t key_ref[2] = { 0xaf49e38d27c16b05UL, 0xaf49e38d27c16b05UL };
+        const uint8_t m_ref[16] = {
+                0xa3, 0x81, 0x6f, 0x4d, 0x2b, 0x09, 0xe7, 0xc5,
+                0xa3, 0x81, 0x6f, 0x4d, 0x2b, 0x09, 0xe7, 0xc5
+        };
+        const uint8_t c_ref[16] = {
+                0x02, 0xaa, 0x96, 0xb5, 0x8f, 0x22, 0x0b, 0x04,
+                0x75, 0x93, 0x66, 0xb5, 0x63, 0x72, 0xf6, 0xc1
+        };
+        gift_128_fixsliced_generate_round_keys(rks, key_ref);
+        gift_128_fixsliced_encrypt(c, m_ref, rks);
+        ASSERT_TRUE(memcmp(c, c_ref, 16) == 0);
+
+        // test against naive implementation
+        printf("testing GIFT_128_FIXSLICED against GIFT_128...\n");
+        uint8_t rks_naive[ROUNDS_GIFT_128][32];
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand(m, 16);
+
+                gift_128_generate_round_keys(rks_naive, key);
+                gift_128_fixsliced_generate_round_keys(rks, key);
+                gift_128_fixsliced_encrypt(c, m, rks);
+                uint8_t c_naive[16];
+                gift_128_encrypt(c_naive, m, rks_naive);
+                ASSERT_TRUE(memcmp(c, c_naive, 16) == 0);
+
+                gift_128_fixsliced_decrypt(m_actual, c, rks);
+                ASSERT_TRUE(memcmp(m, m_actual, 16) == 0);
+        }
+}
+
+void test_gift_64_ctr(void)
+{
+        printf("testing GIFT_64_CTR against scalar counter mode...\n");
+        uint64_t key[2];
+        uint64_t rks[ROUNDS_GIFT_64];
+        struct gift_64_ctr_ctx ctx;
+
+        static uint8_t m[2053], c[2053], m_actual[2053];
+        const size_t lens[] = { 0, 1, 8, 127, 128, 129, 1000, 2053 };
+        const uint64_t nonces[] = { 0x0123456700000000UL, 0xfffffffffffffff9UL };
+
+        for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+                for (size_t j = 0; j < 2; j++) {
+                        m_rand((uint8_t*)key, sizeof(key));
+                        m_rand(m, sizeof(m));
+
+                        gift_64_ctr_init(&ctx, key);
+                        gift_64_ctr_xcrypt(&ctx, c, m, lens[i], nonces[j]);
+
+                        gift_64_generate_round_keys(rks, key);
+                        for (size_t k = 0; k < lens[i]; k++) {
+                                uint64_t ks = gift_64_encrypt(nonces[j] + k / 8, rks);
+                                ASSERT_TRUE(c[k] == (m[k] ^ ((uint8_t*)&ks)[k % 8]));
+                        }
+
+                        // decryption is encryption (also test in-place)
+                        memcpy(m_actual, c, lens[i]);
+                        gift_64_ctr_xcrypt(&ctx, m_actual, m_actual, lens[i], nonces[j]);
+                        ASSERT_TRUE(memcmp(m, m_actual, lens[i]) == 0);
+                }
+        }
+}
+
+void test_cbc(void)
+{
+        printf("testing GIFT_64_CBC against scalar CBC...\n");
+        uint64_t key[2];
+        uint64_t rks[ROUNDS_GIFT_64];
+        struct camellia_rks_128 rks_128;
+        struct gift_64_cbc_ctx ctx;
+        struct camellia_cbc_ctx_128 ctx_128;
+
+        static uint8_t m[16][4096], c[16][4096], m_actual[4096];
+        uint8_t iv[16][16], iv_64[16][8], iv_orig[16][16], iv_actual[16];
+        const size_t lens[] = { 0, 1, 15, 16, 17, 40, 256 }; // blocks
+
+        for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+                const size_t len = lens[i] * 8;
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m, sizeof(m));
+                m_rand((uint8_t*)iv_orig, sizeof(iv_orig));
+
+                gift_64_cbc_init(&ctx, key);
+                gift_64_generate_round_keys(rks, key);
+
+                // the iv carries the chain into the second call
+                const size_t split = len / 16 * 8;
+                memcpy(iv[0], iv_orig[0], 8);
+                gift_64_cbc_encrypt(&ctx, c[0], m[0], split, iv[0]);
+                gift_64_cbc_encrypt(&ctx, c[0] + split, m[0] + split, len - split, iv[0]);
+
+                uint64_t chain;
+                memcpy(&chain, iv_orig[0], 8);
+                for (size_t k = 0; k < len; k += 8) {
+                        uint64_t block;
+                        memcpy(&block, m[0] + k, 8);
+                        chain = gift_64_encrypt(block ^ chain, rks);
+                        ASSERT_TRUE(memcmp(c[0] + k, &chain, 8) == 0);
+                }
+                ASSERT_TRUE(memcmp(iv[0], &chain, 8) == 0);
+
+                // in place, split off a few blocks so both calls have tails
+                const size_t split_dec = len >= 24 ? 24 : 0;
+                memcpy(m_actual, c[0], len);
+                memcpy(iv_actual, iv_orig[0], 8);
+                gift_64_cbc_decrypt(&ctx, m_actual, m_actual, split_dec, iv_actual);
+                gift_64_cbc_decrypt(&ctx, m_actual + split_dec, m_actual + split_dec,
+                                    len - split_dec, iv_actual);
+                ASSERT_TRUE(memcmp(m[0], m_actual, len) == 0);
+                ASSERT_TRUE(memcmp(iv_actual, &chain, 8) == 0);
+
+                uint8_t *outs[16];
+                const uint8_t *ins[16];
+                for (size_t j = 0; j < 16; j++) {
+                        outs[j] = c[j];
+                        ins[j] = m[j];
+                        memcpy(iv_64[j], iv_orig[j], 8);
+                }
+                gift_64_cbc_encrypt_x16(&ctx, outs, ins, len, iv_64);
+                for (size_t j = 0; j < 16; j++) {
+                        uint8_t c_serial[4096];
+                        memcpy(iv_actual, iv_orig[j], 8);
+                        gift_64_cbc_encrypt(&ctx, c_serial, m[j], len, iv_actual);
+                        ASSERT_TRUE(memcmp(c[j], c_serial, len) == 0);
+                        ASSERT_TRUE(memcmp(iv_64[j], iv_actual, 8) == 0);
+                }
+        }
+
+        printf("testing CAMELLIA_CBC 128-bit against scalar CBC...\n");
+        for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+                const size_t len = lens[i] * 16;
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m, sizeof(m));
+                m_rand((uint8_t*)iv_orig, sizeof(iv_orig));
+
+                camellia_cbc_init_128(&ctx_128, key);
+                camellia_naive_generate_round_keys_128(&rks_128, key);
+
+                const size_t split = len / 32 * 16;
+                memcpy(iv[0], iv_orig[0], 16);
+                camellia_cbc_encrypt_128(&ctx_128, c[0], m[0], split, iv[0]);
+                camellia_cbc_encrypt_128(&ctx_128, c[0] + split, m[0] + split, len - split,
+                                         iv[0]);
+
+                uint64_t chain[2];
+                memcpy(chain, iv_orig[0], 16);
+                for (size_t k = 0; k < len; k += 16) {
+                        uint64_t block[2];
+                        memcpy(block, m[0] + k, 16);
+                        block[0] ^= chain[0];
+                        block[1] ^= chain[1];
+                        camellia_naive_encrypt_128(chain, block, &rks_128);
+                        ASSERT_TRUE(memcmp(c[0] + k, chain, 16) == 0);
+                }
+                ASSERT_TRUE(memcmp(iv[0], chain, 16) == 0);
+
+                const size_t split_dec = len >= 48 ? 48 : 0;
+                memcpy(m_actual, c[0], len);
+                memcpy(iv_actual, iv_orig[0], 16);
+                camellia_cbc_decrypt_128(&ctx_128, m_actual, m_actual, split_dec, iv_actual);
+                camellia_cbc_decrypt_128(&ctx_128, m_actual + split_dec, m_actual + split_dec,
+                                         len - split_dec, iv_actual);
+                ASSERT_TRUE(memcmp(m[0], m_actual, len) == 0);
+                ASSERT_TRUE(memcmp(iv_actual, chain, 16) == 0);
+
+                uint8_t *outs[16];
+                const uint8_t *ins[16];
+                for (size_t j = 0; j < 16; j++) {
+                        outs[j] = c[j];
+                        ins[j] = m[j];
+                        memcpy(iv[j], iv_orig[j], 16);
+                }
+                camellia_cbc_encrypt_128_x16(&ctx_128, outs, ins, len, iv);
+                for (size_t j = 0; j < 16; j++) {
+                        uint8_t c_serial[4096];
+                        memcpy(iv_actual, iv_orig[j], 16);
+                        camellia_cbc_encrypt_128(&ctx_128, c_serial, m[j], len, iv_actual);
+                        ASSERT_TRUE(memcmp(c[j], c_serial, len) == 0);
+                        ASSERT_TRUE(memcmp(iv[j], iv_actual, 16) == 0);
+                }
+        }
+}
+
+void test_camellia_xts(void)
+{
+        // IEEE 1619 vectors 1, 2, 4 and 15 with Camellia in place of AES; the
+        // outputs come from the standard's XTS over OpenSSL's Camellia-ECB,
+        // checked against OpenSSL's AES-XTS on the original vectors
+        printf("testing CAMELLIA_XTS 128-bit to known values...\n");
+        struct camellia_xts_ctx_128 ctx;
+        uint8_t key[32];
+        static uint8_t m[4096 + 15], c[4096 + 15], m_actual[4096 + 15];
+
+        const uint8_t c_1[32] = {
+                0x06, 0xcb, 0xa5, 0xf1, 0x04, 0x63, 0xb2, 0x41,
+                0xdc, 0xca, 0xfa, 0x09, 0xba, 0x74, 0xb9, 0x05,
+                0x78, 0xba, 0xa4, 0xf8, 0x67, 0x4d, 0x7e, 0xad,
+                0x20, 0x18, 0xf5, 0x0c, 0x41, 0x16, 0x2a, 0x61,
+        };
+        memset(key, 0, 32);
+        memset(m, 0, 32);
+        camellia_xts_init_128(&ctx, key);
+        camellia_xts_encrypt_128(&ctx, c, m, 32, 0);
+        ASSERT_TRUE(memcmp(c, c_1, 32) == 0);
+
+        const uint8_t c_2[32] = {
+                0xc2, 0xb9, 0xdc, 0x44, 0x1d, 0xdf, 0xf2, 0x86,
+                0x8d, 0x35, 0x42, 0x0a, 0xa5, 0x5e, 0x3d, 0x4f,
+                0xb5, 0x37, 0x06, 0xff, 0xbd, 0xd4, 0x91, 0x70,
+                0x80, 0x1f, 0xb2, 0x39, 0x10, 0x89, 0x44, 0xf5,
+        };
+        memset(key, 0x11, 16);
+        memset(key + 16, 0x22, 16);
+        memset(m, 0x44, 32);
+        camellia_xts_init_128(&ctx, key);
+        camellia_xts_encrypt_128(&ctx, c, m, 32, 0x3333333333UL);
+        ASSERT_TRUE(memcmp(c, c_2, 32) == 0);
+
+        // 512-byte sector, only the last two blocks are listed here
+        const uint8_t key_4[32] = {
+                0x27, 0x18, 0x28, 0x18, 0x28, 0x45, 0x90, 0x45,
+                0x23, 0x53, 0x60, 0x28, 0x74, 0x71, 0x35, 0x26,
+                0x31, 0x41, 0x59, 0x26, 0x53, 0x58, 0x97, 0x93,
+                0x23, 0x84, 0x62, 0x64, 0x33, 0x83, 0x27, 0x95,
+        };
+        const uint8_t c_4_tail[32] = {
+                0x05, 0x87, 0xc2, 0x1e, 0x7e, 0x2d, 0xd4, 0x33,
+                0xcc, 0x06, 0xdb, 0xe7, 0x82, 0x29, 0x63, 0xd1,
+                0x52, 0x84, 0x4f, 0xee, 0x27, 0xe8, 0x02, 0xd4,
+                0x34, 0x3c, 0x69, 0xc2, 0xbd, 0x20, 0xe6, 0x7a,
+        };
+        for (size_t i = 0; i < 512; i++) {
+                m[i] = i;
+        }
+        camellia_xts_init_128(&ctx, key_4);
+        camellia_xts_encrypt_128(&ctx, c, m, 512, 0);
+        ASSERT_TRUE(memcmp(c + 480, c_4_tail, 32) == 0);
+        camellia_xts_decrypt_128(&ctx, m_actual, c, 512, 0);
+        ASSERT_TRUE(memcmp(m, m_actual, 512) == 0);
+
+        // ciphertext stealing
+        const uint8_t key_15[32] = {
+                0xff, 0xfe, 0xfd, 0xfc, 0xfb, 0xfa, 0xf9, 0xf8,
+                0xf7, 0xf6, 0xf5, 0xf4, 0xf3, 0xf2, 0xf1, 0xf0,
+                0xbf, 0xbe, 0xbd, 0xbc, 0xbb, 0xba, 0xb9, 0xb8,
+                0xb7, 0xb6, 0xb5, 0xb4, 0xb3, 0xb2, 0xb1, 0xb0,
+        };
+        const uint8_t c_15[17] = {
+                0x0e, 0xfb, 0xc7, 0x53, 0xcf, 0x6e, 0xb5, 0x00,
+                0x0d, 0xd0, 0x77, 0x82, 0x76, 0x6e, 0x1b, 0x60,
+                0x7c,
+        };
+        camellia_xts_init_128(&ctx, key_15);
+        camellia_xts_encrypt_128(&ctx, c, m, 17, 0x9a78563412UL);
+        ASSERT_TRUE(memcmp(c, c_15, 17) == 0);
+        camellia_xts_decrypt_128(&ctx, m_actual, c, 17, 0x9a78563412UL);
+        ASSERT_TRUE(memcmp(m, m_actual, 17) == 0);
+
+        printf("testing CAMELLIA_XTS 128-bit encrypt-decrypt...\n");
+        const size_t lens[] = { 16, 31, 255, 256, 257, 512, 1000, 4096, 4096 + 15 };
+        for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+                const size_t len = lens[i];
+                uint64_t sector;
+                m_rand(key, sizeof(key));
+                m_rand((uint8_t*)&sector, sizeof(sector));
+                m_rand(m, sizeof(m));
+                camellia_xts_init_128(&ctx, key);
+
+                camellia_xts_encrypt_128(&ctx, c, m, len, sector);
+
+                // stealing only touches the last two blocks
+                if (len % 16 != 0) {
+                        const size_t full = len / 16 * 16 - 16;
+                        uint8_t c_full[4096];
+                        if (full > 0) {
+                                camellia_xts_encrypt_128(&ctx, c_full, m, full, sector);
+                                ASSERT_TRUE(memcmp(c, c_full, full) == 0);
+                        }
+                }
+
+                memcpy(m_actual, c, len);
+                ASSERT_TRUE(camellia_xts_decrypt_128(&ctx, m_actual, m_actual, len, sector) == 0);
+                ASSERT_TRUE(memcmp(m, m_actual, len) == 0);
+        }
+
+        printf("testing CAMELLIA_XTS 128-bit rejects sectors below one block...\n");
+        const size_t short_lens[] = { 0, 1, 15 };
+        for (size_t i = 0; i < sizeof(short_lens) / sizeof(short_lens[0]); i++) {
+                memset(c, 0xaa, sizeof(c));
+                ASSERT_TRUE(camellia_xts_encrypt_128(&ctx, c, m, short_lens[i], 0) == -1);
+                ASSERT_TRUE(camellia_xts_decrypt_128(&ctx, c, m, short_lens[i], 0) == -1);
+                for (size_t j = 0; j < sizeof(c); j++) {
+                        ASSERT_TRUE(c[j] == 0xaa);
+                }
+        }
+}
+
+void test_gift_cofb(void)
+{
+        // NIST LWC KAT, Count = 1, 567 and 1089: key = nonce = 00..0f and
+        // the ad and message are 00, 01, ... of the listed lengths
+        printf("testing GIFT_COFB to known values...\n");
+        uint8_t key[16], nonce[16];
+        uint8_t tag[GIFT_COFB_TAG_BYTES], tag_naive[GIFT_COFB_TAG_BYTES];
+        struct gift_cofb_ctx ctx, ctx_naive;
+
+        static uint8_t ad[100], m[100], c[100], c_naive[100], m_actual[100];
+
+        const uint8_t tag_1[16] = {
+                0x36, 0x89, 0x65, 0x83, 0x6d, 0x36, 0x61, 0x4d,
+                0xe2, 0xfc, 0x24, 0xd0, 0xf8, 0x01, 0xb9, 0xaf,
+        };
+        const uint8_t c_567[17] = {
+                0xc4, 0x39, 0x14, 0x56, 0xa1, 0x01, 0xa0, 0xe3,
+                0x4e, 0xda, 0xca, 0x52, 0x7a, 0xc7, 0x3e, 0xd2,
+                0xb8,
+        };
+        const uint8_t tag_567[16] = {
+                0x5f, 0xee, 0x9b, 0x3c, 0xac, 0xfa, 0x3f, 0x8e,
+                0xbe, 0x21, 0x76, 0x45, 0x8c, 0x67, 0x76, 0xb5,
+        };
+        const uint8_t c_1089[32] = {
+                0xba, 0xf5, 0x63, 0xc6, 0x0f, 0xbe, 0xdd, 0xc5,
+                0x66, 0x29, 0x95, 0xf4, 0xc6, 0x78, 0xbe, 0x80,
+                0xa7, 0xf7, 0xde, 0x9b, 0x3a, 0xd8, 0xc9, 0x7a,
+                0xa6, 0xca, 0x17, 0x01, 0x6d, 0x2a, 0xe6, 0x50,
+        };
+        const uint8_t tag_1089[16] = {
+                0x8e, 0x6f, 0xb3, 0xf7, 0x9b, 0x41, 0x2a, 0x16,
+                0x27, 0xab, 0x7d, 0xfa, 0x75, 0x5e, 0x0a, 0x22,
+        };
+        for (size_t i = 0; i < 16; i++) {
+                key[i] = i;
+                nonce[i] = i;
+        }
+        for (size_t i = 0; i < 32; i++) {
+                ad[i] = i;
+                m[i] = i;
+        }
+        const enum gift_cofb_kernel kernels[] = {
+                GIFT_COFB_NAIVE, GIFT_COFB_VEC_SLICED, GIFT_COFB_FIXSLICED,
+        };
+        for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+                gift_cofb_init(&ctx, key, kernels[k]);
+
+                gift_cofb_encrypt(&ctx, c, tag, m, 0, ad, 0, nonce);
+                ASSERT_TRUE(memcmp(tag, tag_1, 16) == 0);
+
+                gift_cofb_encrypt(&ctx, c, tag, m, 17, ad, 5, nonce);
+                ASSERT_TRUE(memcmp(c, c_567, 17) == 0);
+                ASSERT_TRUE(memcmp(tag, tag_567, 16) == 0);
+
+                gift_cofb_encrypt(&ctx, c, tag, m, 32, ad, 32, nonce);
+                ASSERT_TRUE(memcmp(c, c_1089, 32) == 0);
+                ASSERT_TRUE(memcmp(tag, tag_1089, 16) == 0);
+                ASSERT_TRUE(gift_cofb_decrypt(&ctx, m_actual, c, 32, ad, 32, nonce, tag) == 0);
+                ASSERT_TRUE(memcmp(m, m_actual, 32) == 0);
+        }
+
+        printf("testing GIFT_COFB kernels agree...\n");
+        const size_t lens[] = { 0, 1, 15, 16, 17, 32, 33, 100 };
+        const size_t n = sizeof(lens) / sizeof(lens[0]);
+
+        for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < n; j++) {
+                        m_rand(key, sizeof(key));
+                        m_rand(nonce, sizeof(nonce));
+                        m_rand(ad, sizeof(ad));
+                        m_rand(m, sizeof(m));
+
+                        gift_cofb_init(&ctx, key, GIFT_COFB_FASTEST);
+                        gift_cofb_init(&ctx_naive, key, GIFT_COFB_NAIVE);
+                        gift_cofb_encrypt(&ctx, c, tag, m, lens[i], ad, lens[j], nonce);
+                        gift_cofb_encrypt(&ctx_naive, c_naive, tag_naive, m, lens[i], ad, lens[j], nonce);
+                        ASSERT_TRUE(memcmp(c, c_naive, lens[i]) == 0);
+                        ASSERT_TRUE(memcmp(tag, tag_naive, sizeof(tag)) == 0);
+
+                        ASSERT_TRUE(gift_cofb_decrypt(&ctx, m_actual, c, lens[i], ad, lens[j], nonce, tag) == 0);
+                        ASSERT_TRUE(memcmp(m, m_actual, lens[i]) == 0);
+                }
+        }
+
+        printf("testing GIFT_COFB rejects forgeries...\n");
+        m_rand(key, sizeof(key));
+        gift_cofb_init(&ctx, key, GIFT_COFB_FASTEST);
+        gift_cofb_encrypt(&ctx, c, tag, m, 33, ad, 17, nonce);
+
+        c[32] ^= 0x01;
+        ASSERT_TRUE(gift_cofb_decrypt(&ctx, m_actual, c, 33, ad, 17, nonce, tag) == -1);
+        c[32] ^= 0x01;
+        ad[0] ^= 0x80;
+        ASSERT_TRUE(gift_cofb_decrypt(&ctx, m_actual, c, 33, ad, 17, nonce, tag) == -1);
+        ad[0] ^= 0x80;
+        tag[15] ^= 0x01;
+        ASSERT_TRUE(gift_cofb_decrypt(&ctx, m_actual, c, 33, ad, 17, nonce, tag) == -1);
+        tag[15] ^= 0x01;
+        // padding must not collide with a full block
+        ASSERT_TRUE(gift_cofb_decrypt(&ctx, m_actual, c, 32, ad, 17, nonce, tag) == -1);
+        ASSERT_TRUE(gift_cofb_decrypt(&ctx, m_actual, c, 33, ad, 16, nonce, tag) == -1);
+
+        // in-place
+        memcpy(m_actual, c, 33);
+        ASSERT_TRUE(gift_cofb_decrypt(&ctx, m_actual, m_actual, 33, ad, 17, nonce, tag) == 0);
+        ASSERT_TRUE(memcmp(m, m_actual, 33) == 0);
+}
+
+void test_camellia_gcm(void)
+{
+        // NIST GCM test cases 4 and 16 (key, nonce, plaintext and ad) with
+        // Camellia in place of AES; the outputs come from the SP 800-38D
+        // construction over OpenSSL's Camellia-ECB, checked against OpenSSL's
+        // AES-GCM on the original vectors
+        printf("testing CAMELLIA_GCM to known values...\n");
+        struct camellia_gcm_ctx ctx;
+        uint8_t tag[CAMELLIA_GCM_TAG_BYTES];
+        static uint8_t ad[100], m[1000], c[1000], m_actual[1000];
+
+        const uint8_t key[32] = {
+                0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+                0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+                0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+                0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+        };
+        const uint8_t nonce[CAMELLIA_GCM_NONCE_BYTES] = {
+                0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad,
+                0xde, 0xca, 0xf8, 0x88,
+        };
+        const uint8_t m_4[60] = {
+                0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5,
+                0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+                0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda,
+                0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+                0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53,
+                0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+                0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57,
+                0xba, 0x63, 0x7b, 0x39,
+        };
+        const uint8_t ad_4[20] = {
+                0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+                0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+                0xab, 0xad, 0xda, 0xd2,
+        };
+
+        const uint8_t c_4[60] = {
+                0xd0, 0xd9, 0x4a, 0x13, 0xb6, 0x32, 0xf3, 0x37,
+                0xa0, 0xcc, 0x99, 0x55, 0xb9, 0x4f, 0xa0, 0x20,
+                0xc8, 0x15, 0xf9, 0x03, 0xaa, 0xb1, 0x2f, 0x1e,
+                0xfa, 0xf2, 0xfe, 0x9d, 0x90, 0xf7, 0x29, 0xa6,
+                0xcc, 0xcb, 0xfa, 0x98, 0x6e, 0xf2, 0xff, 0x2c,
+                0x33, 0xde, 0x41, 0x8d, 0x9a, 0x25, 0x29, 0x09,
+                0x1c, 0xf1, 0x8f, 0xe6, 0x52, 0xc1, 0xcf, 0xde,
+                0x13, 0xf8, 0x26, 0x06,
+        };
+        const uint8_t tag_4[16] = {
+                0x9f, 0x45, 0x88, 0x69, 0x43, 0x15, 0x76, 0xea,
+                0x6a, 0x09, 0x54, 0x56, 0xec, 0x6b, 0x81, 0x01,
+        };
+        camellia_gcm_init_128(&ctx, key);
+        camellia_gcm_encrypt(&ctx, c, tag, m_4, 60, ad_4, 20, nonce);
+        ASSERT_TRUE(memcmp(c, c_4, 60) == 0);
+        ASSERT_TRUE(memcmp(tag, tag_4, 16) == 0);
+
+        const uint8_t c_16[60] = {
+                0xad, 0x14, 0x2c, 0x11, 0x57, 0x9d, 0xd9, 0x5e,
+                0x41, 0xf3, 0xc1, 0xf3, 0x24, 0xda, 0xbc, 0x25,
+                0x58, 0x64, 0xd9, 0x20, 0xf1, 0xb6, 0x57, 0x59,
+                0xd8, 0xf5, 0x60, 0xd4, 0x94, 0x8d, 0x44, 0x77,
+                0x58, 0xdf, 0xdc, 0xf7, 0x7a, 0xa9, 0xf6, 0x25,
+                0x81, 0xc7, 0xff, 0x57, 0x2a, 0x03, 0x7f, 0x81,
+                0x0c, 0xb1, 0xa9, 0xc4, 0xb3, 0xca, 0x6e, 0xd6,
+                0x38, 0x17, 0x9b, 0x77,
+        };
+        const uint8_t tag_16[16] = {
+                0x4e, 0x4b, 0x17, 0x8d, 0x8f, 0xe2, 0x6f, 0xdc,
+                0x95, 0xe2, 0xe7, 0x24, 0x6d, 0xd9, 0x4b, 0xec,
+        };
+        camellia_gcm_init_256(&ctx, key);
+        camellia_gcm_encrypt(&ctx, c, tag, m_4, 60, ad_4, 20, nonce);
+        ASSERT_TRUE(memcmp(c, c_16, 60) == 0);
+        ASSERT_TRUE(memcmp(tag, tag_16, 16) == 0);
+
+        // several batches, only the last block and the tag are listed here
+        const uint8_t c_long_tail[16] = {
+                0xc0, 0xd6, 0xc7, 0x3d, 0x55, 0x07, 0xc6, 0xcd,
+                0xac, 0x75, 0x70, 0x25, 0x38, 0x4c, 0xef, 0xb2,
+        };
+        const uint8_t tag_long[16] = {
+                0xbc, 0x17, 0x59, 0x94, 0xf7, 0x80, 0x40, 0x81,
+                0x29, 0xf7, 0xc7, 0x0a, 0x75, 0x5e, 0xca, 0xc3,
+        };
+        for (size_t i = 0; i < 1000; i++) {
+                m[i] = i;
+        }
+        camellia_gcm_init_128(&ctx, key);
+        camellia_gcm_encrypt(&ctx, c, tag, m, 1000, NULL, 0, nonce);
+        ASSERT_TRUE(memcmp(c + 984, c_long_tail, 16) == 0);
+        ASSERT_TRUE(memcmp(tag, tag_long, 16) == 0);
+
+        const uint8_t c_long_tail_256[16] = {
+                0x85, 0x03, 0x35, 0xd4, 0xbc, 0x22, 0x1a, 0x5e,
+                0x4d, 0x58, 0xce, 0x57, 0x97, 0x6a, 0x90, 0x43,
+        };
+        const uint8_t tag_long_256[16] = {
+                0x9a, 0x3a, 0xd4, 0x44, 0xab, 0x04, 0x12, 0xa5,
+                0x6f, 0x9d, 0x47, 0x16, 0xb6, 0x0d, 0xb2, 0xf9,
+        };
+        camellia_gcm_init_256(&ctx, key);
+        camellia_gcm_encrypt(&ctx, c, tag, m, 1000, ad_4, 20, nonce);
+        ASSERT_TRUE(memcmp(c + 984, c_long_tail_256, 16) == 0);
+        ASSERT_TRUE(memcmp(tag, tag_long_256, 16) == 0);
+
+        printf("testing CAMELLIA_GCM encrypt-decrypt...\n");
+        uint8_t key_rand[32], nonce_rand[CAMELLIA_GCM_NONCE_BYTES];
+        const size_t lens[] = { 0, 1, 16, 17, 239, 240, 241, 256, 257, 1000 };
+        const size_t n = sizeof(lens) / sizeof(lens[0]);
+        for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < 2; j++) {
+                        const size_t adlen = lens[i] % 100;
+                        m_rand(key_rand, sizeof(key_rand));
+                        m_rand(nonce_rand, sizeof(nonce_rand));
+                        m_rand(ad, sizeof(ad));
+                        m_rand(m, sizeof(m));
+                        if (j == 0) {
+                                camellia_gcm_init_128(&ctx, key_rand);
+                        } else {
+                                camellia_gcm_init_256(&ctx, key_rand);
+                        }
+
+                        camellia_gcm_encrypt(&ctx, c, tag, m, lens[i], ad, adlen, nonce_rand);
+                        ASSERT_TRUE(camellia_gcm_decrypt(&ctx, m_actual, c, lens[i], ad, adlen,
+                                                         nonce_rand, tag) == 0);
+                        ASSERT_TRUE(memcmp(m, m_actual, lens[i]) == 0);
+
+                        // in-place both ways
+                        uint8_t tag_in_place[CAMELLIA_GCM_TAG_BYTES];
+                        memcpy(m_actual, m, lens[i]);
+                        camellia_gcm_encrypt(&ctx, m_actual, tag_in_place, m_actual, lens[i],
+                                             ad, adlen, nonce_rand);
+                        ASSERT_TRUE(memcmp(c, m_actual, lens[i]) == 0);
+                        ASSERT_TRUE(memcmp(tag, tag_in_place, sizeof(tag)) == 0);
+                        ASSERT_TRUE(camellia_gcm_decrypt(&ctx, m_actual, m_actual, lens[i], ad, adlen,
+                                                         nonce_rand, tag) == 0);
+                        ASSERT_TRUE(memcmp(m, m_actual, lens[i]) == 0);
+                }
+        }
+
+        printf("testing CAMELLIA_GCM rejects forgeries...\n");
+        camellia_gcm_init_128(&ctx, key);
+        camellia_gcm_encrypt(&ctx, c, tag, m, 300, ad, 17, nonce);
+
+        c[299] ^= 0x01;
+        ASSERT_TRUE(camellia_gcm_decrypt(&ctx, m_actual, c, 300, ad, 17, nonce, tag) == -1);
+        c[299] ^= 0x01;
+        ad[0] ^= 0x80;
+        ASSERT_TRUE(camellia_gcm_decrypt(&ctx, m_actual, c, 300, ad, 17, nonce, tag) == -1);
+        ad[0] ^= 0x80;
+        tag[15] ^= 0x01;
+        ASSERT_TRUE(camellia_gcm_decrypt(&ctx, m_actual, c, 300, ad, 17, nonce, tag) == -1);
+        tag[15] ^= 0x01;
+        ASSERT_TRUE(camellia_gcm_decrypt(&ctx, m_actual, c, 299, ad, 17, nonce, tag) == -1);
+        ASSERT_TRUE(camellia_gcm_decrypt(&ctx, m_actual, c, 300, ad, 17, nonce, tag) == 0);
 }
 
 void test_camellia_naive(void)
@@ -392,6 +1210,41 @@ void test_camellia_spec_opt(void)
                 ASSERT_EQUALS(m[0], m_decr[0]);
                 ASSERT_EQUALS(m[1], m_decr[1]);
         }
+
+        printf("testing CAMELLIA_SPEC_OPT 256-bit encrypt to known value...\n");
+        uint64_t key_256[4] = {
+                0x0123456789abcdefUL, 0xfedcba9876543210UL,
+                0x0011223344556677UL, 0x8899aabbccddeeffUL
+        };
+        struct camellia_rks_256 rks_256, rks_naive_256;
+
+        m[0] = 0x0123456789abcdefUL;
+        m[1] = 0xfedcba9876543210UL;
+        c_expected[0] = 0x9acc237dff16d76cUL;
+        c_expected[1] = 0x20ef7c919e3a7509UL;
+
+        camellia_spec_opt_generate_round_keys_256(&rks_256, key_256);
+        camellia_spec_opt_encrypt_256(c, m, &rks_256);
+        ASSERT_EQUALS(c[0], c_expected[0]);
+        ASSERT_EQUALS(c[1], c_expected[1]);
+
+        printf("testing CAMELLIA_SPEC_OPT 256-bit against CAMELLIA_NAIVE...\n");
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)m, sizeof(m));
+                m_rand((uint8_t*)key_256, sizeof(key_256));
+                camellia_spec_opt_generate_round_keys_256(&rks_256, key_256);
+                camellia_naive_generate_round_keys_256(&rks_naive_256, key_256);
+                ASSERT_TRUE(memcmp(&rks_256, &rks_naive_256, sizeof(rks_256)) == 0);
+
+                uint64_t m_decr[2], c_naive[2];
+                camellia_spec_opt_encrypt_256(c, m, &rks_256);
+                camellia_naive_encrypt_256(c_naive, m, &rks_naive_256);
+                camellia_spec_opt_decrypt_256(m_decr, c, &rks_256);
+                ASSERT_EQUALS(c[0], c_naive[0]);
+                ASSERT_EQUALS(c[1], c_naive[1]);
+                ASSERT_EQUALS(m[0], m_decr[0]);
+                ASSERT_EQUALS(m[1], m_decr[1]);
+        }
 }
 
 void test_camellia_sliced(void)
@@ -437,6 +1290,712 @@ void test_camellia_sliced(void)
                         ASSERT_EQUALS(m_decr[i][1], m[i][1]);
                 }
         }
+
+        printf("testing CAMELLIA_SLICED 128-bit one key per block...\n");
+        uint64_t keys[16][2];
+        struct camellia_rks_128 rks_naive;
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)m, sizeof(m));
+                m_rand((uint8_t*)keys, sizeof(keys));
+                camellia_sliced_generate_round_keys_128_multi(&rks, keys);
+
+                uint64_t m_decr[16][2];
+                camellia_sliced_encrypt_128(c, m, &rks);
+                camellia_sliced_decrypt_128(m_decr, c, &rks);
+                for (size_t j = 0; j < 16; j++) {
+                        uint64_t c_naive[2];
+                        camellia_naive_generate_round_keys_128(&rks_naive, keys[j]);
+                        camellia_naive_encrypt_128(c_naive, m[j], &rks_naive);
+                        ASSERT_EQUALS(c[j][0], c_naive[0]);
+                        ASSERT_EQUALS(c[j][1], c_naive[1]);
+                        ASSERT_EQUALS(m_decr[j][0], m[j][0]);
+                        ASSERT_EQUALS(m_decr[j][1], m[j][1]);
+                }
+        }
+
+        // blocks at offset 5 of 21-byte records, so none of them is aligned
+        printf("testing CAMELLIA_SLICED 128-bit strided in place...\n");
+        uint8_t records[16 * 21], records_orig[16 * 21];
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand(records, sizeof(records));
+                memcpy(records_orig, records, sizeof(records));
+                for (size_t j = 0; j < 16; j++) {
+                        memcpy(m[j], records + 21 * j + 5, 16);
+                }
+
+                camellia_sliced_generate_round_keys_128(&rks, key);
+                camellia_sliced_encrypt_128(c, m, &rks);
+                camellia_sliced_encrypt_128_strided(records + 5, records + 5, 21, &rks);
+                for (size_t j = 0; j < 16; j++) {
+                        ASSERT_TRUE(memcmp(c[j], records + 21 * j + 5, 16) == 0);
+                }
+
+                camellia_sliced_decrypt_128_strided(records + 5, records + 5, 21, &rks);
+                ASSERT_TRUE(memcmp(records, records_orig, sizeof(records)) == 0);
+        }
+
+        printf("testing CAMELLIA_SLICED 256-bit encrypt to known value...\n");
+        uint64_t key_256[4] = {
+                0x0123456789abcdefUL, 0xfedcba9876543210UL,
+                0x0011223344556677UL, 0x8899aabbccddeeffUL
+        };
+        for (size_t i = 0; i < 16; i++) {
+                m[i][0] = 0x0123456789abcdefUL;
+                m[i][1] = 0xfedcba9876543210UL;
+        }
+        c_expected[0] = 0x9acc237dff16d76cUL;
+        c_expected[1] = 0x20ef7c919e3a7509UL;
+
+        struct camellia_rks_sliced_256 rks_256;
+        camellia_sliced_generate_round_keys_256(&rks_256, key_256);
+        camellia_sliced_encrypt_256(c, m, &rks_256);
+
+        for (size_t i = 0; i < 16; i++) {
+                ASSERT_TRUE(memcmp(c_expected, &c[i], sizeof(c_expected)) == 0);
+        }
+
+        printf("testing CAMELLIA_SLICED 256-bit against CAMELLIA_NAIVE...\n");
+        struct camellia_rks_256 rks_naive_256;
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)m, sizeof(m));
+                m_rand((uint8_t*)key_256, sizeof(key_256));
+                camellia_sliced_generate_round_keys_256(&rks_256, key_256);
+                camellia_naive_generate_round_keys_256(&rks_naive_256, key_256);
+
+                uint64_t m_decr[16][2];
+                camellia_sliced_encrypt_256(c, m, &rks_256);
+                camellia_sliced_decrypt_256(m_decr, c, &rks_256);
+                for (size_t i = 0; i < 16; i++) {
+                        uint64_t c_naive[2];
+                        camellia_naive_encrypt_256(c_naive, m[i], &rks_naive_256);
+                        ASSERT_EQUALS(c[i][0], c_naive[0]);
+                        ASSERT_EQUALS(c[i][1], c_naive[1]);
+                        ASSERT_EQUALS(m_decr[i][0], m[i][0]);
+                        ASSERT_EQUALS(m_decr[i][1], m[i][1]);
+                }
+        }
+
+        printf("testing CAMELLIA_SLICED 256-bit strided in place...\n");
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key_256, sizeof(key_256));
+                m_rand(records, sizeof(records));
+                memcpy(records_orig, records, sizeof(records));
+                for (size_t j = 0; j < 16; j++) {
+                        memcpy(m[j], records + 21 * j + 5, 16);
+                }
+
+                camellia_sliced_generate_round_keys_256(&rks_256, key_256);
+                camellia_sliced_encrypt_256(c, m, &rks_256);
+                camellia_sliced_encrypt_256_strided(records + 5, records + 5, 21, &rks_256);
+                for (size_t j = 0; j < 16; j++) {
+                        ASSERT_TRUE(memcmp(c[j], records + 21 * j + 5, 16) == 0);
+                }
+
+                camellia_sliced_decrypt_256_strided(records + 5, records + 5, 21, &rks_256);
+                ASSERT_TRUE(memcmp(records, records_orig, sizeof(records)) == 0);
+        }
+}
+
+#ifdef __AVX2__
+void test_avx2(void)
+{
+        printf("testing GIFT_64_VEC_SLICED_AVX2 against GIFT_64_VEC_SLICED...\n");
+        gift_64_vec_sliced_init();
+        gift_64_vec_sliced_avx2_init();
+
+        uint64_t key[2];
+        uint64_t m[32], c[32], c_expected[32], m_actual[32];
+        uint8x16x4_t rks[ROUNDS_GIFT_64][2];
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m, sizeof(m));
+
+                gift_64_vec_sliced_generate_round_keys(rks, key);
+                gift_64_vec_sliced_encrypt(&c_expected[0], &m[0], rks);
+                gift_64_vec_sliced_encrypt(&c_expected[16], &m[16], rks);
+                gift_64_vec_sliced_avx2_encrypt(c, m, rks);
+                ASSERT_TRUE(memcmp(c, c_expected, sizeof(c)) == 0);
+
+                gift_64_vec_sliced_avx2_decrypt(m_actual, c, rks);
+                ASSERT_TRUE(memcmp(m, m_actual, sizeof(m)) == 0);
+        }
+
+        printf("testing CAMELLIA_SLICED_AVX2 against CAMELLIA_SLICED...\n");
+        camellia_sliced_init();
+        camellia_sliced_avx2_init();
+
+        uint64_t m_128[32][2], c_128[32][2], c_128_expected[32][2], m_128_actual[32][2];
+        struct camellia_rks_sliced_128 rks_128;
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m_128, sizeof(m_128));
+
+                camellia_sliced_generate_round_keys_128(&rks_128, key);
+                camellia_sliced_encrypt_128(c_128_expected, m_128, &rks_128);
+                camellia_sliced_encrypt_128(c_128_expected + 16, m_128 + 16, &rks_128);
+                camellia_sliced_avx2_encrypt_128(c_128, m_128, &rks_128);
+                ASSERT_TRUE(memcmp(c_128, c_128_expected, sizeof(c_128)) == 0);
+
+                camellia_sliced_avx2_decrypt_128(m_128_actual, c_128, &rks_128);
+                ASSERT_TRUE(memcmp(m_128, m_128_actual, sizeof(m_128)) == 0);
+        }
+}
+#endif
+
+#ifdef __ARM_FEATURE_SHA3
+void test_sha3(void)
+{
+        printf("testing GIFT_64_VEC_SLICED_SHA3 against GIFT_64_VEC_SLICED...\n");
+        gift_64_vec_sliced_init();
+        gift_64_vec_sliced_sha3_init();
+
+        uint64_t key[2];
+        uint64_t m[16], c[16], c_expected[16], m_actual[16];
+        uint8x16x4_t rks[ROUNDS_GIFT_64][2];
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m, sizeof(m));
+
+                gift_64_vec_sliced_generate_round_keys(rks, key);
+                gift_64_vec_sliced_encrypt(c_expected, m, rks);
+                gift_64_vec_sliced_sha3_encrypt(c, m, rks);
+                ASSERT_TRUE(memcmp(c, c_expected, sizeof(c)) == 0);
+
+                gift_64_vec_sliced_sha3_decrypt(m_actual, c, rks);
+                ASSERT_TRUE(memcmp(m, m_actual, sizeof(m)) == 0);
+
+                // in place
+                gift_64_vec_sliced_sha3_encrypt(m_actual, m_actual, rks);
+                ASSERT_TRUE(memcmp(m_actual, c_expected, sizeof(c)) == 0);
+        }
+
+        printf("testing CAMELLIA_SLICED_SHA3 against CAMELLIA_SLICED...\n");
+        camellia_sliced_init();
+        camellia_sliced_sha3_init();
+
+        uint64_t m_128[16][2], c_128[16][2], c_128_expected[16][2], m_128_actual[16][2];
+        struct camellia_rks_sliced_128 rks_128;
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m_128, sizeof(m_128));
+
+                camellia_sliced_generate_round_keys_128(&rks_128, key);
+                camellia_sliced_encrypt_128(c_128_expected, m_128, &rks_128);
+                camellia_sliced_sha3_encrypt_128(c_128, m_128, &rks_128);
+                ASSERT_TRUE(memcmp(c_128, c_128_expected, sizeof(c_128)) == 0);
+
+                camellia_sliced_sha3_decrypt_128(m_128_actual, c_128, &rks_128);
+                ASSERT_TRUE(memcmp(m_128, m_128_actual, sizeof(m_128)) == 0);
+
+                // in place
+                camellia_sliced_sha3_encrypt_128(m_128_actual, m_128_actual, &rks_128);
+                ASSERT_TRUE(memcmp(m_128_actual, c_128_expected, sizeof(c_128)) == 0);
+        }
+}
+#endif
+
+#ifdef __ARM_FEATURE_SVE
+// the batch follows the vector length, 2048-bit vectors need 256 blocks
+void test_sve(void)
+{
+        printf("testing GIFT_64_VEC_SLICED_SVE against GIFT_64_VEC_SLICED...\n");
+        gift_64_vec_sliced_init();
+
+        const size_t n = gift_64_vec_sliced_sve_blocks();
+        ASSERT_TRUE(n % 16 == 0 && n <= 256);
+
+        uint64_t key[2];
+        uint64_t m[256], c[256], c_expected[256], m_actual[256];
+        uint8x16x4_t rks[ROUNDS_GIFT_64][2];
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m, sizeof(m));
+
+                gift_64_vec_sliced_generate_round_keys(rks, key);
+                for (size_t j = 0; j < n; j += 16) {
+                        gift_64_vec_sliced_encrypt(&c_expected[j], &m[j], rks);
+                }
+                gift_64_vec_sliced_sve_encrypt(c, m, rks);
+                ASSERT_TRUE(memcmp(c, c_expected, n * sizeof(c[0])) == 0);
+
+                gift_64_vec_sliced_sve_decrypt(m_actual, c, rks);
+                ASSERT_TRUE(memcmp(m, m_actual, n * sizeof(m[0])) == 0);
+
+                // in place
+                gift_64_vec_sliced_sve_encrypt(m_actual, m_actual, rks);
+                ASSERT_TRUE(memcmp(m_actual, c_expected, n * sizeof(c[0])) == 0);
+        }
+
+#if defined(__ARM_FEATURE_SVE2) && defined(__ARM_FEATURE_SVE2_AES)
+        printf("testing CAMELLIA_SLICED_SVE against CAMELLIA_SLICED...\n");
+        camellia_sliced_init();
+
+        ASSERT_EQUALS(camellia_sliced_sve_blocks(), n);
+
+        static uint64_t m_128[256][2], c_128[256][2], c_128_expected[256][2], m_128_actual[256][2];
+        struct camellia_rks_sliced_128 rks_128;
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m_128, sizeof(m_128));
+
+                camellia_sliced_generate_round_keys_128(&rks_128, key);
+                for (size_t j = 0; j < n; j += 16) {
+                        camellia_sliced_encrypt_128(&c_128_expected[j], &m_128[j], &rks_128);
+                }
+                camellia_sliced_sve_encrypt_128(c_128, m_128, &rks_128);
+                ASSERT_TRUE(memcmp(c_128, c_128_expected, n * sizeof(c_128[0])) == 0);
+
+                camellia_sliced_sve_decrypt_128(m_128_actual, c_128, &rks_128);
+                ASSERT_TRUE(memcmp(m_128, m_128_actual, n * sizeof(m_128[0])) == 0);
+        }
+#endif
+}
+#endif
+
+#ifdef __aarch64__
+void test_gift_64_neon(void)
+{
+        printf("testing GIFT_64_NEON against GIFT_64_VEC_SLICED...\n");
+        gift_64_vec_sliced_init();
+
+        uint64_t key[2];
+        uint64_t m[32], c[32], c_expected[32], m_actual[32];
+        uint8x16x4_t rks[ROUNDS_GIFT_64][2];
+        for (int i = 0; i < 100; i++) {
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m, sizeof(m));
+
+                gift_64_vec_sliced_generate_round_keys(rks, key);
+                gift_64_vec_sliced_encrypt(&c_expected[0], &m[0], rks);
+                gift_64_vec_sliced_encrypt(&c_expected[16], &m[16], rks);
+                gift_64_neon_encrypt(c, m, rks);
+                ASSERT_TRUE(memcmp(c, c_expected, sizeof(c)) == 0);
+
+                gift_64_neon_decrypt(m_actual, c, rks);
+                ASSERT_TRUE(memcmp(m, m_actual, sizeof(m)) == 0);
+
+                // in place
+                gift_64_neon_encrypt(m_actual, m_actual, rks);
+                ASSERT_TRUE(memcmp(c, m_actual, sizeof(c)) == 0);
+        }
+}
+#endif
+
+void test_parallel(void)
+{
+        printf("testing PARALLEL ECB/CTR against single-threaded kernels...\n");
+        uint64_t key[2];
+        uint64_t rks_gift[ROUNDS_GIFT_64];
+        uint8x16x4_t rks_gift_sliced[ROUNDS_GIFT_64][2];
+        struct camellia_rks_128 rks_camellia;
+        struct camellia_rks_sliced_128 rks_camellia_sliced;
+        struct gift_64_ctr_ctx ctx;
+
+        const size_t n_max = 1000;
+        uint64_t *m = malloc(n_max * 16), *c = malloc(n_max * 16), *m_actual = malloc(n_max * 16);
+        uint8_t *c_ctr = malloc(n_max * 16);
+        const size_t lens[] = { 0, 5, 16, 100, 1000 };
+        const int threads[] = { 1, 2, 5 };
+
+        gift_64_vec_sliced_init();
+        camellia_sliced_init();
+
+        for (size_t t = 0; t < 3; t++) {
+                struct parallel_pool *pool = parallel_pool_create(threads[t]);
+                ASSERT_TRUE(pool != NULL);
+
+                for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+                        const size_t n = lens[i];
+                        m_rand((uint8_t*)key, sizeof(key));
+                        m_rand((uint8_t*)m, n_max * 16);
+
+                        // GIFT-64 ECB
+                        gift_64_generate_round_keys(rks_gift, key);
+                        gift_64_vec_sliced_generate_round_keys(rks_gift_sliced, key);
+                        parallel_gift_64_ecb_encrypt(pool, c, m, n, rks_gift_sliced);
+                        for (size_t k = 0; k < n; k++) {
+                                ASSERT_EQUALS(c[k], gift_64_encrypt(m[k], rks_gift));
+                        }
+                        parallel_gift_64_ecb_decrypt(pool, m_actual, c, n, rks_gift_sliced);
+                        ASSERT_TRUE(memcmp(m, m_actual, n * 8) == 0);
+
+                        // GIFT-64 CTR (byte lengths that end mid-tile)
+                        gift_64_ctr_init(&ctx, key);
+                        gift_64_ctr_xcrypt(&ctx, (uint8_t*)c, (uint8_t*)m, n * 8 + 3, 0xfffffffffffffff0UL);
+                        parallel_gift_64_ctr_xcrypt(pool, c_ctr, (uint8_t*)m, n * 8 + 3, 0xfffffffffffffff0UL, &ctx);
+                        ASSERT_TRUE(memcmp(c, c_ctr, n * 8 + 3) == 0);
+
+                        // Camellia-128 ECB
+                        camellia_naive_generate_round_keys_128(&rks_camellia, key);
+                        camellia_sliced_generate_round_keys_128(&rks_camellia_sliced, key);
+                        parallel_camellia_ecb_encrypt_128(pool, (uint64_t(*)[2])c, (uint64_t(*)[2])m,
+                                                          n, &rks_camellia_sliced);
+                        for (size_t k = 0; k < n; k++) {
+                                uint64_t c_naive[2];
+                                camellia_naive_encrypt_128(c_naive, &m[2 * k], &rks_camellia);
+                                ASSERT_TRUE(memcmp(c_naive, &c[2 * k], 16) == 0);
+                        }
+                        parallel_camellia_ecb_decrypt_128(pool, (uint64_t(*)[2])m_actual, (uint64_t(*)[2])c,
+                                                          n, &rks_camellia_sliced);
+                        ASSERT_TRUE(memcmp(m, m_actual, n * 16) == 0);
+
+                        // Camellia-128 CTR
+                        const uint64_t nonce[2] = { key[1], 0xfffffffffffffffeUL };
+                        parallel_camellia_ctr_xcrypt_128(pool, c_ctr, (uint8_t*)m, n * 16 - (n > 0),
+                                                         nonce, &rks_camellia_sliced);
+                        for (size_t k = 0; k < n * 16 - (n > 0); k++) {
+                                uint64_t ctr[2] = { nonce[0], nonce[1] + k / 16 };
+                                uint64_t ks[2];
+                                camellia_naive_encrypt_128(ks, ctr, &rks_camellia);
+                                ASSERT_TRUE(c_ctr[k] == (((uint8_t*)m)[k] ^ ((uint8_t*)ks)[k % 16]));
+                        }
+                }
+
+                parallel_pool_destroy(pool);
+        }
+
+        free(m);
+        free(c);
+        free(m_actual);
+        free(c_ctr);
+}
+
+void test_dispatch(void)
+{
+        printf("testing DISPATCH against naive kernels...\n");
+        uint64_t key[2];
+        uint64_t rks[ROUNDS_GIFT_64];
+        struct camellia_rks_128 rks_128;
+        struct gift_64_ctx ctx;
+        struct camellia_ctx_128 ctx_128;
+
+        static uint64_t m[100][2], c[100][2], m_actual[100][2];
+        const size_t lens[] = { 0, 1, 3, 4, 15, 16, 17, 31, 32, 33, 100 };
+
+        for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+                const size_t n = lens[i];
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m, sizeof(m));
+
+                gift_64_ctx_init(&ctx, key);
+                gift_64_generate_round_keys(rks, key);
+                gift_64_encrypt_blocks(&ctx, (uint8_t*)c, (uint8_t*)m, n);
+                for (size_t k = 0; k < n; k++) {
+                        ASSERT_EQUALS(((uint64_t*)c)[k], gift_64_encrypt(((uint64_t*)m)[k], rks));
+                }
+                gift_64_decrypt_blocks(&ctx, (uint8_t*)m_actual, (uint8_t*)c, n);
+                ASSERT_TRUE(memcmp(m, m_actual, n * 8) == 0);
+
+                camellia_ctx_init_128(&ctx_128, key);
+                camellia_naive_generate_round_keys_128(&rks_128, key);
+                camellia_encrypt_blocks_128(&ctx_128, (uint8_t*)c, (uint8_t*)m, n);
+                for (size_t k = 0; k < n; k++) {
+                        uint64_t c_naive[2];
+                        camellia_naive_encrypt_128(c_naive, m[k], &rks_128);
+                        ASSERT_TRUE(memcmp(c_naive, c[k], 16) == 0);
+                }
+                camellia_decrypt_blocks_128(&ctx_128, (uint8_t*)m_actual, (uint8_t*)c, n);
+                ASSERT_TRUE(memcmp(m, m_actual, n * 16) == 0);
+        }
+
+        // in place on blocks embedded in records (odd offsets and strides)
+        printf("testing DISPATCH strided in place...\n");
+        static uint8_t records[100 * 23], records_orig[100 * 23];
+        for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+                const size_t n = lens[i];
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand(records, sizeof(records));
+                memcpy(records_orig, records, sizeof(records));
+
+                gift_64_ctx_init(&ctx, key);
+                gift_64_generate_round_keys(rks, key);
+                gift_64_encrypt_blocks_strided(&ctx, records + 1, records + 1, 11, n);
+                for (size_t k = 0; k < n; k++) {
+                        uint64_t m_k, c_k;
+                        memcpy(&m_k, records_orig + 11 * k + 1, 8);
+                        memcpy(&c_k, records + 11 * k + 1, 8);
+                        ASSERT_EQUALS(c_k, gift_64_encrypt(m_k, rks));
+                }
+                gift_64_decrypt_blocks_strided(&ctx, records + 1, records + 1, 11, n);
+                ASSERT_TRUE(memcmp(records, records_orig, sizeof(records)) == 0);
+
+                camellia_ctx_init_128(&ctx_128, key);
+                camellia_naive_generate_round_keys_128(&rks_128, key);
+                camellia_encrypt_blocks_128_strided(&ctx_128, records + 3, records + 3, 23, n);
+                for (size_t k = 0; k < n; k++) {
+                        uint64_t m_k[2], c_naive[2];
+                        memcpy(m_k, records_orig + 23 * k + 3, 16);
+                        camellia_naive_encrypt_128(c_naive, m_k, &rks_128);
+                        ASSERT_TRUE(memcmp(c_naive, records + 23 * k + 3, 16) == 0);
+                }
+                camellia_decrypt_blocks_128_strided(&ctx_128, records + 3, records + 3, 23, n);
+                ASSERT_TRUE(memcmp(records, records_orig, sizeof(records)) == 0);
+        }
+}
+
+void test_gift_64_differential(void)
+{
+        printf("testing GIFT-64 differential counts against the sbox DDT...\n");
+        gift_64_vec_sliced_init();
+
+        // all rounds of the reduced loop are the full loop
+        uint64_t key[2];
+        uint8x16x4_t rks[ROUNDS_GIFT_64][2], s[2], s_reduced[2];
+        m_rand((uint8_t*)key, sizeof(key));
+        m_rand((uint8_t*)s, sizeof(s));
+        memcpy(s_reduced, s, sizeof(s));
+        gift_64_vec_sliced_generate_round_keys(rks, key);
+        gift_64_vec_sliced_rounds(s, rks);
+        gift_64_vec_sliced_rounds_range(s_reduced, rks, 0, ROUNDS_GIFT_64);
+        ASSERT_TRUE(memcmp(s, s_reduced, sizeof(s)) == 0);
+
+        // one round: the key addition cancels, so the output difference is
+        // the permuted sbox output difference of nibble 0
+        struct gift_64_differential_config cfg = {
+                .delta = 0x1,
+                .mask = ~0UL,
+                .rounds = 1,
+                .key = { key[0], key[1] },
+                .seed = 42,
+                .pairs = 1UL << 18,
+        };
+        uint64_t ddt[16] = { 0 };
+        for (uint64_t x = 0; x < 16; x++) {
+                ddt[(gift_64_subcells(x) ^ gift_64_subcells(x ^ cfg.delta)) & 0xf]++;
+        }
+
+        struct parallel_pool *pool = parallel_pool_create(1);
+        ASSERT_TRUE(pool != NULL);
+        struct gift_64_differential_hist hist;
+        ASSERT_TRUE(gift_64_differential_run(pool, &cfg, &hist) == 0);
+        parallel_pool_destroy(pool);
+
+        ASSERT_EQUALS(hist.total, cfg.pairs);
+        ASSERT_EQUALS(hist.dropped, 0UL);
+        size_t nonzero = 0;
+        for (uint64_t d = 0; d < 16; d++) {
+                const uint64_t count = gift_64_differential_hist_get(&hist, gift_64_permute(d));
+                const uint64_t expected = cfg.pairs / 16 * ddt[d];
+                nonzero += ddt[d] != 0;
+                ASSERT_TRUE(count + expected / 32 >= expected && count <= expected + expected / 32);
+        }
+        ASSERT_EQUALS(hist.size, nonzero);
+
+        struct gift_64_differential_entry top[16];
+        const size_t n = gift_64_differential_hist_top(&hist, top, 16);
+        ASSERT_EQUALS(n, nonzero);
+        for (size_t i = 1; i < n; i++) {
+                ASSERT_TRUE(top[i - 1].count >= top[i].count);
+        }
+        ASSERT_TRUE(gift_64_differential_hist_top(&hist, NULL, 0) == 0);
+        gift_64_differential_hist_free(&hist);
+
+        // the counts depend on the seed, not on the number of threads
+        cfg.rounds = 3;
+        cfg.pairs = 100000; // rounded up to tiles
+        struct gift_64_differential_hist hists[2];
+        const int threads[] = { 1, 3 };
+        for (size_t t = 0; t < 2; t++) {
+                pool = parallel_pool_create(threads[t]);
+                ASSERT_TRUE(pool != NULL);
+                ASSERT_TRUE(gift_64_differential_run(pool, &cfg, &hists[t]) == 0);
+                parallel_pool_destroy(pool);
+        }
+        ASSERT_EQUALS(hists[0].total, (cfg.pairs + GIFT_64_DIFFERENTIAL_TILE_PAIRS - 1) /
+                                      GIFT_64_DIFFERENTIAL_TILE_PAIRS * GIFT_64_DIFFERENTIAL_TILE_PAIRS);
+        ASSERT_EQUALS(hists[0].total, hists[1].total);
+        ASSERT_EQUALS(hists[0].size, hists[1].size);
+        for (size_t i = 0; i < hists[0].capacity; i++) {
+                const struct gift_64_differential_entry *e = &hists[0].entries[i];
+                if (e->count != 0) {
+                        ASSERT_EQUALS(gift_64_differential_hist_get(&hists[1], e->diff), e->count);
+                }
+        }
+        for (size_t t = 0; t < 2; t++) {
+                gift_64_differential_hist_free(&hists[t]);
+        }
+
+        // a bounded histogram still accounts for every pair
+        cfg.max_entries = 8;
+        pool = parallel_pool_create(2);
+        ASSERT_TRUE(pool != NULL);
+        ASSERT_TRUE(gift_64_differential_run(pool, &cfg, &hist) == 0);
+        parallel_pool_destroy(pool);
+        ASSERT_TRUE(hist.size <= cfg.max_entries);
+        uint64_t kept = 0;
+        for (size_t i = 0; i < hist.capacity; i++) {
+                kept += hist.entries[i].count;
+        }
+        ASSERT_TRUE(hist.dropped > 0);
+        ASSERT_EQUALS(kept + hist.dropped, hist.total);
+        gift_64_differential_hist_free(&hist);
+}
+
+// rounds start to end - 1 of gift_64_encrypt
+static uint64_t gift_64_encrypt_rounds_ref(uint64_t c, const uint64_t rks[ROUNDS_GIFT_64],
+                                           const int start, const int end)
+{
+        for (int round = start; round < end; round++) {
+                c = gift_64_permute(gift_64_subcells(c)) ^ rks[round];
+        }
+        return c;
+}
+
+void test_reduced_rounds(void)
+{
+        printf("testing reduced-round GIFT-64 kernels against GIFT_64...\n");
+        gift_64_vec_sliced_init();
+        camellia_sliced_init();
+
+        const int ranges[][2] = { { 0, 1 }, { 0, 5 }, { 3, 9 }, { 5, 15 }, { 27, 28 }, { 0, 28 }, { 7, 7 } };
+        uint64_t key[2], m[16], c[16];
+        uint64_t rks[ROUNDS_GIFT_64], rks_table[ROUNDS_GIFT_64];
+        uint8x16x4_t rks_sliced[ROUNDS_GIFT_64][2];
+        for (size_t r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++) {
+                const int start = ranges[r][0], end = ranges[r][1];
+                m_rand((uint8_t*)key, sizeof(key));
+                m_rand((uint8_t*)m, sizeof(m));
+                gift_64_generate_round_keys(rks, key);
+                gift_64_table_generate_round_keys(rks_table, key);
+                gift_64_vec_sliced_generate_round_keys(rks_sliced, key);
+
+                gift_64_vec_sliced_encrypt_rounds(c, m, rks_sliced, start, end);
+                for (size_t i = 0; i < 16; i++) {
+                        ASSERT_EQUALS(c[i], gift_64_encrypt_rounds_ref(m[i], rks, start, end));
+                }
+                gift_64_sliced_encrypt_rounds(c, m, key, start, end);
+                for (size_t i = 0; i < 8; i++) {
+                        ASSERT_EQUALS(c[i], gift_64_encrypt_rounds_ref(m[i], rks, start, end));
+                }
+                ASSERT_EQUALS(gift_64_table_encrypt_rounds(m[0], rks_table, start, end),
+                              gift_64_encrypt_rounds_ref(m[0], rks, start, end));
+        }
+
+        printf("testing reduced-round CAMELLIA_SLICED 128-bit split at every round...\n");
+        uint64_t m_128[16][2], c_128[16][2], c_expected[16][2];
+        struct camellia_rks_sliced_128 rks_camellia;
+        m_rand((uint8_t*)key, sizeof(key));
+        m_rand((uint8_t*)m_128, sizeof(m_128));
+        camellia_sliced_generate_round_keys_128(&rks_camellia, key);
+        camellia_sliced_encrypt_128(c_expected, m_128, &rks_camellia);
+        for (int k = 0; k <= CAMELLIA_ROUNDS_128; k++) {
+                camellia_sliced_encrypt_128_rounds(c_128, m_128, &rks_camellia, 0, k);
+                camellia_sliced_encrypt_128_rounds(c_128, c_128, &rks_camellia, k, CAMELLIA_ROUNDS_128);
+                ASSERT_TRUE(memcmp(c_128, c_expected, sizeof(c_128)) == 0);
+        }
+}
+
+static int parity_8(const int x)
+{
+        return __builtin_popcount(x) & 1;
+}
+
+// scalar definitions of the tables for one S-box of n entries
+static void sbox_tables_check(const uint8_t *sbox, const int bits)
+{
+        const int n = 1 << bits;
+        uint8_t inv[256];
+        for (int x = 0; x < n; x++) {
+                inv[sbox[x]] = x;
+        }
+
+        struct sbox_vec s;
+        ASSERT_TRUE(sbox_vec_init(&s, sbox, bits) == 0);
+        uint16_t *ddt = malloc(n * n * 2), *bct = malloc(n * n * 2);
+        int16_t *lat = malloc(n * n * 2), *dlct = malloc(n * n * 2);
+        sbox_ddt(ddt, &s);
+        sbox_lat(lat, &s);
+        ASSERT_TRUE(sbox_bct(bct, &s) == 0);
+        sbox_dlct(dlct, &s);
+
+        for (int a = 0; a < n; a++) {
+                for (int b = 0; b < n; b++) {
+                        int d = 0, l = 0, bo = 0, dl = 0;
+                        for (int x = 0; x < n; x++) {
+                                d += (sbox[x] ^ sbox[x ^ a]) == b;
+                                l += parity_8(a & x) == parity_8(b & sbox[x]);
+                                bo += (inv[sbox[x] ^ b] ^ inv[sbox[x ^ a] ^ b]) == a;
+                                dl += parity_8(b & (sbox[x] ^ sbox[x ^ a])) == 0;
+                        }
+                        ASSERT_EQUALS((uint64_t)ddt[a * n + b], (uint64_t)d);
+                        ASSERT_TRUE(lat[a * n + b] == l - n / 2);
+                        ASSERT_EQUALS((uint64_t)bct[a * n + b], (uint64_t)bo);
+                        ASSERT_TRUE(dlct[a * n + b] == dl - n / 2);
+                }
+        }
+
+        free(ddt);
+        free(bct);
+        free(lat);
+        free(dlct);
+}
+
+void test_sbox_tables(void)
+{
+        printf("testing SBOX_TABLES S-boxes against the ciphers...\n");
+        uint8_t sbox[256];
+        sbox_gift(sbox);
+        for (uint64_t x = 0; x < 16; x++) {
+                ASSERT_EQUALS((uint64_t)sbox[x], (gift_64_subcells(x) & 0xf));
+        }
+        for (int i = 1; i <= 4; i++) {
+                // s1, s2, s3, s4 are bytes 7, 6, 5 and 4 of camellia's S
+                sbox_camellia(sbox, i);
+                for (uint64_t x = 0; x < 256; x++) {
+                        ASSERT_EQUALS((uint64_t)sbox[x], ((camellia_naive_S(x << (64 - 8 * i)) >> (64 - 8 * i)) & 0xff));
+                }
+        }
+
+        printf("testing SBOX_TABLES DDT/LAT/BCT/DLCT against scalar definitions...\n");
+        sbox_gift(sbox);
+        sbox_tables_check(sbox, 4);
+        for (int i = 1; i <= 4; i++) {
+                sbox_camellia(sbox, i);
+                sbox_tables_check(sbox, 8);
+        }
+        // a random permutation
+        for (int x = 0; x < 256; x++) {
+                sbox[x] = x;
+        }
+        for (int x = 255; x > 0; x--) {
+                const int y = rand() % (x + 1);
+                const uint8_t t = sbox[x];
+                sbox[x] = sbox[y];
+                sbox[y] = t;
+        }
+        sbox_tables_check(sbox, 8);
+
+        printf("testing SBOX_TABLES properties...\n");
+        struct sbox_vec s;
+        struct sbox_props props;
+        sbox_gift(sbox);
+        sbox_vec_init(&s, sbox, 4);
+        ASSERT_TRUE(sbox_properties(&props, &s) == 0);
+        ASSERT_TRUE(props.differential_uniformity == 6);
+        ASSERT_TRUE(props.linearity == 4);
+        ASSERT_TRUE(props.boomerang_uniformity == 16);
+        ASSERT_TRUE(props.dlct_max == 8);
+        for (int i = 1; i <= 4; i++) {
+                // all affine equivalent to inversion in GF(2^8)
+                sbox_camellia(sbox, i);
+                sbox_vec_init(&s, sbox, 8);
+                ASSERT_TRUE(sbox_properties(&props, &s) == 0);
+                ASSERT_TRUE(props.differential_uniformity == 4);
+                ASSERT_TRUE(props.linearity == 16);
+                ASSERT_TRUE(props.boomerang_uniformity == 6);
+                ASSERT_TRUE(props.dlct_max == 16);
+        }
+
+        // no inverse, no BCT; out of range entries and widths are rejected
+        sbox[1] = sbox[0];
+        ASSERT_TRUE(sbox_vec_init(&s, sbox, 8) == 0);
+        ASSERT_TRUE(!s.bijective);
+        uint16_t *bct = malloc(256 * 256 * 2);
+        ASSERT_TRUE(sbox_bct(bct, &s) == -1);
+        free(bct);
+        ASSERT_TRUE(sbox_vec_init(&s, sbox, 4) == -1);
+        ASSERT_TRUE(sbox_vec_init(&s, sbox, 6) == -1);
 }
 
 int main(int argc, char *argv[])
@@ -448,9 +2007,33 @@ int main(int argc, char *argv[])
         test_gift_64_table();
         test_gift_64_vec_sbox();
         test_gift_64_vec_sliced();
+        test_gift_128_vec_sliced();
+        test_gift_128_fixsliced();
+        test_gift_64_ctr();
+        test_cbc();
+        test_camellia_xts();
+        test_gift_cofb();
+        test_camellia_gcm();
         test_camellia_naive();
         test_camellia_spec_opt();
         test_camellia_sliced();
+#ifdef __AVX2__
+        test_avx2();
+#endif
+#ifdef __ARM_FEATURE_SHA3
+        test_sha3();
+#endif
+#ifdef __ARM_FEATURE_SVE
+        test_sve();
+#endif
+#ifdef __aarch64__
+        test_gift_64_neon();
+#endif
+        test_parallel();
+        test_dispatch();
+        test_gift_64_differential();
+        test_reduced_rounds();
+        test_sbox_tables();
 }
 
 #pragma clang optimize on
@@ -8,3 +8,25 @@ for i in range(128):
     si = (pi % 16) // 8
     ti = ri * 16 + ci * 2 + si
     print(f"dst[{ti}] = src[{i % 8}][{i // 16}][{(i % 16) // 8}]")
+
+# vqtbl2q_u8 indices for gift/vec_sliced_128.c: every S-box bit j (one
+# register per bit) only moves between nibbles, so PermBits is one nibble
+# shuffle per bit over the two registers holding nibbles 0-15 and 16-31
+def nibble_perm(j, inv):
+    idx = [0] * 32
+    for n in range(32):
+        pn = n // 4 + 8 * ((3 * (n % 4) + j) % 4)
+        if inv:
+            idx[n] = pn
+        else:
+            idx[pn] = n
+    return idx
+
+for inv in (False, True):
+    print('')
+    for j in range(4):
+        idx = nibble_perm(j, inv)
+        for half in range(2):
+            lanes = [idx[16 * half + 8 * l:16 * half + 8 * l + 8] for l in range(2)]
+            words = [sum(b << (8 * i) for i, b in enumerate(lane)) for lane in lanes]
+            print(f'0x{words[0]:016x}UL, 0x{words[1]:016x}UL,')
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+
+# byte-indexed tables for gift_64_table_{en,de}crypt_bytes: two adjacent
+# nibble tables of table_64.py (table_64_inv.py) merged into one, the entry of
+# a byte being the XOR of the entries of its nibbles. writes gift/table_bytes.h:
+#   ./table_64_bytes.py > ../impl/gift/table_bytes.h
+
+sbox = (
+    0x1, 0xa, 0x4, 0xc, 0x6, 0xf, 0x3, 0x9,
+    0x2, 0xd, 0xb, 0x7, 0x5, 0x0, 0x8, 0xe
+)
+
+sbox_inv = (
+    0xd, 0x0, 0x8, 0x6, 0x2, 0xc, 0x4, 0xb,
+    0xe, 0x7, 0x1, 0xa, 0x3, 0x9, 0xf, 0x5
+)
+
+permute = (
+    0, 17, 34, 51, 48, 1, 18, 35, 32, 49, 2, 19, 16, 33, 50, 3,
+    4, 21, 38, 55, 52, 5, 22, 39, 36, 53, 6, 23, 20, 37, 54, 7,
+    8, 25, 42, 59, 56, 9, 26, 43, 40, 57, 10, 27, 24, 41, 58, 11,
+    12, 29, 46, 63, 60, 13, 30, 47, 44, 61, 14, 31, 28, 45, 62, 15
+)
+
+permute_inv = (
+    0, 5, 10, 15, 16, 21, 26, 31, 32, 37, 42, 47, 48, 53, 58, 63,
+    12, 1, 6, 11, 28, 17, 22, 27, 44, 33, 38, 43, 60, 49, 54, 59,
+    8, 13, 2, 7, 24, 29, 18, 23, 40, 45, 34, 39, 56, 61, 50, 55,
+    4, 9, 14, 3, 20, 25, 30, 19, 36, 41, 46, 35, 52, 57, 62, 51
+)
+
+def perm(x, p):
+    result = 0
+    for i in range(64):
+        bit = (x >> i) & 0x1
+        result |= bit << p[i]
+    return result
+
+def nibble_tables(s, p):
+    return [[perm(s[x] << (4 * i), p) for x in range(16)] for i in range(16)]
+
+def byte_tables(s, p):
+    t = nibble_tables(s, p)
+    return [[t[2 * i][b & 0xf] ^ t[2 * i + 1][b >> 4] for b in range(256)]
+            for i in range(8)]
+
+def emit(name, tables):
+    print("static const uint64_t %s[8][256] = {" % name)
+    for table in tables:
+        print("        {")
+        for row in range(0, 256, 4):
+            print("                " +
+                  " ".join("0x%016xUL," % x for x in table[row:row + 4]))
+        print("        },")
+    print("};")
+
+print("#pragma once")
+print("")
+print("// generated by scripts/table_64_bytes.py, included by table.c only")
+print("")
+print("#include <stdint.h>")
+print("")
+emit("tables_bytes", byte_tables(sbox, permute))
+print("")
+emit("tables_bytes_inv", byte_tables(sbox_inv, permute_inv))
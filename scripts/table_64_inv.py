@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+
+# tables for gift_64_table_decrypt: inverse S-box followed by the inverse bit
+# permutation, i.e. the encryption tables of table_64.py run backwards
+
+sbox_inv = (
+    0xd, 0x0, 0x8, 0x6, 0x2, 0xc, 0x4, 0xb,
+    0xe, 0x7, 0x1, 0xa, 0x3, 0x9, 0xf, 0x5
+)
+
+permute_inv = (
+    0, 5, 10, 15, 16, 21, 26, 31, 32, 37, 42, 47, 48, 53, 58, 63,
+    12, 1, 6, 11, 28, 17, 22, 27, 44, 33, 38, 43, 60, 49, 54, 59,
+    8, 13, 2, 7, 24, 29, 18, 23, 40, 45, 34, 39, 56, 61, 50, 55,
+    4, 9, 14, 3, 20, 25, 30, 19, 36, 41, 46, 35, 52, 57, 62, 51
+)
+
+def perm_inv(x):
+    result = 0
+    for i in range(64):
+        bit = (x >> i) & 0x1
+        result |= bit << permute_inv[i]
+    return result
+
+tables = []
+for sbox_index in range(16):
+    table = []
+    for sbox_input in range(16):
+        output = sbox_inv[sbox_input]
+        output = perm_inv(output << (4 * sbox_index))
+        table.append(output)
+    tables.append(table)
+
+for table in tables:
+    for x in table:
+        print("{0:#0{1}x}".format(x, 18), end=' ')
+    print('')